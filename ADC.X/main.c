@@ -7,6 +7,9 @@
  * potentiometer and read on channel 0 of the ADC module.
  * Voltage is obtained with precision of 2 digits after the decimal point, 
  * without using float variables.
+ * The display starts and shows the two welcome screens while the readings
+ * are already made (timebase.c is the clock); boot_us keeps the time from the
+ * reset to the first reading, for a debugger.
  * ****************************************************************************
  * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
  * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
@@ -29,10 +32,30 @@
  * Date      | Author            | Description
  * **********|*******************|*********************************************
  * 04/17/2022| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Texts of program memory (ui_text.h)
+ * 10/19/2026| Antonio Castilho  | Display started by lcd_task(), readings from the start
+ * 10/19/2026| Antonio Castilho  | Texts const __rom char (program memory only)
  ******************************************************************************/
 
 #include <xc.h>
 #include "main.h"
+#include "ui_text.h"
+#include "timebase.h"
+
+const __rom char ui_text[UI_TEXT_SIZE] = UI_TEXT(LCD_TEXT_STR);
+
+#define SAMPLE_TICKS    us_to_ticks(1000000UL) // A reading every 1 s.
+
+uint32_t boot_us; // Reset (timebase_ini()) to the first reading, us.
+
+/******************************************************************************
+ * void __interrupt(high_priority) isr_high(void);
+ * TIMER3 overflow of the time base, the clock of the display start.
+ ******************************************************************************/
+void __interrupt(high_priority) isr_high(void)
+{
+    timebase_isr();
+}
 
 void main(void) 
 {
@@ -43,25 +66,43 @@ void main(void)
     uint8_t volt_int = 0;
     uint8_t volt_dec = 0;
     uint8_t col = 0;
-    lcd_ini(); // Configure and Start LCD Display.
+    uint32_t sample_time = 0;
+    uint8_t screen = 0; // 0 first welcome, 1 second welcome, 2 voltage.
+    timebase_ini(); // First: the clock of boot_us and of lcd_task().
+    RCONbits.IPEN = 1;
+    INTCONbits.GIEH = 1;
+    lcd_iniStart(timebase_now()); // Start LCD Display, without waiting.
+    lcd_splash(&ui_text[TXT_WELCOME_PT], &ui_text[TXT_EXAMPLE_PT], 3000);
     adc_ini(); // Configure and start ADC module.
-    // Initial message on display.
-    lcd_prtStr(1,0,"Bem vindo!      "); lcd_prtStr(2,0,"Exemplo LCD-ADC ");
-    __delay_ms(3000); 
-    lcd_prtStr(1,0,"Wellcome!       "); lcd_prtStr(2,0,"LCD-ADC example ");
-    __delay_ms(3000);     
-    lcd_clear(); // Clear Display
-    lcd_cursorOff(); // turn off the cursor.
-    lcd_prtStr(0,0,"Tensao: Voltage:");
     while(1)
     {
-        value_an0 = adc_read(0); // Reads channel 0, connected to a voltage divider.
-        // Gets the voltage value, in 10-bit resolution. Observing precision 
-        // of 2 places after the decimal point.
-        voltage = (uint16_t)((((float)value_an0 * 5)/1023)*100);
+        if(!boot_us || elapsed(sample_time) >= SAMPLE_TICKS)
+        {
+            sample_time = timebase_now();
+            value_an0 = adc_read(0); // Reads channel 0, connected to a voltage divider.
+            // Gets the voltage value, in 10-bit resolution. Observing precision 
+            // of 2 places after the decimal point.
+            voltage = (uint16_t)((((float)value_an0 * 5)/1023)*100);
+            if(!boot_us) boot_us = ticks_to_us(timebase_now());
+        }
+        if(!lcd_task(timebase_now())) continue; // Display starting or welcome shown.
+        if(screen == 0)
+        {
+            lcd_splash(&ui_text[TXT_WELCOME_EN], &ui_text[TXT_EXAMPLE_EN], 3000);
+            screen = 1;
+            continue;
+        }
+        if(screen == 1)
+        {
+            lcd_clear(); // Clear Display
+            lcd_cursorOff(); // turn off the cursor.
+            lcd_prtText(0,0,TXT_VOLTAGE);
+            volt_prev = 0xFFFF; // Voltage to be written.
+            screen = 2;
+        }
         if(voltage != volt_prev)
         {
-            lcd_prtStr(2,0,"                ");
+            lcd_prtText(2,0,TXT_BLANK);
             volt_prev = voltage;
             // Gets the integer part of the value.
             volt_int = (uint8_t)((float)voltage/100);
@@ -70,15 +111,11 @@ void main(void)
             lcd_prtInt(2,col,volt_int); // show integer part on lcd display.
             // correct the position.
             col = (uint8_t)(col + digit_counter(volt_int) + 1); 
-            lcd_prtStr(2,col,","); // Place the comma or decimal point.
+            lcd_prtText(2,col,TXT_COMMA); // Place the comma or decimal point.
             col += 1;
             lcd_prtInt(2,col,volt_dec); // show fractional part on lcd display.
             col = 0;
         }
-        __delay_ms(1000);
-        // TODO: Implement the routine in a function and call it by a task, 
-        // at predetermined times.
-        
     }
 }
 // TODO: Get an average of a number of readings to show voltage.
\ No newline at end of file
@@ -0,0 +1,24 @@
+/* ****************************************************************************
+ * Project: Control Functions             File timebase.h          October/2026
+ * ****************************************************************************
+ * File description: Time base of this project: _XTAL_FREQ from
+ *     main.h, then the shared one, common/timebase.h.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ ******************************************************************************/
+
+#ifndef TIMEBASE_PROJECT_H
+#define	TIMEBASE_PROJECT_H
+
+#include "main.h"
+#include "../common/timebase.h"
+
+#endif	/* TIMEBASE_PROJECT_H */
@@ -0,0 +1,19 @@
+/* ****************************************************************************
+ * Project: Control Functions             File adc.c               October/2026
+ * ****************************************************************************
+ * File description: A/D converter of this project: the
+ *     shared one, common/adc.c.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ ******************************************************************************/
+
+#include "adc.h"
+#include "../common/adc.c"
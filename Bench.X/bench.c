@@ -0,0 +1,206 @@
+/* ****************************************************************************
+ * Project: Control Functions             File bench.c                   October/2026
+ * ****************************************************************************
+ * File description: Cycle benchmark of lcd_prtChar(), adc_read(), ntc_get(),
+ *     spi_write(), pwm1_ini() and pid_run(). See bench.h.
+ *     The stopwatch is stopped (TMR1ON = 0) before it is read, so the 16-bit
+ *     count and the overflows are always consistent. Each overflow adds the
+ *     interrupt to the routine measured: about 30 cycles every 65536.
+ *     Built with gcc (tools/host, no __XC8) main() is renamed and returns at
+ *     the end, for the model-cycle run of tools/bench/bench_host.c.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal;
+ * gpsim 0.31 (p18f4550).
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | lcd_prtStr() x lcd_prtRom(), same 16 characters
+ * 10/19/2026| Antonio Castilho  | lcd_goto() before lcd_prtChar(): not past the end of the row
+ * 10/19/2026| Antonio Castilho  | pid_run() with the gains of PWM.X control.h
+ * 10/19/2026| Antonio Castilho  | Returns at the end in the host build (tools/bench/bench_host.c)
+ * 10/19/2026| Antonio Castilho  | Drivers of common/, ntc_get() of ECTsensor.X with param_ini()
+ * 10/19/2026| Antonio Castilho  | bench_text const __rom char (program memory only)
+ ******************************************************************************/
+
+#include <xc.h>
+#include "bench.h"
+#include "hdw_map.h"
+#include "lcd.h"
+#include "adc.h"
+#include "ntc.h"
+#include "spi.h"
+#include "pwm.h"
+#include "pid.h"
+#include "param.h"
+
+volatile bench_entry_t bench_table[BENCH_N] __at(BENCH_TABLE_ADDR);
+volatile uint16_t bench_state __at(BENCH_STATE_ADDR);
+
+static volatile uint16_t watch_high; // TIMER1 overflows, upper 16 bits of the count.
+static uint32_t watch_overhead;      // Cycles of an empty measurement.
+
+static const __rom char bench_text[] = "PIC18F4550 FATEC"; // Program memory.
+
+static pid_ctrl_t bench_pid; // Gains of PWM.X control.h, derivative on.
+
+/******************************************************************************
+ * Function: void __interrupt(high_priority) isr_high(void)
+ * Description: TIMER1 overflow of the stopwatch; TIMER2 of pwm.c.
+ ******************************************************************************/
+void __interrupt(high_priority) isr_high(void)
+{
+    if(PIE1bits.TMR1IE && PIR1bits.TMR1IF)
+    {
+        PIR1bits.TMR1IF = 0;
+        watch_high++;
+    }
+    pwm_isr();
+}
+
+/******************************************************************************
+ * Function: static void watch_start(void)
+ * Description: Clears and starts the stopwatch.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+static void watch_start(void)
+{
+    T1CONbits.TMR1ON = 0;
+    TMR1H = 0; // RD16: TMR1H is written together with TMR1L. Pg 132.
+    TMR1L = 0;
+    watch_high = 0;
+    PIR1bits.TMR1IF = 0;
+    T1CONbits.TMR1ON = 1;
+}
+// end of function static void watch_start(void)
+
+/******************************************************************************
+ * Function: static uint32_t watch_stop(void)
+ * Description: Stops the stopwatch and reads it.
+ * Input: void
+ * Output: cycles since watch_start(), with the cost of the measurement.
+ ******************************************************************************/
+static uint32_t watch_stop(void)
+{
+    uint8_t low;
+    uint8_t high;
+
+    T1CONbits.TMR1ON = 0;
+    low = TMR1L; // RD16: reading TMR1L latches TMR1H.
+    high = TMR1H;
+    if(PIR1bits.TMR1IF) // Overflow not yet served.
+    {
+        PIR1bits.TMR1IF = 0;
+        watch_high++;
+    }
+    return ((uint32_t)watch_high << 16) | ((uint16_t)high << 8) | low;
+}
+// end of function static uint32_t watch_stop(void)
+
+/******************************************************************************
+ * Function: static void bench_add(uint8_t id, uint32_t cycles)
+ * Description: Keeps the smallest and the largest count of a routine.
+ * Input: routine (BENCH_xxx) and the cycles of one call.
+ * Output: void
+ ******************************************************************************/
+static void bench_add(uint8_t id, uint32_t cycles)
+{
+    cycles = (cycles > watch_overhead) ? cycles - watch_overhead : 0;
+    if(cycles < bench_table[id].min) bench_table[id].min = cycles;
+    if(cycles > bench_table[id].max) bench_table[id].max = cycles;
+}
+// end of function static void bench_add(uint8_t id, uint32_t cycles)
+
+void main(void)
+{
+    uint32_t t;
+    uint8_t id;
+    uint8_t run;
+    int16_t pv = 0;
+
+    // OSCCON Oscillator control register Pg 34.
+    OSCCON = 0x72; // IDLEN = 0, IRCF = 111 (8 MHz, _XTAL_FREQ), SCS = 10 (internal oscillator).
+
+    bench_state = 0;
+    for(id = 0; id < BENCH_N; id++)
+    {
+        bench_table[id].min = 0xFFFFFFFF;
+        bench_table[id].max = 0;
+    }
+
+    lcd_ini();
+    spi_initialize(); // Before adc_ini(): spi_initialize() writes ADCON0 = 0 (ADON off).
+    INTCON3bits.INT2IE = 0; // No MCP2515 here.
+    adc_ini();
+    param_ini(); // Parameters of ntc_get() (param_list.h).
+    pid_ini(&bench_pid, PID_GAIN(0.8), PID_GAIN(0.02), PID_GAIN(0.5), PID_Q15(0.25),
+            0, PID_Q15(1.0));
+
+    // TIMER1: 16-bit (RD16), prescale 1:1, Fosc/4, off. Pg 131.
+    T1CON = 0x80;
+    IPR1bits.TMR1IP = 1;
+    PIE1bits.TMR1IE = 1;
+    RCONbits.IPEN = 1;
+    INTCONbits.GIEH = 1;
+
+    watch_overhead = 0xFFFFFFFF;
+    for(run = 0; run < BENCH_RUNS; run++)
+    {
+        watch_start();
+        t = watch_stop();
+        if(t < watch_overhead) watch_overhead = t;
+    }
+
+    for(run = 0; run < BENCH_RUNS; run++)
+    {
+        lcd_goto(2, run); // Inside the row: a character past the end is not sent.
+        watch_start();
+        lcd_prtChar('0' + run);
+        bench_add(BENCH_LCD_PRTCHAR, watch_stop());
+
+        watch_start();
+        adc_read(pinNTC);
+        bench_add(BENCH_ADC_READ, watch_stop());
+
+        watch_start();
+        ntc_get(pinNTC);
+        bench_add(BENCH_NTC_GET, watch_stop());
+
+        watch_start();
+        spi_write(0x55);
+        bench_add(BENCH_SPI_WRITE, watch_stop());
+
+        watch_start();
+        pwm1_ini();
+        bench_add(BENCH_PWM1_INI, watch_stop());
+
+        watch_start();
+        lcd_prtStr(1, 0, (const uint8_t *)"PIC18F4550 FATEC");
+        bench_add(BENCH_LCD_PRTSTR, watch_stop());
+
+        watch_start();
+        lcd_prtRom(1, 0, bench_text);
+        bench_add(BENCH_LCD_PRTROM, watch_stop());
+
+        pv = (int16_t)(pv + 2500); // Another measurement each run: every branch of pid_run().
+        watch_start();
+        pid_run(&bench_pid, 512 << 5, pv);
+        bench_add(BENCH_PID_RUN, watch_stop());
+    }
+
+    bench_state = BENCH_DONE;
+#if defined(__XC8)
+    while(1)
+    {
+        CLRWDT(); // WDT = ON in fuse_bits.h.
+    }
+#endif
+}
@@ -0,0 +1,63 @@
+/* ****************************************************************************
+ * Project: Control Functions             File bench.h                   October/2026
+ * ****************************************************************************
+ * File description: Cycle benchmark of the hot paths of the drivers.
+ *     Each routine is called BENCH_RUNS times between the start and the stop
+ *     of a stopwatch: TIMER1 counting every instruction cycle (prescale 1:1)
+ *     with its overflow counted by the high priority interrupt, that is, a
+ *     32-bit count of cycles. The cost of an empty measurement is taken out.
+ *     The smallest and the largest count of each routine are written to
+ *     bench_table, at the fixed address BENCH_TABLE_ADDR, and bench_state
+ *     becomes BENCH_DONE: a simulator (tools/bench/bench_gpsim.py) or a
+ *     debugger reads the table from the RAM, no display or UART needed.
+ *
+ *     bench_table[id], little endian (as XC8 keeps uint32_t):
+ *         offset 0  min (4 bytes)    offset 4  max (4 bytes)
+ *     The ids below are read by the script: keep the "bench:" tags.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal;
+ * gpsim 0.31 (p18f4550).
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | lcd_prtStr() x lcd_prtRom(), same 16 characters
+ * 10/19/2026| Antonio Castilho  | pid_run(), one sample of the PWM.X control loop
+ ******************************************************************************/
+
+#ifndef BENCH_H
+#define	BENCH_H
+
+#include <xc.h>
+#include <stdint.h>
+
+#define BENCH_RUNS          8       // Calls of each routine.
+#define BENCH_TABLE_ADDR    0x300   // bench_table, bank 3.
+#define BENCH_STATE_ADDR    0x2FE   // bench_state, 2 bytes before the table.
+#define BENCH_DONE          0xBE9C  // bench_state when the table is complete.
+
+// Routines measured (id: bench: name).
+#define BENCH_LCD_PRTCHAR   0   // bench: lcd_prtChar
+#define BENCH_ADC_READ      1   // bench: adc_read
+#define BENCH_NTC_GET       2   // bench: ntc_get
+#define BENCH_SPI_WRITE     3   // bench: spi_write
+#define BENCH_PWM1_INI      4   // bench: pwm1_ini
+#define BENCH_LCD_PRTSTR    5   // bench: lcd_prtStr
+#define BENCH_LCD_PRTROM    6   // bench: lcd_prtRom
+#define BENCH_PID_RUN       7   // bench: pid_run
+#define BENCH_N             8
+
+typedef struct
+{
+    uint32_t min; // Cycles.
+    uint32_t max;
+} bench_entry_t;
+
+#endif	/* BENCH_H */
@@ -0,0 +1,26 @@
+/* ****************************************************************************
+ * Project: Control Functions             File ntc.h               October/2026
+ * ****************************************************************************
+ * File description: NTC thermistor of this project: _XTAL_FREQ and
+ *     the probes from hdw_map.h, adc_read() from adc.h, then the shared one,
+ *     common/ntc.h.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ ******************************************************************************/
+
+#ifndef NTC_PROJECT_H
+#define	NTC_PROJECT_H
+
+#include "hdw_map.h"
+#include "adc.h"
+#include "../common/ntc.h"
+
+#endif	/* NTC_PROJECT_H */
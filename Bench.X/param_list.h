@@ -0,0 +1,28 @@
+/* Program: Bench     File: param_list.h
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ * Description:
+ *      Parameters of ntc.c (common/), the thermistor and circuit of ECTsensor.X, so ntc_get() is
+ *      measured with the same code. P(name, type, default, min, max, function called after a
+ *      change). No log in the EEPROM here: the block is at the default PARAM_EE_START.
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 10/19/2026 | Antonio Castilho  | Created                                                                    | 00.00.01
+ *________________________________________________________________________________________
+ */
+#ifndef PARAM_LIST_H
+#define	PARAM_LIST_H
+
+#include "ntc.h"
+
+#define PARAM_VERSION   1
+
+#define PARAM_LIST(P) \
+    P(NTC_BETA,     PARAM_U16, 3600,  1000, 10000,   ntc_update) /* Beta coefficient, K. */ \
+    P(NTC_R0,       PARAM_U32, 2048,  100,  1000000, ntc_update) /* Resistance at t0, ohms. */ \
+    P(NTC_T0,       PARAM_U16, 298,   233,  423,     ntc_update) /* Reference temperature, K. */ \
+    P(NTC_R_REF,    PARAM_U32, 10000, 100,  1000000, 0)          /* Reference resistor, ohms. */ \
+    P(NTC_SAMPLES,  PARAM_U8,  10,    1,    64,      0)          /* A/D readings averaged. */
+
+#endif	/* PARAM_LIST_H */
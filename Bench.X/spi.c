@@ -0,0 +1,19 @@
+/* ****************************************************************************
+ * Project: Control Functions             File spi.c               October/2026
+ * ****************************************************************************
+ * File description: SPI master of this project: the
+ *     shared one, common/spi.c.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ ******************************************************************************/
+
+#include "spi.h"
+#include "../common/spi.c"
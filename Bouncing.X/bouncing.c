@@ -18,35 +18,57 @@
  * Date           | Author                | Description
  * **********|************* *|***************************************************
  * 05/13/2022 | Antonio Castilho  | Function has been created
+ * 10/19/2026 | Antonio Castilho  | Buttons through debounce.c events
  ******************************************************************************/ 
 
-/* In development. Initial studies of the elementary functions that will be used.*/
-
 #include <xc.h>
 #include "fuse_bits.h"
 #include "hdw_map.h"
+#include "bouncing.h"
 #include "adc.h"
 #include "lcd.h"
 
+/******************************************************************************
+ * Function: void __interrupt(low_priority) isr_low(void)
+ * Description: TIMER0, debounce tick.
+ ******************************************************************************/
+void __interrupt(low_priority) isr_low(void)
+{
+    debounce_isr();
+}
+
 void main(void)
 {
+    uint8_t event;
+
     adc_ini(); // Configure ADC module (Releasing PORTB).
     lcd_wellcome();
-    uint8_t btn1_flag = OFF; // this variable indicates that the button was pressed.
-    TRISE = INPUT; // Button 1, 2 and 3 - I/O.
     TRISBbits.TRISB7 = OUTPUT; // LED 7 of FATEC board. 
+    TRISBbits.TRISB6 = OUTPUT; // LED 6 of FATEC board. 
     LATBbits.LATB7 = OFF; // FATEC board LEDs are in pull-up. So to turn on send 0, to turn off send 1.
+    LATBbits.LATB6 = OFF;
+
+    debounce_ini(); // Button 1, 2 and 3 - I/O, TIMER0 tick.
+    RCONbits.IPEN = 1;   // Interrupt priority levels. Pg 100.
+    INTCONbits.GIEH = 1;
+    INTCONbits.GIEL = 1;
     
     while(1)
     {
-        if(BTN_1 == PRESSED)  btn1_flag = ON; // Button pressed set flag
+        event = debounce_get();
 
-        if(BTN_1 == UNPRESSED && btn1_flag == ON) // when release button execute commands
+        if(event == (DEBOUNCE_PRESS | KEY_BTN_1)) // Each press counts once, bounces do not.
         {
             LED_7 = (uint8_t)(~LED_7);   //Changes the state of the FATEC board LED and can apply voltage 
                                                        // to the transistor gate (MOSFET DRIVER).
-            btn1_flag = OFF; // return to initial condition for acquisition of other presses.
+        }
+        if(event == (DEBOUNCE_LONG | KEY_BTN_1)) LATBbits.LATB7 = 1; // Long press: LED off (pull-up).
+
+        // Button 2: press and, held, repeat.
+        if(event == (DEBOUNCE_PRESS | KEY_BTN_2) || event == (DEBOUNCE_REPEAT | KEY_BTN_2))
+        {
+            LED_6 = (uint8_t)(~LED_6);
         }
         
     } // end while
-} // end main
\ No newline at end of file
+} // end main
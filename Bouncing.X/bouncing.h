@@ -17,14 +17,14 @@
  * Date          | Author                | Description
  * ****** ***|******* *******|***************************************************
  * 05/09/2022| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Debounce functions in debounce.c
  ******************************************************************************/ 
 
 #ifndef BOUNCING_H
 #define	BOUNCING_H
 
 #include <xc.h>
-
-// TODO functions to control the bounce effect which can be used in different applications.
+#include "debounce.h" // Functions to control the bounce effect, for any application.
 
 #endif	/* BOUNCING_H */
 
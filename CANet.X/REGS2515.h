@@ -23,6 +23,7 @@
  * Date           | Author                | Description
  * **********|************* *|***************************************************
  * 03/12/2022 | Antonio Castilho  | Function has been created
+ * 10/19/2026 | Antonio Castilho  | TX1IE and TX1IF are bit 3 (0x08). Pg 53, 54
  ******************************************************************************/ 
 
 /*******************************************************************
@@ -187,7 +188,7 @@
 #define RX0IE         0x01
 #define RX1IE         0x02
 #define TX0IE         0x04
-#define TX1IE         0x80
+#define TX1IE         0x08
 #define TX2IE         0x10
 #define ERRIE         0x20
 #define WAKIE        0x40
@@ -197,7 +198,7 @@
 #define RX0IF         0x01
 #define RX1IF         0x02
 #define TX0IF         0x04
-#define TX1IF         0x80
+#define TX1IF         0x08
 #define TX2IF         0x10
 #define ERRIF         0x20
 #define WAKIF        0x40
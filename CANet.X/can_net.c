@@ -27,6 +27,8 @@
  * Date           | Author                | Description
  * **********|************* *|*************************************************************
  * 05/21/2022 | Antonio Castilho  | created
+ * 10/19/2026 | Antonio Castilho  | MCP2515 error counters streamed by the UART telemetry
+ * 10/19/2026 | Antonio Castilho  | MCP_INT (INT2) posted as events, message counters
  ****************************************************************************************/ 
 
 #include <xc.h>
@@ -35,7 +37,46 @@
 #include "REGS2515.h"
 #include "mcp2515.h"
 #include "spi.h"
+#include "uart.h"
+#include "telemetry.h"
+#include "event.h"
 
+#define TLM_PERIOD_MS   100 // Telemetry of the MCP2515 counters.
+
+EVENT_QUEUE(can_events, 4); // Posted by isr_high.
+
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Function: void __interrupt(high_priority) isr_high(void);
+ * Description:  MCP_INT on INT2 (falling edge). The MCP2515 is on the SPI also used by the
+ *               main loop, so the interrupt only posts the event; CANINTF is read there.
+ * Input: void
+ * Output: void
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+void __interrupt(high_priority) isr_high(void)
+{
+    if(INTCON3bits.INT2IE && INTCON3bits.INT2IF)
+    {
+        INTCON3bits.INT2IF = NO;
+        event_post(&can_events, EVENT_CAN, 0, 0);
+    }
+
+} // end isr_high
+
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Function: void __interrupt(low_priority) isr_low(void);
+ * Description:  EUSART transmitter of the telemetry.
+ * Input: void
+ * Output: void
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+void __interrupt(low_priority) isr_low(void)
+{
+    uart_isr();
+
+} // end isr_low
 
 /*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
  * Function: void main(void);
@@ -47,7 +88,48 @@
 
 void main(void)
 {
-    
+    event_t event;
+    uint8_t flags;
+    uint16_t rx_count = 0;
+    uint16_t tx_count = 0;
+    uint8_t ms = 0;
+
+    spi_initialize();
+    INTCON3bits.INT2IE = DISABLE; // Enabled after the MCP2515 is configured.
+    mcp2515_initialize();
+    INTCON2bits.INTEDG2 = 0; // MCP_INT is active low: interrupt on the falling edge. Pg 102.
+    INTCON3bits.INT2IF = NO;
+    INTCON3bits.INT2IE = ENABLE;
+    telemetry_ini(); // EUSART on RC6, UART_BAUD.
+
+    RCONbits.IPEN = ENABLE;  // Interrupt priority levels. Pg 100.
+    INTCONbits.GIEH = ENABLE;
+    INTCONbits.GIEL = ENABLE;
+
+    while(1)
+    {
+        // MCP_INT stays low while any flag of CANINTF is set, and INT2 only sees the falling
+        // edge: the flags are served until the pin goes high again.
+        while(event_get(&can_events, &event) || MCP_INT == LOW)
+        {
+            flags = mcp2515_read(CANINTF);
+            if(flags & RX0IF) rx_count++;
+            if(flags & RX1IF) rx_count++;
+            if(flags & TX0IF) tx_count++;
+            if(flags & TX1IF) tx_count++;
+            if(flags & TX2IF) tx_count++;
+            mcp2515_bitModify(CANINTF, flags, 0x00); // Only the flags read; messages not used yet.
+        }
+
+        // Error and message counters every TLM_PERIOD_MS.
+        if(++ms >= TLM_PERIOD_MS)
+        {
+            ms = 0;
+            telemetry_can(mcp2515_read(TEC), mcp2515_read(REC), mcp2515_read(EFLG), rx_count, tx_count);
+        }
+        __delay_ms(1);
+    }
+
 } // end main
 
 
@@ -23,6 +23,7 @@
  * Date           | Author                | Description
  * **********|************* *|***************************************************
  * 03/13/2022 | Antonio Castilho  | Function has been created
+ * 10/19/2026 | Antonio Castilho  | mcp2515_bitModify()
  ******************************************************************************/ 
 
 #include <xc.h>
@@ -82,6 +83,26 @@ uint8_t mcp2515_read(uint8_t addr)
     
 } // end void message_to_can(data_frame *message)
 
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-
+ * Function: void mcp2515_bitModify(uint8_t addr, uint8_t mask, uint8_t value);
+ * Description: Changes only the bits of mask in a register (BIT MODIFY instruction), e.g. to
+ *              clear the flags of CANINTF already served without losing a new one. Pg 66.
+ * Input: register address, bits to change and their new value.
+ * Output: void
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+void mcp2515_bitModify(uint8_t addr, uint8_t mask, uint8_t value)
+{
+    CS = LOW;
+    spi_write(CAN_BIT_MODIFY);
+    spi_write(addr);
+    spi_write(mask);
+    spi_write(value);
+    CS = HIGH;
+
+} // end void mcp2515_bitModify(uint8_t addr, uint8_t mask, uint8_t value)
+
 /*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-
  * Function: void mcp2515_initialize(void);
  * Description: Configures for MCP2515 module
@@ -21,6 +21,7 @@
  * Date           | Author                | Description
  * **********|************* *|***************************************************
  * 03/13/2022 | Antonio Castilho  | Function has been created
+ * 10/19/2026 | Antonio Castilho  | mcp2515_bitModify()
  ******************************************************************************/ 
 #ifndef MCP2515_H
 #define	MCP2515_H
@@ -44,6 +45,7 @@ data_frame can_message;
 void mcp2515_reset(void);
 void mcp2515_write(uint8_t addr, uint8_t value);
 uint8_t mcp2515_read(uint8_t addr);
+void mcp2515_bitModify(uint8_t addr, uint8_t mask, uint8_t value);
 void mcp2515_initialize(void);
 
 uint8_t message_from_can(unsigned char addr);
@@ -20,6 +20,8 @@
  * Date           | Author                | Description
  * **********|************* *|***************************************************
  * 03/12/2022 | Antonio Castilho  | Function has been created
+ * 10/19/2026 | Antonio Castilho  | LCD_D7 is RD7 (was RD4); the driver uses LCD_PIN_x of lcd.h
+ * 10/19/2026 | Antonio Castilho  | digit_counter() declared by lcd.h only (common/lcd.h)
  ******************************************************************************/ 
 #ifndef PROJECT_CONSTANTS_H
 #define	PROJECT_CONSTANTS_H
@@ -88,7 +90,7 @@
 // the RC3 pin is not implemented in PIC18F4550.
 #define USB2               PORTCbits.RC4
 #define USB3               PORTCbits.RC5
-// PORTCbits.RC6 free to use
+#define UART_TX         PORTCbits.RC6 // EUSART TX, telemetry (uart.c).
 #define SDO                PORTCbits.RC7
 
 /******************************************************************************/
@@ -101,7 +103,7 @@
 #define LCD_D4         PORTDbits.RD4
 #define LCD_D5         PORTDbits.RD5
 #define LCD_D6         PORTDbits.RD6
-#define LCD_D7         PORTDbits.RD4
+#define LCD_D7         PORTDbits.RD7
 /******************************************************************************/
 // PORT E - Switch Pins 
 /******************************************************************************/
@@ -115,7 +117,6 @@
 // Function prototypes
 /******************************************************************************/
 void delay_rms(uint16_t value); // Delay calibrated with timer1
-uint8_t digit_counter(const int32_t number);
 /******************************************************************************/
 #endif	/* PROJECT_CONSTANTS_H */
 
@@ -150,6 +151,6 @@ uint8_t digit_counter(const int32_t number);
 *  #define LCD_D4               PORTDbits.RD4
 *  #define LCD_D5               PORTDbits.RD5
 *  #define LCD_D6               PORTDbits.RD6
-*  #define LCD_D7               PORTDbits.RD4
+*  #define LCD_D7               PORTDbits.RD7
 *  *****************************************************************************
 */
\ No newline at end of file
@@ -0,0 +1,24 @@
+/* ****************************************************************************
+ * Project: Control Functions             File uart.h              October/2026
+ * ****************************************************************************
+ * File description: EUSART transmitter of this project: _XTAL_FREQ from
+ *     project_constants.h, then the shared one, common/uart.h.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ ******************************************************************************/
+
+#ifndef UART_PROJECT_H
+#define	UART_PROJECT_H
+
+#include "project_constants.h"
+#include "../common/uart.h"
+
+#endif	/* UART_PROJECT_H */
@@ -20,6 +20,11 @@
 
 #define pinNTC   0  // thermistor connection
 
+// Profiler probes (prof.h). Compiled in with -DPROF_ENABLE=1 in the project properties.
+#define PROBE_NTC       0  // ntc_get().
+#define PROBE_ADC       1  // adc_read() inside ntc_get().
+#define PROBE_LCD       2  // Temperature written on the display.
+
 #define ON                1
 #define OFF               0
 #define TRUE            1
@@ -2,11 +2,29 @@
  * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
  * Description:
  *      This program tests the functions for temperature reading with an automotive type ntc sensor.
+ *      Built with -DPROF_ENABLE=1, ntc_get(), adc_read() and the display are profiled (prof.h) and
+ *      the results are shown while BTN_1 is pressed, one probe per reading.
+ *      Lowest and highest temperature are kept in the data EEPROM (eelog.c) across power cycles and
+ *      shown on row 2; BTN_3 starts them again from the temperature read.
+ *      The constants of the thermistor are parameters (param_list.h) read from the EEPROM at the
+ *      start; a TLM_PARAM record received on RC7 (telemetry_receive()) is a command of
+ *      param_command(), answered by a TLM_PARAM record (tools/telemetry_decode.py --param).
+ *      The display starts (and shows the welcome) alongside the readings: the first one is
+ *      made a few ms after the reset, and boot_us keeps the time to it for a debugger.
+ *      Each reading goes out as a TLM_NTC record of telemetry.c (RC6, UART_BAUD of uart.h).
  *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
  * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
  * _______________________________________________________________________________________
  * Date:          | Author:               | Description:                                                             | Version:
  * 04/26/2022 | Antonio Castilho  | Created                                                                    | 00.00.01
+ * 10/19/2026 | Antonio Castilho  | Profiler probes                                                        | 00.00.02
+ * 10/19/2026 | Antonio Castilho  | Min/max temperature in the EEPROM log                       | 00.00.03
+ * 10/19/2026 | Antonio Castilho  | Parameters of param.c                                              | 00.00.04
+ * 10/19/2026 | Antonio Castilho  | Texts of program memory (ui_text.h)                             | 00.00.05
+ * 10/19/2026 | Antonio Castilho  | Display started by lcd_task(), first reading at the start    | 00.00.06
+ * 10/19/2026 | Antonio Castilho  | Texts const __rom char (program memory only)                 | 00.00.07
+ * 10/19/2026 | Antonio Castilho  | Each reading on the telemetry (TLM_NTC)                      | 00.00.08
+ * 10/19/2026 | Antonio Castilho  | Commands of param.c received on RC7 (TLM_PARAM)          | 00.00.09
  *________________________________________________________________________________________
  */
 
@@ -17,6 +35,65 @@
 #include "lcd.h"
 #include "adc.h"
 #include "ntc.h"
+#include "timebase.h"
+#include "prof.h"
+#include "eelog.h"
+#include "telemetry.h"
+#include "param.h"
+#include "ui_text.h"
+
+const __rom char ui_text[UI_TEXT_SIZE] = UI_TEXT(LCD_TEXT_STR);
+
+// Readings (0.5 s) between two records of the extremes, from the parameter in s: 1 min by
+// default, so each cell of the 16 slots of the log is written at most about 4 times an hour.
+#define EXT_SAVE_READS  ((uint16_t)param_get(PARAM_EXT_SAVE_S) * 2)
+
+uint32_t boot_us; // Reset (timebase_ini()) to the first reading, us.
+
+typedef struct
+{
+    uint16_t min;   // Temperature x 100.
+    uint16_t max;
+} ext_t;
+
+/****************************************************************************************
+ * void __interrupt(high_priority) isr_high(void);
+ * TIMER3 overflow of the time base, the clock of the display start and of the profiler.
+ ****************************************************************************************/
+void __interrupt(high_priority) isr_high(void)
+{
+    timebase_isr();
+}
+
+/****************************************************************************************
+ * void __interrupt(low_priority) isr_low(void);
+ * EEIF, next byte of the record of the extremes in the EEPROM; TXIF and RCIF, next byte of the
+ * telemetry and byte received.
+ ****************************************************************************************/
+void __interrupt(low_priority) isr_low(void)
+{
+    eelog_isr();
+    uart_isr();
+}
+
+/****************************************************************************************
+ * static void param_link(void);
+ * Runs the commands of param.c received as TLM_PARAM records and sends each reply back.
+ ****************************************************************************************/
+static void param_link(void)
+{
+    uint8_t type;
+    uint8_t length;
+    uint8_t command[TLM_PAYLOAD_MAX];
+    uint8_t reply[PARAM_REPLY_LENGTH];
+
+    while(telemetry_receive(&type, command, &length))
+    {
+        if(type != TLM_PARAM) continue;
+        length = param_command(command, length, reply);
+        telemetry_send(TLM_PARAM, reply, length); // Lost if the buffer is full; the PC asks again.
+    }
+}
 
 void main(void)
 {
@@ -25,22 +102,86 @@ void main(void)
     
     uint16_t temp = 0;
     uint16_t value_readCH = 0;
-    uint16_t temp_previous = 0;
+    uint16_t temp_previous = 0xFFFF; // Screen to be written.
     uint8_t temp_int = 0;
     uint8_t temp_dec = 0;
     uint8_t col = 7;
+    ext_t ext = {0xFFFF, 0}; // Extremes; min > max: none yet.
+    uint8_t ext_changed = 0;
+    uint16_t ext_reads = 0;
+    uint8_t i;
+    uint8_t ext_show = 1;    // Row 2 to be written.
+    uint8_t lcd_free;        // lcd_task(): start and welcome done.
+#if PROF_ENABLE
+    uint8_t probe = 0; // Probe shown on the display.
+#endif
+
+    timebase_ini(); // First: the clock of boot_us.
+    PROF_INI();
+    eelog_ini();
+    param_ini(); // Parameters of the EEPROM, or the defaults.
+    eelog_read(&ext, sizeof(ext)); // Extremes of before the power cycle, if any.
+    telemetry_ini(); // EUSART on RC6 and RC7.
+    RCONbits.IPEN = 1;
+    INTCONbits.GIEH = 1;
+    INTCONbits.GIEL = 1;
+    lcd_iniStart(timebase_now()); // The display starts while the readings are made.
+    lcd_splash(&ui_text[TXT_WELCOME1], &ui_text[TXT_WELCOME2], 5000);
     adc_ini(); // Initializes the ADC module.
-    __delay_ms(50);
-    lcd_wellcome(); // Initializes the LCD display and writes the welcome message.
-    __delay_ms(5000); // Wait for the message to be read.
-    
-    lcd_prtStr(1,0,"Temp.:       'C   ");
     
     while(1)
     {
+        PROF_ENTER(PROBE_NTC);
         temp = ntc_get(pinNTC);
+        PROF_EXIT(PROBE_NTC);
+        if(!boot_us) boot_us = now_us();
+        telemetry_ntc(pinNTC, temp); // Lost if the buffer is full, never waited for.
+        lcd_free = lcd_task(timebase_now());
+
+        // Extremes: shown at once, written to the EEPROM at most every EXT_SAVE_READS.
+        if(BTN_3 == 0) // Pressed: start again from here.
+        {
+            ext.min = 0xFFFF;
+            ext.max = 0;
+        }
+        if(temp < ext.min || temp > ext.max)
+        {
+            if(temp < ext.min) ext.min = temp;
+            if(temp > ext.max) ext.max = temp;
+            ext_changed = 1;
+            ext_show = 1;
+        }
+        if(ext_reads < EXT_SAVE_READS) ext_reads++;
+        if(ext_changed && ext_reads >= EXT_SAVE_READS && eelog_write(&ext, sizeof(ext)))
+        {
+            ext_changed = 0;
+            ext_reads = 0;
+        }
+
+#if PROF_ENABLE
+        if(lcd_free && BTN_1 == 0) // Pressed: show the probes instead of the temperature.
+        {
+            PROF_LCD(probe);
+            probe = (uint8_t)((probe + 1) % (PROBE_LCD + 1));
+            temp_previous = 0xFFFF; // Rewrite the temperature when released.
+            __delay_ms(500);
+            continue;
+        }
+#endif
+        if(lcd_free && temp_previous == 0xFFFF) // First screen, or back from the probes.
+        {
+            lcd_prtText(1,0,TXT_TEMPERATURE);
+            ext_show = 1;
+        }
+        if(lcd_free && ext_show)
+        {
+            ext_show = 0;
+            lcd_prtText(2,0,TXT_EXTREMES);
+            lcd_prtInt(2,4,ext.min / 100);
+            lcd_prtInt(2,12,ext.max / 100);
+        }
         
-        if(temp != temp_previous)
+        if(lcd_free && temp != temp_previous)
         {
             LED_7 = (uint8_t)(~LED_7); // Notice of reread on the ADC channel
             
@@ -51,15 +192,23 @@ void main(void)
             // Get the fractional part.
             temp_dec = (uint8_t)((((float)temp/100)  - (float)temp_int)*100);
         
+            PROF_ENTER(PROBE_LCD);
             lcd_prtInt(1,col,temp_int); // show integer part on lcd display.
             // correct the position.
             col = (uint8_t)(col + digit_counter(temp_int)+1); 
-            lcd_prtStr(1,col,","); // Place the comma or decimal point.
+            lcd_prtText(1,col,TXT_COMMA); // Place the comma or decimal point.
             col += 1;
             lcd_prtInt(1,col,temp_dec); // show fractional part on lcd display.
+            PROF_EXIT(PROBE_LCD);
             col = 7;
         }
-        __delay_ms(500); //Take a new reading every 0.5 s.
+        for(i = 0; i < 50; i++) // Take a new reading every 0.5 s.
+        {
+            param_link(); // Commands of the parameters received, if any.
+            param_task(); // Next byte of a save of the parameters, if any.
+            lcd_task(timebase_now()); // Next step of the start of the display, if any.
+            __delay_ms(10);
+        }
         LED_7 = 1; // Led off.
         
         // TODO Do this function on an RTOS system.
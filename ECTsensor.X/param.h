@@ -0,0 +1,24 @@
+/* ****************************************************************************
+ * Project: Control Functions             File param.h             October/2026
+ * ****************************************************************************
+ * File description: Parameters of this project: the list from
+ *     param_list.h, then the shared one, common/param.h.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ ******************************************************************************/
+
+#ifndef PARAM_PROJECT_H
+#define	PARAM_PROJECT_H
+
+#include "param_list.h"
+#include "../common/param.h"
+
+#endif	/* PARAM_PROJECT_H */
@@ -0,0 +1,35 @@
+/* Program: ECT Sensor Tester     File: param_list.h
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ * Description:
+ *      Parameters of the program that can be changed at run time (param.c): thermistor and circuit
+ *      of ntc.c and period of the record of the extremes. The values used to be constants of ntc.h.
+ *      P(name, type, default, min, max, function called after a change). Change PARAM_VERSION
+ *      when the list changes, so an old block of the EEPROM is not taken.
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 10/19/2026 | Antonio Castilho  | Created                                                                    | 00.00.01
+ *________________________________________________________________________________________
+ */
+#ifndef PARAM_LIST_H
+#define	PARAM_LIST_H
+
+#include "ntc.h"
+#include "eelog.h"
+
+#define PARAM_VERSION   1
+
+#define PARAM_LIST(P) \
+    P(NTC_BETA,     PARAM_U16, 3600,  1000, 10000,   ntc_update) /* Beta coefficient, K. */ \
+    P(NTC_R0,       PARAM_U32, 2048,  100,  1000000, ntc_update) /* Resistance at t0, ohms. */ \
+    P(NTC_T0,       PARAM_U16, 298,   233,  423,     ntc_update) /* Reference temperature, K. */ \
+    P(NTC_R_REF,    PARAM_U32, 10000, 100,  1000000, 0)          /* Reference resistor, ohms. */ \
+    P(NTC_SAMPLES,  PARAM_U8,  10,    1,    64,      0)          /* A/D readings averaged. */ \
+    P(EXT_SAVE_S,   PARAM_U16, 60,    10,   3600,    0)          /* s between two records of the extremes. */
+
+// The EEPROM log of the extremes (eelog.c) uses 0x00 to 0x7F; the block goes after it.
+#define PARAM_EE_START  (EELOG_START + EELOG_SIZE)
+#define PARAM_EE_BUSY() eelog_isBusy()
+
+#endif	/* PARAM_LIST_H */
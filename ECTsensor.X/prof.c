@@ -0,0 +1,22 @@
+/* Program: Profiler     File: prof.c
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ * Description:
+ *      Profiler of this project: the shared one, common/prof.c, with the time base
+ *      (timebase.h) and the display (lcd.h) of this project.
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 10/19/2026 | Antonio Castilho  | Created                                                                    | 00.00.01
+ * 10/19/2026 | Antonio Castilho  | The profiler is common/prof.c                                    | 00.00.02
+ *________________________________________________________________________________________
+ */
+
+#include "prof.h"
+
+#if PROF_ENABLE && defined(__XC8)
+    #include "timebase.h"
+    #include "lcd.h"
+#endif
+
+#include "../common/prof.c"
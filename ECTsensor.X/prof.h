@@ -0,0 +1,18 @@
+/* Program: Profiler     File: prof.h
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ * Description:
+ *      Profiler of this project: the shared one, common/prof.h.
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 10/19/2026 | Antonio Castilho  | Created                                                                    | 00.00.01
+ * 10/19/2026 | Antonio Castilho  | The profiler is common/prof.h                                    | 00.00.02
+ *________________________________________________________________________________________
+ */
+#ifndef PROF_PROJECT_H
+#define	PROF_PROJECT_H
+
+#include "../common/prof.h"
+
+#endif	/* PROF_PROJECT_H */
@@ -0,0 +1,25 @@
+/* ****************************************************************************
+ * Project: Control Functions             File telemetry.h          October/2026
+ * ****************************************************************************
+ * File description: Telemetry records of this project: _XTAL_FREQ from
+ *     hdw_map.h, its uart.h, then the shared one, common/telemetry.h.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ ******************************************************************************/
+
+#ifndef TELEMETRY_PROJECT_H
+#define	TELEMETRY_PROJECT_H
+
+#include "hdw_map.h"
+#include "uart.h"
+#include "../common/telemetry.h"
+
+#endif	/* TELEMETRY_PROJECT_H */
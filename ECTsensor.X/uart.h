@@ -0,0 +1,30 @@
+/* ****************************************************************************
+ * Project: Control Functions             File uart.h              October/2026
+ * ****************************************************************************
+ * File description: EUSART of this project: _XTAL_FREQ from hdw_map.h,
+ *     UART_BAUD, the receiver (commands of param.c), then the shared one,
+ *     common/uart.h.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Receiver, UART_RX_SIZE
+ ******************************************************************************/
+
+#ifndef UART_PROJECT_H
+#define	UART_PROJECT_H
+
+#include "hdw_map.h"
+
+#define UART_BAUD       57600UL // 8 MHz: 0.8 % off (115200 would be 2.1 %).
+#define UART_RX_SIZE    32      // Two command frames (12 bytes) with room to spare.
+
+#include "../common/uart.h"
+
+#endif	/* UART_PROJECT_H */
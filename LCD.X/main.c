@@ -24,13 +24,35 @@
  * Date      | Author            | Description
  * **********|*******************|*********************************************
  * 03/23/2022| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Texts of program memory (ui_text.h)
+ * 10/19/2026| Antonio Castilho  | isr_low() of the I2C backpack (LCD_BUS_I2C)
+ * 10/19/2026| Antonio Castilho  | Texts const __rom char (program memory only)
  ******************************************************************************/
 
 #include <xc.h>
 #include "lcd.h"
+#include "ui_text.h"
+
+const __rom char ui_text[UI_TEXT_SIZE] = UI_TEXT(LCD_TEXT_STR);
+
+#if LCD_BUS == LCD_BUS_I2C
+/******************************************************************************
+ * void __interrupt(low_priority) isr_low(void);
+ * SSP interrupt, the bytes of the queue of the I2C backpack.
+ ******************************************************************************/
+void __interrupt(low_priority) isr_low(void)
+{
+    lcd_isr();
+}
+#endif
 
 void main(void)
 {
+#if LCD_BUS == LCD_BUS_I2C
+    RCONbits.IPEN = 1;
+    INTCONbits.GIEH = 1;
+    INTCONbits.GIEL = 1;
+#endif
     lcd_ini();
     lcd_cursorOff();
     uint16_t year = 2022;
@@ -38,8 +60,8 @@ void main(void)
 
     while(1)
     {
-        lcd_prtStr(1,0,("Seja Bem Vindo! "));
-        lcd_prtStr(2,0,("LCD Interface v0"));
+        lcd_prtText(1,0,TXT_WELCOME);
+        lcd_prtText(2,0,TXT_VERSION);
         __delay_ms(4000);
         lcd_clear();
         lcd_prtInt(1,5,year);
@@ -0,0 +1,33 @@
+/* ****************************************************************************
+ * Project: Control Functions       File ui_text.h             October/2026
+ * ****************************************************************************
+ * File description: Texts of the display, in program memory (see lcd.h,
+ *     "Texts in program memory"). TXT_x is the offset of the text in
+ *     ui_text[]; lcd_prtText(row, col, TXT_x) writes it.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Texts const __rom char (program memory only)
+ ******************************************************************************/
+
+#ifndef UI_TEXT_H
+#define	UI_TEXT_H
+
+#include "lcd.h"
+
+#define UI_TEXT(T) \
+    T(TXT_WELCOME,     "Seja Bem Vindo! ") \
+    T(TXT_VERSION,     "LCD Interface v0")
+
+enum { UI_TEXT(LCD_TEXT_ENUM) UI_TEXT_SIZE };
+extern const __rom char ui_text[UI_TEXT_SIZE];
+
+#endif	/* UI_TEXT_H */
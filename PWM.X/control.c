@@ -0,0 +1,161 @@
+/* ****************************************************************************
+ * Project: Basic control functions       File control.c          October/2026
+ * ****************************************************************************
+ * Description: ADC -> PID -> PWM closed loop. See control.h.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | control_getMeasure(), for the telemetry
+ ******************************************************************************/
+
+#include <xc.h>
+#include "control.h"
+#include "adc.h"
+#include "pwm.h"
+
+static pid_ctrl_t control_pid;
+static uint8_t control_pwm;              // PWM1 or PWM2.
+static volatile int16_t control_sp;      // Set point, Q15.
+static volatile int16_t control_out;     // Last output, Q15.
+static volatile uint16_t control_pv;     // Last measurement, ADC 0 - 1023.
+static volatile uint8_t control_busy;    // Conversion started, PID not run yet.
+
+volatile uint16_t control_overruns;
+
+/******************************************************************************
+ * Function: void control_ini(uint8_t adc_ch, uint8_t pwm_ch, uint8_t postscale)
+ * Description: Starts the loop: measurement on AN<adc_ch>, output on the PWM
+ * channel, one sample every "postscale" PWM periods. pwm_ini() and the PWM
+ * frequency must be set before. The set point starts at 0.
+ * Example: control_ini(0, PWM1, 10); // AN0, RC2, 20 kHz / 10 = 2 kHz.
+ * Input: A/D channel (0 - 12), PWM channel and periods per sample (1 - 16).
+ * Output: void
+ ******************************************************************************/
+void control_ini(uint8_t adc_ch, uint8_t pwm_ch, uint8_t postscale)
+{
+    adc_ini();
+    ADCON1 = (uint8_t)(0x0E - adc_ch); // AN0 to AN<adc_ch> analog. Pg 262.
+    if(adc_ch < 4) TRISA |= (uint8_t)(1 << adc_ch);
+    ADCON0bits.CHS = adc_ch;
+
+    control_pwm = pwm_ch;
+    control_sp = 0;
+    control_out = 0;
+    control_pv = 0;
+    control_busy = 0;
+    control_overruns = 0;
+    pid_ini(&control_pid, CONTROL_KP, CONTROL_KI, CONTROL_KD, CONTROL_ALPHA,
+            0, PID_Q15(1.0));
+
+    IPR1bits.ADIP = 1;
+    PIR1bits.ADIF = 0;
+    PIE1bits.ADIE = 1;
+    pwm_setTick(postscale);
+}
+// end of function void control_ini(...)
+
+/******************************************************************************
+ * Function: void control_setPoint(int16_t setpoint)
+ * Description: New set point, Q15 (ADC value << 5).
+ * Example: control_setPoint(512 << 5); // 2.5 V with 5 V reference.
+ ******************************************************************************/
+void control_setPoint(int16_t setpoint)
+{
+    PIE1bits.ADIE = 0; // 16-bit value read by the interrupt.
+    control_sp = setpoint;
+    PIE1bits.ADIE = 1;
+}
+// end of function void control_setPoint(int16_t setpoint)
+
+/******************************************************************************
+ * Function: void control_setGains(int16_t kp, int16_t ki, int16_t kd)
+ * Description: New gains (see pid.h), the output continues from where it is.
+ ******************************************************************************/
+void control_setGains(int16_t kp, int16_t ki, int16_t kd)
+{
+    PIE1bits.ADIE = 0;
+    control_pid.kp = kp;
+    control_pid.ki = ki;
+    control_pid.kd = kd;
+    PIE1bits.ADIE = 1;
+}
+// end of function void control_setGains(int16_t kp, int16_t ki, int16_t kd)
+
+/******************************************************************************
+ * Function: int16_t control_getOutput(void)
+ * Output: last PID output, Q15 (duty 0 - 32767).
+ ******************************************************************************/
+int16_t control_getOutput(void)
+{
+    int16_t out;
+
+    PIE1bits.ADIE = 0;
+    out = control_out;
+    PIE1bits.ADIE = 1;
+    return out;
+}
+// end of function int16_t control_getOutput(void)
+
+/******************************************************************************
+ * Function: uint16_t control_getMeasure(void)
+ * Output: last measurement of the loop, ADC 0 - 1023 (for the telemetry).
+ ******************************************************************************/
+uint16_t control_getMeasure(void)
+{
+    uint16_t pv;
+
+    PIE1bits.ADIE = 0;
+    pv = control_pv;
+    PIE1bits.ADIE = 1;
+    return pv;
+}
+// end of function uint16_t control_getMeasure(void)
+
+/******************************************************************************
+ * Function: void control_tick(void)
+ * Description: Starts the conversion of the sample. Call it in isr_high when
+ * pwm_isr() returns 1. The acquisition time is done by the A/D (ACQT).
+ ******************************************************************************/
+void control_tick(void)
+{
+    if(control_busy)
+    {
+        control_overruns++; // The rate is too high for the conversion + PID.
+        return;
+    }
+    control_busy = 1;
+    ADCON0bits.GO = 1;
+}
+// end of function void control_tick(void)
+
+/******************************************************************************
+ * Function: void control_isr(void)
+ * Description: A/D conversion done: one PID sample and the new duty. Call it
+ * in isr_high.
+ ******************************************************************************/
+void control_isr(void)
+{
+    int16_t pv;
+
+    if(PIE1bits.ADIE && PIR1bits.ADIF)
+    {
+        PIR1bits.ADIF = 0;
+        control_pv = ((uint16_t)ADRESH << 8) | ADRESL;
+        pv = (int16_t)(control_pv << 5); // 10 bits to Q15.
+        control_out = pid_run(&control_pid, control_sp, pv);
+        pwm_setDutyQ15(control_pwm, control_out);
+        control_busy = 0;
+    }
+}
+// end of function void control_isr(void)
@@ -0,0 +1,60 @@
+/* ****************************************************************************
+ * Project: Basic control functions       File control.h          October/2026
+ * ****************************************************************************
+ * Description: Closed loop ADC -> PID -> PWM, run by interrupts at a fixed
+ *   rate. The TIMER2 tick of pwm.c (pwm_setTick()) starts the conversion of
+ *   the measurement channel; the A/D interrupt runs the PID (pid.c) and hands
+ *   the new duty to pwm.c, which writes it at the next tick. So the sample
+ *   instant and the duty update are locked to the PWM periods:
+ *      rate = PWM frequency / postscale (e.g. 20 kHz / 10 = 2 kHz).
+ *   Both interrupts are high priority; in isr_high:
+ *      if(pwm_isr()) control_tick();
+ *      control_isr();
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | control_getMeasure(), for the telemetry
+ ******************************************************************************/
+
+#ifndef CONTROL_H
+#define	CONTROL_H
+
+#include <xc.h>
+#include "pid.h"
+
+// Default tuning, see pid.h. Changed at run time with control_setGains().
+#ifndef CONTROL_KP
+    #define CONTROL_KP      PID_GAIN(0.8)
+#endif
+#ifndef CONTROL_KI
+    #define CONTROL_KI      PID_GAIN(0.02)
+#endif
+#ifndef CONTROL_KD
+    #define CONTROL_KD      PID_GAIN(0.0)
+#endif
+#ifndef CONTROL_ALPHA
+    #define CONTROL_ALPHA   PID_Q15(0.25)
+#endif
+
+extern volatile uint16_t control_overruns; // Ticks lost: the previous sample was not done.
+
+void control_ini(uint8_t adc_ch, uint8_t pwm_ch, uint8_t postscale);
+void control_setPoint(int16_t setpoint);
+void control_setGains(int16_t kp, int16_t ki, int16_t kd);
+int16_t control_getOutput(void);
+uint16_t control_getMeasure(void);
+void control_tick(void);
+void control_isr(void);
+
+#endif	/* CONTROL_H */
@@ -1,7 +1,13 @@
 /* ****************************************************************************
  * Project: Basic control functions       File main.c                March/2022
  * ****************************************************************************
- * Description:  
+ * Description: Closed loop: PWM1 (RC2) -> RC filter -> AN0, regulated by the
+ *              PID of control.c at 2 kHz (20 kHz PWM, one sample every 10
+ *              periods). The set point steps between 1 V and 3 V every 2 s.
+ *              PWM2 (RC1) shows the set point as a duty cycle.
+ *              Every 100 ms the measurement (TLM_ADC) and PWM1 (TLM_PWM,
+ *              frequency and duty of the PID) go out on the telemetry of
+ *              telemetry.c (RC6, UART_BAUD of uart.h), low priority.
  * ****************************************************************************
  * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
  * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
@@ -24,18 +30,78 @@
  * Date      | Author            | Description
  * **********|*******************|*********************************************
  * 03/23/2022| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Oscillator set here; runtime PWM changes
+ * 10/19/2026| Antonio Castilho  | PWM2 in lockstep with PWM1
+ * 10/19/2026| Antonio Castilho  | ADC -> PID -> PWM closed loop
+ * 10/19/2026| Antonio Castilho  | Telemetry of the loop (measurement, PWM1) every 100 ms
  ******************************************************************************/
 
 #include <xc.h>
 #include "main.h"
+#include "control.h"
+#include "telemetry.h"
+
+#define SETPOINT_LOW    (205 << 5)  // 1 V, ADC 205 of 1023, Q15.
+#define SETPOINT_HIGH   (614 << 5)  // 3 V.
+#define REPORT_MS       100         // Telemetry period.
+
+/******************************************************************************
+ * Function: void __interrupt(high_priority) isr_high(void)
+ * Description: TIMER2 tick (PWM values, start of the A/D conversion) and A/D
+ *              conversion done (PID sample).
+ ******************************************************************************/
+void __interrupt(high_priority) isr_high(void)
+{
+    if(pwm_isr()) control_tick();
+    control_isr();
+}
+
+/******************************************************************************
+ * Function: void __interrupt(low_priority) isr_low(void)
+ * Description: EUSART transmitter of the telemetry.
+ ******************************************************************************/
+void __interrupt(low_priority) isr_low(void)
+{
+    uart_isr();
+}
+
+/******************************************************************************
+ * Function: static void report(uint16_t ms)
+ * Description: Waits ms, sending the measurement and PWM1 every REPORT_MS.
+ *              A record without room in the buffer is lost, never waited for.
+ ******************************************************************************/
+static void report(uint16_t ms)
+{
+    for(; ms >= REPORT_MS; ms -= REPORT_MS)
+    {
+        telemetry_adc(0, control_getMeasure());
+        telemetry_pwm(PWM1, pwm_getFrequency(),
+                      (uint16_t)(((int32_t)control_getOutput() * 1000) >> 15)); // 0.1 %.
+        __delay_ms(REPORT_MS);
+    }
+}
 
 void main(void) 
 {
+    // Oscillator frequency setting, must agree with _XTAL_FREQ.
+    // OSCCON Oscillator control register Pg 34.
+    OSCCON = 0x72; // IDLEN = 0, IRCF = 111 (8 MHz), SCS = 10 (internal oscillator).
+
     pwm1_ini();
-    __delay_ms(1000);
+    pwm_setFrequency(20000);
+    control_ini(0, PWM1, 10); // AN0, PWM1, 2 kHz.
+    telemetry_ini();     // EUSART on RC6.
+    RCONbits.IPEN = 1;   // Interrupt priority levels.
+    INTCONbits.GIEH = 1;
+    INTCONbits.GIEL = 1; // Telemetry.
     
     while(1)
     {
-
+        control_setPoint(SETPOINT_LOW);
+        pwm_setDuty(PWM2, 200);   // 20,0 % = 1 V of 5 V.
+        report(2000);
+        control_setPoint(SETPOINT_HIGH);
+        pwm_setDuty(PWM2, 600);
+        report(2000);
     }
 }
@@ -0,0 +1,23 @@
+/* ****************************************************************************
+ * Project: Basic control functions       File pid.h              October/2026
+ * ****************************************************************************
+ * Description: PID controller of this project: the shared one, common/pid.h.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ ******************************************************************************/
+
+#ifndef PID_PROJECT_H
+#define	PID_PROJECT_H
+
+#include "../common/pid.h"
+
+#endif	/* PID_PROJECT_H */
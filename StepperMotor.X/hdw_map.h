@@ -8,6 +8,7 @@
  * _______________________________________________________________________________________
  * Date:          | Author:               | Description:                                                             | Version:
  * 04/26/2022 | Antonio Castilho  | Created                                                                    | 00.00.01
+ * 10/19/2026 | Antonio Castilho  | LCD_D7 is RD7 (was RD4); the driver uses LCD_PIN_x of lcd.h            | 00.00.02
  *________________________________________________________________________________________
  */
 
@@ -58,7 +59,7 @@
 #define LCD_D4          PORTDbits.RD4
 #define LCD_D5          PORTDbits.RD5
 #define LCD_D6          PORTDbits.RD6
-#define LCD_D7          PORTDbits.RD4
+#define LCD_D7          PORTDbits.RD7
          
 
 #endif	/* HDW_MAP_H */
@@ -0,0 +1,755 @@
+/* ****************************************************************************
+ * Project: Control Functions             File stepper.c                 October/2026
+ * ****************************************************************************
+ * File description: Stepper motor driver, table driven and timed by CCP1
+ *     compare. See stepper.h.
+ *     The interrupt runs one step ahead: at each match it loads CCPR1 with the
+ *     interval already planned (next_gap), moves the coils and then plans the
+ *     following step (stepper_plan()), so the computing time is hidden inside
+ *     the interval. The main loop only queues targets (queue_head) and the
+ *     interrupt takes them (queue_tail); the other shared values are written
+ *     with the interrupt masked.
+ *     phase_index is the electrical angle in 1/128 of a turn of the field
+ *     (1/32 of a full step): the table modes use phase[phase_index >> 4], the
+ *     microstep modes the sine of it.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * * Atmel AVR446: Linear speed control of stepper motor, 2006.
+ * * Eiderman, A. Real-time stepper motor linear ramping just by addition and
+ *   multiplication, 2004.
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Acceleration ramps and queued moves
+ * 10/19/2026| Antonio Castilho  | PWM microstepping, 1/4 to 1/32 step
+ * 10/19/2026| Antonio Castilho  | stepper_setPosition()
+ ******************************************************************************/
+
+#include <xc.h>
+#include <math.h>
+#include "stepper.h"
+#include "pwm.h"
+
+#define COIL_MASK       0xF0 // LATB<7:4>: 1A, 1B, 2A, 2B.
+#define STEP_BUSY       (PIE1bits.CCP1IE || PIE1bits.TMR1IE)
+#define QUEUE_MASK      (STEPPER_QUEUE - 1)
+
+// Half step sequence, forward: 1A, 1A+2A, 2A, 2A+1B, 1B, 1B+2B, 2B, 2B+1A.
+static const uint8_t phase[8] =
+{
+    0x80, 0xA0, 0x20, 0x60, 0x40, 0x50, 0x10, 0x90
+};
+
+// sin(k * 90 / 32 degrees) in Q15, k = 0 to 32: a quarter of the field turn.
+static const int16_t sine_table[33] =
+{
+    0, 1608, 3212, 4808, 6393, 7962, 9512, 11039,
+    12539, 14010, 15446, 16846, 18204, 19519, 20787, 22005,
+    23170, 24279, 25329, 26319, 27245, 28105, 28898, 29621,
+    30273, 30852, 31356, 31785, 32137, 32412, 32609, 32728,
+    32767
+};
+
+// By mode: phase_index change per step and log2 of the steps per full step.
+static const uint8_t mode_stride[7] = { 32, 32, 16, 8, 4, 2, 1 };
+static const uint8_t mode_shift[7] = { 0, 0, 1, 2, 3, 4, 5 };
+
+// 1 / sqrt(n) in Q16, n = 1 to STEPPER_RAMP_TABLE.
+static const uint16_t ramp_table[STEPPER_RAMP_TABLE] =
+{
+    65535, 46341, 37837, 32768, 29309, 26755, 24770, 23170,
+    21845, 20724, 19760, 18919, 18176, 17515, 16921, 16384
+};
+
+static volatile uint8_t phase_index;    // Electrical angle on the coils, 0 to 127.
+static uint8_t phase_stride;            // mode_stride[step_mode].
+static uint8_t step_mode;
+static uint8_t step_micro;              // Microstep mode: TIMER1 overflow times the steps.
+static volatile int32_t step_position;
+static int8_t step_dir;                 // Step at the next match: -1, 1 or 0 (none).
+static uint16_t next_gap;               // Planned step after that one.
+static int8_t next_dir;
+
+// Speed and ramp, written by the main loop.
+static uint16_t speed_ticks;            // Interval at the top speed.
+static uint16_t ramp_accel;             // Steps/s^2, 0 without ramp.
+static uint16_t ramp_p1;                // Interval of the first step, F / sqrt(2 a).
+static uint16_t ramp_mant;              // a / F^2 = ramp_mant / 2^ramp_shift.
+static uint8_t ramp_shift;
+static uint32_t ramp_steps;             // Steps to reach the top speed, v^2 / (2 a).
+
+// Planner, one step ahead of the coils (interrupt, or main with it stopped).
+static int32_t plan_position;           // Position after the planned steps.
+static volatile int8_t plan_run;        // -1 or 1 runs without target.
+static int8_t move_dir;
+static uint32_t move_steps;
+static uint32_t move_k;                 // Steps planned in this move.
+static uint32_t move_ramp;              // Steps of acceleration (and of deceleration).
+static uint32_t ramp_p;                 // Interval in Q16.16.
+
+static int32_t queue[STEPPER_QUEUE];
+static volatile uint8_t queue_head;     // Written by the main loop.
+static volatile uint8_t queue_tail;     // Written by the planner.
+static int32_t queue_last;              // Last queued target, base of stepper_move().
+
+/******************************************************************************
+ * Function: static void stepper_setCompare(uint16_t count)
+ * Description: Sets the time of the next step, just after a step (TMR1 near 0).
+ * With CCP1 compare, writes CCPR1; CCPR1H is made 0xFF first, so the half
+ * written value never matches TMR1.
+ * In the microstep modes CCP1 is a PWM: TMR1 is moved back by count, keeping
+ * the counts since the overflow, so the interrupt latency is not added (the
+ * write clears the prescaler: up to 7 Tcy, less than one count, are lost).
+ * Input: TIMER1 counts until the next step.
+ * Output: void
+ ******************************************************************************/
+static void stepper_setCompare(uint16_t count)
+{
+    uint16_t timer;
+
+    if(step_micro)
+    {
+        timer = TMR1L;                 // RD16: TMR1L read latches TMR1H. Pg 127.
+        timer |= (uint16_t)TMR1H << 8;
+        timer -= count;
+        TMR1H = (uint8_t)(timer >> 8); // Written with TMR1L.
+        TMR1L = (uint8_t)timer;
+        return;
+    }
+    CCPR1H = 0xFF;
+    CCPR1L = (uint8_t)count;
+    CCPR1H = (uint8_t)(count >> 8);
+}
+// end of function static void stepper_setCompare(uint16_t count)
+
+/******************************************************************************
+ * Function: static void stepper_output(void)
+ * Description: Puts phase_index on the coils, with one LATB write.
+ * Table modes: phase[] entry, the coils fully on.
+ * Microstep modes: coil 1 current cos(angle) on PWM1, coil 2 sin(angle) on
+ * PWM2, the sign in the direction pins (1A/1B, 2A/2B). The duties are latched
+ * at the next PWM period; at a change of sign the duty is near 0.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+static void stepper_output(void)
+{
+    uint8_t k;
+    int16_t sine;
+    int16_t cosine;
+    uint8_t pins = 0;
+
+    if(!step_micro)
+    {
+        LATB = (uint8_t)((LATB & ~COIL_MASK) | phase[phase_index >> 4]);
+        return;
+    }
+
+    k = phase_index & 31;
+    sine = (phase_index & 32) ? sine_table[32 - k] : sine_table[k];
+    cosine = (phase_index & 32) ? sine_table[k] : sine_table[32 - k];
+    if(phase_index & 64) sine = (int16_t)-sine;                 // 180 to 360 degrees.
+    if((uint8_t)(phase_index + 32) & 64) cosine = (int16_t)-cosine; // 90 to 270 degrees.
+
+    if(cosine > 0) pins |= 0x80;      // COIL_1A.
+    else if(cosine < 0) pins |= 0x40; // COIL_1B.
+    if(sine > 0) pins |= 0x20;        // COIL_2A.
+    else if(sine < 0) pins |= 0x10;   // COIL_2B.
+
+    pwm_setDutyQ15(PWM1, (cosine < 0) ? (int16_t)-cosine : cosine);
+    pwm_setDutyQ15(PWM2, (sine < 0) ? (int16_t)-sine : sine);
+    LATB = (uint8_t)((LATB & ~COIL_MASK) | pins);
+}
+// end of function static void stepper_output(void)
+
+/******************************************************************************
+ * Function: static uint32_t stepper_mulQ16(uint32_t a, uint16_t b)
+ * Description: (a * b) >> 16 without a 48-bit product.
+ * Input: a and b.
+ * Output: (a * b) >> 16, truncated.
+ ******************************************************************************/
+static uint32_t stepper_mulQ16(uint32_t a, uint16_t b)
+{
+    return (a >> 16) * b + (((a & 0xFFFF) * b) >> 16);
+}
+// end of function static uint32_t stepper_mulQ16(uint32_t a, uint16_t b)
+
+/******************************************************************************
+ * Function: static void stepper_rampStep(uint32_t s)
+ * Description: One Newton iteration of p = 1 / sqrt(2 m s) (m = a / F^2) from
+ * the interval of the step before: p' = p * (1.5 - m s p^2). Only products, and
+ * as s is exact the rounding errors do not add up along the ramp (the plain
+ * recurrence p' = p (1 -/+ r + 1.5 r^2) drifts by tens of steps in long ramps).
+ * The products are kept with 16 significant bits.
+ * Input: step of the ramp (s > STEPPER_RAMP_TABLE).
+ * Output: void (ramp_p)
+ ******************************************************************************/
+static void stepper_rampStep(uint32_t s)
+{
+    uint32_t x = ramp_p >> 8; // p in Q8.
+    uint8_t e = ramp_shift;   // m s p^2 = h / 2^e.
+    uint32_t h;
+
+    while(x > 0xFFFF) // p in Q(8 - n): p^2 in Q(16 - 2n).
+    {
+        x >>= 1;
+        e -= 2;
+    }
+    h = stepper_mulQ16(x * x, ramp_mant); // m p^2 = h / 2^e.
+    while(h > 0xFFFF)
+    {
+        h >>= 1;
+        e--;
+    }
+    while(s > 0xFFFF)
+    {
+        s >>= 1;
+        e--;
+    }
+    h *= s;
+
+    // To Q24, 0.5 (0x800000) on the exact curve.
+    if(e >= 56) h = 0;
+    else if(e >= 24) h >>= (uint8_t)(e - 24);
+    else h = (h < (0xC00000UL >> (uint8_t)(24 - e))) ? h << (uint8_t)(24 - e) : 0xC00000;
+    if(h > 0xC00000) h = 0xC00000;
+
+    if(h < 0x800000) // p' = p + p * (0.5 - m s p^2).
+    {
+        h = 0x800000 - h;
+        ramp_p += stepper_mulQ16(ramp_p, (uint16_t)(h >> 8)) + (((ramp_p >> 8) * (h & 0xFF)) >> 16);
+    }
+    else
+    {
+        h = h - 0x800000;
+        ramp_p -= stepper_mulQ16(ramp_p, (uint16_t)(h >> 8)) + (((ramp_p >> 8) * (h & 0xFF)) >> 16);
+    }
+}
+// end of function static void stepper_rampStep(uint32_t s)
+
+/******************************************************************************
+ * Function: static uint16_t stepper_ramp(void)
+ * Description: Interval of step move_k of the move: acceleration for the first
+ * move_ramp steps, deceleration for the last move_ramp, cruise between them.
+ * In both ramps the step s (from the end, decelerating) has p = p1 / sqrt(s).
+ * Input: void
+ * Output: TIMER1 counts before the step.
+ ******************************************************************************/
+static uint16_t stepper_ramp(void)
+{
+    uint32_t top = (uint32_t)speed_ticks << 16;
+    uint32_t s;
+    uint16_t gap;
+
+    if(!ramp_accel) return speed_ticks;
+
+    if(move_k <= move_ramp) s = move_k;                                // Acceleration.
+    else if(move_k > move_steps - move_ramp) s = move_steps - move_k + 1; // Deceleration.
+    else s = 0;                                                          // Cruise.
+
+    if(s > STEPPER_RAMP_TABLE) stepper_rampStep(s);
+    else if(s) ramp_p = (uint32_t)ramp_p1 * ramp_table[s - 1];
+    else if(move_ramp == ramp_steps) ramp_p = top; // Top speed reached.
+    if(ramp_p < top) ramp_p = top;
+
+    gap = (uint16_t)(ramp_p >> 16);
+    if((ramp_p & 0x8000) && gap != 0xFFFF) gap++; // Rounded.
+    return gap;
+}
+// end of function static uint16_t stepper_ramp(void)
+
+/******************************************************************************
+ * Function: static int8_t stepper_plan(void)
+ * Description: Plans the step after step_dir: next_gap and next_dir. Takes the
+ * next target of the queue when the move ends.
+ * Input: void
+ * Output: next_dir, 0 if there is nothing else to do.
+ ******************************************************************************/
+static int8_t stepper_plan(void)
+{
+    int32_t distance;
+
+    next_dir = 0;
+    while(!next_dir)
+    {
+        if(plan_run)
+        {
+            next_gap = speed_ticks;
+            next_dir = plan_run;
+        }
+        else if(move_k < move_steps)
+        {
+            move_k++;
+            next_gap = stepper_ramp();
+            next_dir = move_dir;
+        }
+        else if(queue_tail != queue_head)
+        {
+            distance = queue[queue_tail] - plan_position;
+            queue_tail = (uint8_t)((queue_tail + 1) & QUEUE_MASK);
+            move_dir = (int8_t)((distance < 0) ? -1 : 1);
+            move_steps = (uint32_t)((distance < 0) ? -distance : distance);
+            move_k = 0;
+            move_ramp = (ramp_steps < move_steps / 2) ? ramp_steps : move_steps / 2;
+            ramp_p = (uint32_t)ramp_p1 << 16; // From rest (kept at the top speed if lower).
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    plan_position += next_dir;
+    return next_dir;
+}
+// end of function static int8_t stepper_plan(void)
+
+/******************************************************************************
+ * Function: static void stepper_start(void)
+ * Description: Starts the step interrupt if it is stopped and there is a step
+ * to do; the first step comes one interval later. Running, plans a step if the
+ * one at the next match was the last. Call it with the interrupts masked.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+static void stepper_start(void)
+{
+    if(STEP_BUSY)
+    {
+        if(!next_dir) stepper_plan();
+        return;
+    }
+    if(!stepper_plan()) return;
+
+    step_dir = next_dir;
+    TMR1H = 0; // RD16: TMR1H is written with TMR1L. Pg 127.
+    TMR1L = 0;
+    stepper_setCompare(next_gap);
+    stepper_plan();
+    if(step_micro)
+    {
+        PIR1bits.TMR1IF = 0;
+        PIE1bits.TMR1IE = 1;
+    }
+    else
+    {
+        PIR1bits.CCP1IF = 0;
+        PIE1bits.CCP1IE = 1;
+    }
+}
+// end of function static void stepper_start(void)
+
+/******************************************************************************
+ * Function: static uint8_t stepper_queue(int32_t position)
+ * Description: Puts an absolute target in the queue and starts the motor.
+ * Input: position in steps.
+ * Output: 1 if queued, 0 if the queue is full.
+ ******************************************************************************/
+static uint8_t stepper_queue(int32_t position)
+{
+    uint8_t head = (uint8_t)((queue_head + 1) & QUEUE_MASK);
+    uint8_t gieh;
+
+    if(head == queue_tail) return 0;
+    queue[queue_head] = position;
+    queue_last = position;
+
+    gieh = INTCONbits.GIEH;
+    INTCONbits.GIEH = 0;
+    queue_head = head;
+    plan_run = 0;
+    stepper_start();
+    INTCONbits.GIEH = gieh;
+    return 1;
+}
+// end of function static uint8_t stepper_queue(int32_t position)
+
+/******************************************************************************
+ * Function: static void stepper_rampSteps(void)
+ * Description: Steps to reach the top speed, v^2 / (2 a).
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+static void stepper_rampSteps(void)
+{
+    uint32_t speed = STEPPER_TICK_HZ / speed_ticks;
+    uint32_t steps = 0;
+    uint8_t gieh;
+
+    if(ramp_accel) steps = speed * speed / (2 * (uint32_t)ramp_accel);
+    gieh = INTCONbits.GIEH;
+    INTCONbits.GIEH = 0; // Read by the planner at the start of each move.
+    ramp_steps = steps;
+    INTCONbits.GIEH = gieh;
+}
+// end of function static void stepper_rampSteps(void)
+
+/******************************************************************************
+ * Function: void stepper_ini(void)
+ * Description: Coils on LATB<7:4> as outputs and off, TIMER1 with prescale 1:8
+ * and CCP1 in compare mode with special event trigger (TIMER1 reset at each
+ * match). STEPPER_WAVE at STEPPER_SPEED_MIN without ramp, position 0.
+ * The CCP1 interrupt is high priority: the program must call stepper_isr() in
+ * isr_high and enable the interrupts (IPEN, GIEH).
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void stepper_ini(void)
+{
+    TRISB &= (uint8_t)~COIL_MASK;
+    LATB &= (uint8_t)~COIL_MASK;
+
+    PIE1bits.CCP1IE = 0;
+    PIE1bits.TMR1IE = 0;
+    IPR1bits.TMR1IP = 1;
+    T1CON = 0xB0;  // 0b10110000 RD16 = 1, prescale 1:8, internal clock, off. Pg 127.
+    T3CONbits.T3CCP2 = 0; // TIMER1 is the time base of CCP1 and CCP2. Pg 135.
+    T3CONbits.T3CCP1 = 0;
+    CCP1CON = 0x0B; // Compare mode, special event trigger: TMR1 reset. Pg 141.
+    IPR1bits.CCP1IP = 1;
+
+    phase_index = 0;
+    phase_stride = mode_stride[STEPPER_WAVE];
+    step_mode = STEPPER_WAVE;
+    step_micro = 0;
+    step_position = 0;
+    step_dir = 0;
+    next_dir = 0;
+    plan_position = 0;
+    plan_run = 0;
+    move_steps = 0;
+    move_k = 0;
+    queue_head = 0;
+    queue_tail = 0;
+    queue_last = 0;
+    ramp_accel = 0;
+    stepper_setSpeed(STEPPER_SPEED_MIN);
+
+    T1CONbits.TMR1ON = 1;
+}
+// end of function void stepper_ini(void)
+
+/******************************************************************************
+ * Function: uint8_t stepper_setMode(uint8_t mode)
+ * Description: Changes the step mode, only with the motor stopped. The position
+ * is converted to the steps of the new mode and the coils go to the nearest
+ * angle of that mode (the rotor may move up to half a step).
+ * The microstep modes turn CCP1 and CCP2 into PWM outputs (pwm.c, pwm_isr()
+ * must be called in isr_high) and time the steps with the TIMER1 overflow;
+ * the other modes give CCP1 back to the compare and turn CCP2 off.
+ * Speed and acceleration are not converted.
+ * Input: STEPPER_WAVE to STEPPER_MICRO32.
+ * Output: 1 if changed, 0 if the motor is running or the mode is unknown.
+ ******************************************************************************/
+uint8_t stepper_setMode(uint8_t mode)
+{
+    uint8_t offset = (mode == STEPPER_FULL) ? 16 : 0; // FULL: two coils, 45 degrees.
+    uint8_t micro = (mode >= STEPPER_MICRO4);
+    uint8_t on = (LATB & COIL_MASK) ? 1 : 0;
+
+    if(STEP_BUSY || mode > STEPPER_MICRO32) return 0;
+
+    if(mode_shift[mode] > mode_shift[step_mode])
+    {
+        step_position *= (int32_t)1 << (mode_shift[mode] - mode_shift[step_mode]);
+    }
+    else
+    {
+        step_position /= (int32_t)1 << (mode_shift[step_mode] - mode_shift[mode]);
+    }
+
+    if(micro && !step_micro)
+    {
+        pwm_ini();
+        pwm_setFrequency(STEPPER_PWM_FREQUENCY);
+        pwm_setDuties(0, 0);
+    }
+    else if(!micro && step_micro)
+    {
+        PIE1bits.TMR2IE = 0;
+        CCP2CON = 0x00; // Off, RC1 back to LATC1. Pg 141.
+        CCP1CON = 0x0B; // Compare mode, special event trigger: TMR1 reset.
+        LATCbits.LATC1 = 0;
+        LATCbits.LATC2 = 0;
+    }
+    step_micro = micro;
+
+    phase_stride = mode_stride[mode];
+    phase_index = (uint8_t)((((uint8_t)(phase_index - offset + phase_stride / 2)
+                  & (uint8_t)~(phase_stride - 1)) + offset) & 127); // Nearest angle.
+    if(on) stepper_output();
+
+    plan_position = step_position;
+    queue_last = step_position;
+    move_steps = 0;
+    move_k = 0;
+    step_mode = mode;
+    return 1;
+}
+// end of function uint8_t stepper_setMode(uint8_t mode)
+
+/******************************************************************************
+ * Function: void stepper_setSpeed(uint16_t speed)
+ * Description: Top speed, limited to STEPPER_SPEED_MIN..STEPPER_SPEED_MAX.
+ * Running, stepper_run() changes speed at the next step; the ramp of a move
+ * uses the new speed from the next move on.
+ * Input: steps per second, in the steps of the mode in use.
+ * Output: void
+ ******************************************************************************/
+void stepper_setSpeed(uint16_t speed)
+{
+    uint16_t ticks;
+    uint8_t gieh;
+
+    if(speed < STEPPER_SPEED_MIN) speed = STEPPER_SPEED_MIN;
+    if(speed > STEPPER_SPEED_MAX) speed = STEPPER_SPEED_MAX;
+    ticks = (uint16_t)(STEPPER_TICK_HZ / speed);
+
+    gieh = INTCONbits.GIEH;
+    INTCONbits.GIEH = 0; // Two bytes read by the interrupt.
+    speed_ticks = ticks;
+    INTCONbits.GIEH = gieh;
+    stepper_rampSteps();
+}
+// end of function void stepper_setSpeed(uint16_t speed)
+
+/******************************************************************************
+ * Function: uint8_t stepper_setAccel(uint16_t accel)
+ * Description: Acceleration and deceleration of the moves, only with the motor
+ * stopped. Computes (once, in floating point) the first interval p1 and a / F^2
+ * for the ramp; the interrupt only multiplies.
+ * Input: steps/s^2, up to STEPPER_ACCEL_MAX; 0 for moves at constant speed.
+ * Output: 1 if changed, 0 if the motor is running.
+ ******************************************************************************/
+uint8_t stepper_setAccel(uint16_t accel)
+{
+    float p1;
+    float m;
+
+    if(STEP_BUSY) return 0;
+    if(accel > STEPPER_ACCEL_MAX) accel = STEPPER_ACCEL_MAX;
+
+    ramp_accel = accel;
+    if(accel)
+    {
+        p1 = (float)STEPPER_TICK_HZ / (float)sqrt(2.0 * accel);
+        ramp_p1 = (p1 < 65535.0f) ? (uint16_t)p1 : 0xFFFF;
+
+        // a / F^2 = ramp_mant / 2^ramp_shift, ramp_mant with 16 bits.
+        m = (float)accel / ((float)STEPPER_TICK_HZ * (float)STEPPER_TICK_HZ) * 4294967296.0f;
+        ramp_shift = 32;
+        while(m < 32768.0f)
+        {
+            m *= 2.0f;
+            ramp_shift++;
+        }
+        ramp_mant = (uint16_t)m;
+    }
+    stepper_rampSteps();
+    return 1;
+}
+// end of function uint8_t stepper_setAccel(uint16_t accel)
+
+/******************************************************************************
+ * Function: uint8_t stepper_moveTo(int32_t position)
+ * Description: Queues a move to an absolute position, without waiting. It
+ * starts when the moves before it end (stepper_run() is cancelled).
+ * Input: position in steps.
+ * Output: 1 if queued, 0 if the queue is full.
+ ******************************************************************************/
+uint8_t stepper_moveTo(int32_t position)
+{
+    return stepper_queue(position);
+}
+// end of function uint8_t stepper_moveTo(int32_t position)
+
+/******************************************************************************
+ * Function: uint8_t stepper_move(int32_t steps)
+ * Description: Queues a move relative to the last queued target (or to the
+ * position reached by stepper_run()), without waiting.
+ * Input: steps, negative for backward.
+ * Output: 1 if queued, 0 if the queue is full.
+ ******************************************************************************/
+uint8_t stepper_move(int32_t steps)
+{
+    uint8_t gieh;
+
+    if(plan_run)
+    {
+        gieh = INTCONbits.GIEH;
+        INTCONbits.GIEH = 0;
+        queue_last = plan_position;
+        INTCONbits.GIEH = gieh;
+    }
+    return stepper_queue(queue_last + steps);
+}
+// end of function uint8_t stepper_move(int32_t steps)
+
+/******************************************************************************
+ * Function: void stepper_run(int8_t direction)
+ * Description: Runs at the top speed, without target and without ramp, until
+ * stepper_stop() or a new move.
+ * Input: 1 forward, -1 backward.
+ * Output: void
+ ******************************************************************************/
+void stepper_run(int8_t direction)
+{
+    uint8_t gieh = INTCONbits.GIEH;
+
+    INTCONbits.GIEH = 0;
+    plan_run = (int8_t)((direction < 0) ? -1 : 1);
+    stepper_start();
+    INTCONbits.GIEH = gieh;
+}
+// end of function void stepper_run(int8_t direction)
+
+/******************************************************************************
+ * Function: void stepper_stop(void)
+ * Description: Stops after the step in progress, without ramp, and empties the
+ * queue. The coils stay on (holding).
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void stepper_stop(void)
+{
+    PIE1bits.CCP1IE = 0; // From here on the interrupt does not touch the values.
+    PIE1bits.TMR1IE = 0;
+    plan_run = 0;
+    step_dir = 0;
+    next_dir = 0;
+    move_steps = 0;
+    move_k = 0;
+    queue_tail = queue_head;
+    plan_position = step_position;
+    queue_last = step_position;
+}
+// end of function void stepper_stop(void)
+
+/******************************************************************************
+ * Function: void stepper_release(void)
+ * Description: Turns the coils off (no holding torque), only with the motor
+ * stopped. The next step turns them on again from the same entry.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void stepper_release(void)
+{
+    if(STEP_BUSY) return;
+    LATB &= (uint8_t)~COIL_MASK;
+    if(step_micro) pwm_setDuties(0, 0);
+}
+// end of function void stepper_release(void)
+
+/******************************************************************************
+ * Function: int32_t stepper_getPosition(void)
+ * Description: Current position, in the steps of the mode in use.
+ * Input: void
+ * Output: position.
+ ******************************************************************************/
+int32_t stepper_getPosition(void)
+{
+    int32_t position;
+    uint8_t gieh = INTCONbits.GIEH;
+
+    INTCONbits.GIEH = 0;
+    position = step_position;
+    INTCONbits.GIEH = gieh;
+    return position;
+}
+// end of function int32_t stepper_getPosition(void)
+
+/******************************************************************************
+ * Function: uint8_t stepper_setPosition(int32_t position)
+ * Description: Sets the position, only with the motor stopped: the counter
+ * and the coils, which go to the angle of that position counted from
+ * stepper_ini() (the rotor moves to it when they are on). Used to give back
+ * a position saved before a power cycle, in the mode it was saved.
+ * Input: position in steps of the mode in use.
+ * Output: 1 set, 0 the motor is running.
+ ******************************************************************************/
+uint8_t stepper_setPosition(int32_t position)
+{
+    uint8_t offset = (step_mode == STEPPER_FULL) ? 16 : 0;
+
+    if(STEP_BUSY) return 0;
+    step_position = position;
+    plan_position = position;
+    queue_last = position;
+    phase_index = (uint8_t)((offset + (uint8_t)position * phase_stride) & 127);
+    if(LATB & COIL_MASK) stepper_output();
+    return 1;
+}
+// end of function uint8_t stepper_setPosition(int32_t position)
+
+/******************************************************************************
+ * Function: uint8_t stepper_isBusy(void)
+ * Description: Tells if the motor is moving (or has moves queued).
+ * Input: void
+ * Output: 1 moving, 0 stopped.
+ ******************************************************************************/
+uint8_t stepper_isBusy(void)
+{
+    return STEP_BUSY;
+}
+// end of function uint8_t stepper_isBusy(void)
+
+/******************************************************************************
+ * Function: uint8_t stepper_getMicrosteps(void)
+ * Description: Steps of the mode in use in one full step, to scale positions,
+ * speeds and accelerations given in full steps.
+ * Input: void
+ * Output: 1 (WAVE, FULL), 2 (HALF), 4 to 32 (MICRO4 to MICRO32).
+ ******************************************************************************/
+uint8_t stepper_getMicrosteps(void)
+{
+    return (uint8_t)(1 << mode_shift[step_mode]);
+}
+// end of function uint8_t stepper_getMicrosteps(void)
+
+/******************************************************************************
+ * Function: void stepper_isr(void)
+ * Description: One step at each CCP1 match (TIMER1 overflow in the microstep
+ * modes): the planned interval is loaded, the coils go to the next angle and
+ * the step after is planned. Stops the interrupt after the last step. Call it in the
+ * high priority interrupt.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void stepper_isr(void)
+{
+    if(PIE1bits.CCP1IE && PIR1bits.CCP1IF) PIR1bits.CCP1IF = 0;
+    else if(PIE1bits.TMR1IE && PIR1bits.TMR1IF) PIR1bits.TMR1IF = 0;
+    else return;
+    if(next_dir) stepper_setCompare(next_gap); // TMR1 was reset by the match (or overflowed).
+
+    if(step_dir > 0)
+    {
+        phase_index = (uint8_t)((phase_index + phase_stride) & 127);
+        step_position++;
+    }
+    else
+    {
+        phase_index = (uint8_t)((phase_index - phase_stride) & 127);
+        step_position--;
+    }
+    stepper_output();
+
+    step_dir = next_dir;
+    if(step_dir)
+    {
+        stepper_plan();
+    }
+    else
+    {
+        PIE1bits.CCP1IE = 0;
+        PIE1bits.TMR1IE = 0;
+    }
+}
+// end of function void stepper_isr(void)
@@ -0,0 +1,112 @@
+/* ****************************************************************************
+ * Project: Control Functions             File stepper.h                 October/2026
+ * ****************************************************************************
+ * File description: Stepper motor driver, table driven and timed by interrupt.
+ *     The coil pattern of each step comes from a phase table and is written to
+ *     the coils (LATB<7:4>, see stepper_motor.h) in one port write.
+ *     The step rate comes from CCP1 in compare mode with special event trigger:
+ *     TIMER1 is reset by the hardware at each match (CCPR1), so the interval
+ *     between steps does not depend on the interrupt latency.
+ *     The main loop only sets targets, speed and mode; nothing blocks.
+ *
+ *     Phase table (half step), coil on = 1:
+ *          index   0    1    2    3    4    5    6    7
+ *          1A      1    1    0    0    0    0    0    1
+ *          2A      0    1    1    1    0    0    0    0
+ *          1B      0    0    0    1    1    1    0    0
+ *          2B      0    0    0    0    0    1    1    1
+ *     STEPPER_WAVE uses the even entries (one coil), STEPPER_FULL the odd
+ *     entries (two coils, more torque) and STEPPER_HALF all of them.
+ *
+ *     Microstep modes (STEPPER_MICRO4 to STEPPER_MICRO32, 1/4 to 1/32 of a full
+ *     step): the current of coil 1 follows cos() and of coil 2 sin() of the
+ *     field angle, from a quarter wave table. The amplitude is the duty of PWM1
+ *     (CCP1, RC2) and PWM2 (CCP2, RC1) of pwm.c, the sign selects the half of
+ *     the coil in LATB<7:4>, so the coils need a driver with enable and
+ *     direction inputs (L298 style):
+ *          ENA <- RC2 (PWM1)   IN1 <- RB7 (COIL_1A)   IN2 <- RB6 (COIL_1B)
+ *          ENB <- RC1 (PWM2)   IN3 <- RB5 (COIL_2A)   IN4 <- RB4 (COIL_2B)
+ *     CCP1 is then busy, so the steps are timed by the TIMER1 overflow, with
+ *     the counts since the overflow kept at each reload. The duties are
+ *     updated by the step interrupt; each microstep is one interrupt, so
+ *     STEPPER_SPEED_MAX (microsteps/s) limits the speed in full steps.
+ *     The position is counted in steps of the mode in use.
+ *
+ *     Moves (stepper_moveTo(), stepper_move()) are queued and run one after the
+ *     other, each from rest to rest, with a trapezoidal speed profile:
+ *     acceleration up to the speed of stepper_setSpeed(), cruise, deceleration.
+ *     The interval p of each step (TIMER1 counts) is computed in the interrupt,
+ *     one step ahead, without division or square root. Step s of a ramp (from
+ *     the end, decelerating) has v^2 = 2 a s, a constant acceleration a
+ *     (steps/s^2), that is p(s) = p1 / sqrt(s) with p1 = F / sqrt(2 a) and
+ *     F = STEPPER_TICK_HZ:
+ *         s up to STEPPER_RAMP_TABLE   p1 times a 1/sqrt(s) table;
+ *         then                          p' = p * (1.5 - s p^2 a / F^2),
+ *     one Newton iteration of 1/sqrt() from the interval of the step before
+ *     (as in Eiderman, only products; as s is exact the error does not grow
+ *     along the ramp).
+ *     stepper_setAccel(0) gives moves at constant speed.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Acceleration ramps and queued moves
+ * 10/19/2026| Antonio Castilho  | PWM microstepping, 1/4 to 1/32 step
+ * 10/19/2026| Antonio Castilho  | stepper_setPosition(), position kept in EEPROM
+ ******************************************************************************/
+
+#ifndef STEPPER_H
+#define	STEPPER_H
+
+#include <xc.h>
+#include "hdw_map.h"
+#include "stepper_motor.h"
+
+// Step modes.
+#define STEPPER_WAVE        0   // One coil at a time.
+#define STEPPER_FULL        1   // Two coils at a time.
+#define STEPPER_HALF        2   // One and two coils alternated, twice the steps.
+#define STEPPER_MICRO4      3   // PWM sine/cosine currents, 4 steps per full step.
+#define STEPPER_MICRO8      4
+#define STEPPER_MICRO16     5
+#define STEPPER_MICRO32     6
+
+#define STEPPER_PWM_FREQUENCY   20000 // Hz, coil PWM in the microstep modes.
+
+// TIMER1 with prescale 1:8 counts the step interval. Pg 131.
+#define STEPPER_TICK_HZ     (_XTAL_FREQ / 4 / 8)
+#define STEPPER_SPEED_MIN   (STEPPER_TICK_HZ / 65535 + 1) // Steps/s.
+#define STEPPER_SPEED_MAX   2000                          // Steps/s, interrupt load with the ramp.
+#define STEPPER_ACCEL_MAX   50000                         // Steps/s^2.
+#define STEPPER_RAMP_TABLE  16  // Ramp steps taken from the 1/sqrt(n) table.
+
+#ifndef STEPPER_QUEUE
+    #define STEPPER_QUEUE   4   // Queued moves, power of 2.
+#endif
+typedef char stepper_queue_check[((STEPPER_QUEUE & (STEPPER_QUEUE - 1)) == 0) ? 1 : -1];
+
+void stepper_ini(void);
+uint8_t stepper_setMode(uint8_t mode);
+void stepper_setSpeed(uint16_t speed);
+uint8_t stepper_setAccel(uint16_t accel);
+uint8_t stepper_moveTo(int32_t position);
+uint8_t stepper_move(int32_t steps);
+void stepper_run(int8_t direction);
+void stepper_stop(void);
+void stepper_release(void);
+int32_t stepper_getPosition(void);
+uint8_t stepper_setPosition(int32_t position);
+uint8_t stepper_isBusy(void);
+uint8_t stepper_getMicrosteps(void);
+void stepper_isr(void);
+
+#endif	/* STEPPER_H */
@@ -17,98 +17,137 @@
  * Date           | Author                | Description
  * **********|************* *|***************************************************
  * 05/13/2022 | Antonio Castilho  | Function has been created
+ * 10/19/2026 | Antonio Castilho  | Driver stepper.c, steps by interrupt, no delays
+ * 10/19/2026 | Antonio Castilho  | Moves with acceleration ramps
+ * 10/19/2026 | Antonio Castilho  | Microstep modes with PWM (pwm.c)
+ * 10/19/2026 | Antonio Castilho  | Buttons through debounce.c events
+ * 10/19/2026 | Antonio Castilho  | Position and mode kept in the EEPROM (eelog.c)
  ******************************************************************************/ 
 
-/* In development. Initial studies of the elementary functions that will be used.*/
-
 #include <xc.h>
 #include "fuse_bits.h"
 #include "hdw_map.h"
 #include "stepper_motor.h"
+#include "stepper.h"
+#include "pwm.h"
+#include "debounce.h"
 #include "adc.h"
 #include "lcd.h"
+#include "eelog.h"
+
+#define STEP_MOVE       100 // Full steps of each press.
+#define STEP_SPEED      200 // Full steps/s, top speed of the moves.
+#define STEP_ACCEL      400 // Full steps/s^2, ramps of half a second.
+
+typedef struct
+{
+    int32_t position;   // Steps of the mode.
+    uint8_t mode;
+} step_saved_t;         // Record of the EEPROM log, up to EELOG_DATA bytes.
+
+/******************************************************************************
+ * Function: void __interrupt(high_priority) isr_high(void)
+ * Description: CCP1 compare or TIMER1 overflow, one step of the motor; TIMER2,
+ * PWM duties of the microstep modes.
+ ******************************************************************************/
+void __interrupt(high_priority) isr_high(void)
+{
+    stepper_isr();
+    pwm_isr();
+}
+
+/******************************************************************************
+ * Function: void __interrupt(low_priority) isr_low(void)
+ * Description: TIMER0, debounce tick; EEIF, next byte of the EEPROM log.
+ ******************************************************************************/
+void __interrupt(low_priority) isr_low(void)
+{
+    debounce_isr();
+    eelog_isr();
+}
 
 void main(void)
 {
+    // OSCCON Oscillator control register Pg 34.
+    OSCCON = 0x72; // IDLEN = 0, IRCF = 111 (8 MHz, _XTAL_FREQ), SCS = 10 (internal oscillator).
+
     adc_ini(); // Configure ADC module (Releasing PORTB).
     lcd_wellcome();
     
-    uint8_t btn1_flag = OFF; // this variable indicates that the button 1 was pressed.
-    uint8_t btn2_flag = OFF; // this variable indicates that the button 2 was pressed.
-    uint8_t btn3_flag = OFF; // this variable indicates that the button 3 was pressed.
-    uint8_t mode_full = TRUE;
+    uint8_t event;
+    uint8_t mode = STEPPER_WAVE;
+    uint8_t n = 1; // Steps of the mode in one full step.
+    step_saved_t saved = {0, STEPPER_WAVE}; // Last record written in the EEPROM.
+    step_saved_t now;
     
     // I/O sets
-    TRISE = INPUT; // Button 1, 2 and 3 - I/O.
-    TRISB = OUTPUT; // Configure PORTB for digital output.
-    LATB = 0xFF;
-    TRISE = 0xFF; // See page: 126 of PIC18f450 datasheet.
+    debounce_ini(); // Button 1, 2 and 3 - I/O, TIMER0 tick.
     
-    COIL_1A = 0; // Lilas
-    COIL_1B = 0; // Marrom
-    COIL_2A = 0; // Cinza
-    COIL_2B = 0; // Azul
-    
-    // Backward step: {COIL_1A, COIL_2B, COIL_1B, COIL_2A}
-    // Forward {COIL_1A, COIL_2A, COIL_1B, COIL_2B]
+    // Coils: COIL_1A Lilas, COIL_1B Marrom, COIL_2A Cinza, COIL_2B Azul.
+    // Forward {COIL_1A, COIL_2A, COIL_1B, COIL_2B}, backward the reverse order.
+    stepper_ini();
+    stepper_setSpeed(STEP_SPEED);
+    stepper_setAccel(STEP_ACCEL);
+
+    // Mode and position of before the power cycle, if the log has them.
+    if(eelog_ini() && eelog_read(&saved, sizeof(saved)) && stepper_setMode(saved.mode))
+    {
+        mode = saved.mode;
+        n = stepper_getMicrosteps();
+        stepper_setSpeed((uint16_t)(STEP_SPEED * n));
+        stepper_setAccel((uint16_t)(STEP_ACCEL * n));
+        stepper_setPosition(saved.position);
+    }
+
+    RCONbits.IPEN = 1;   // Interrupt priority levels. Pg 100.
+    INTCONbits.GIEH = 1;
+    INTCONbits.GIEL = 1;
    
     while(1)
     {
-        // Backward - Nissan CVT stepper motor
-        if(BTN_1 == PRESSED)  btn1_flag = ON; // Button pressed set flag
-        if(BTN_1 == UNPRESSED && btn1_flag == ON && mode_full == TRUE) // when release button execute commands
+        event = debounce_get();
+
+        // Backward - Nissan CVT stepper motor, STEP_MOVE steps (queued), again while held.
+        if(event == (DEBOUNCE_PRESS | KEY_BTN_1) || event == (DEBOUNCE_REPEAT | KEY_BTN_1))
         {
-            COIL_1A = ON; // Lilas
-            __delay_ms(500);
-            COIL_1A = OFF; // Lilas
-             __delay_ms(500);
-            COIL_2B = ON; // Azul
-             __delay_ms(500);
-            COIL_2B = OFF; // Azul
-             __delay_ms(500);
-            COIL_1B = ON; // Marrom
-             __delay_ms(500);
-            COIL_1B = OFF; // Marrom
-             __delay_ms(500);
-            COIL_2A = ON; // Cinza
-             __delay_ms(500);
-            COIL_2A = OFF; // Cinza
-             __delay_ms(500);
-            btn1_flag = OFF; // return to initial condition for acquisition of other presses.
+            stepper_move(-(int32_t)STEP_MOVE * n);
         }
         
-        // Forward - Nissan CVT stepper motor
-        if(BTN_2 == PRESSED)  btn2_flag = ON; // Button pressed set flag
-        if(BTN_2 == UNPRESSED && btn2_flag == ON) // when release button execute commands
+        // Forward - Nissan CVT stepper motor, STEP_MOVE steps (queued), again while held.
+        if(event == (DEBOUNCE_PRESS | KEY_BTN_2) || event == (DEBOUNCE_REPEAT | KEY_BTN_2))
         {
-            COIL_1A = ON; // Lilas
-            __delay_ms(500);
-            COIL_1A = OFF; // Lilas
-             __delay_ms(500);
-            COIL_2A = ON; // Cinza
-             __delay_ms(500);
-            COIL_2A = OFF; // Cinza
-             __delay_ms(500);
-            COIL_1B = ON; // Marrom
-             __delay_ms(500);
-            COIL_1B = OFF; // Marrom
-             __delay_ms(500);
-            COIL_2B = ON; // Azul
-             __delay_ms(500);
-            COIL_2B = OFF; // Azul
-             __delay_ms(500);
-            btn2_flag = OFF; // return to initial condition for acquisition of other presses.
+            stepper_move((int32_t)STEP_MOVE * n);
         }
         
-        if(BTN_3 == PRESSED)  btn3_flag = ON; // Button pressed set flag
-        if(BTN_3 == UNPRESSED && btn3_flag == ON) // when release button execute commands
+        // Step mode: WAVE -> FULL -> HALF -> MICRO4 ... MICRO32, only with the motor stopped.
+        if(event == (DEBOUNCE_PRESS | KEY_BTN_3))
+        {
+            if(stepper_setMode((mode == STEPPER_MICRO32) ? STEPPER_WAVE : (uint8_t)(mode + 1)))
+            {
+                mode = (mode == STEPPER_MICRO32) ? STEPPER_WAVE : (uint8_t)(mode + 1);
+                n = stepper_getMicrosteps();
+                stepper_setSpeed((uint16_t)(STEP_SPEED * n)); // Limited to STEPPER_SPEED_MAX.
+                stepper_setAccel((uint16_t)(STEP_ACCEL * n));
+            }
+        }
+        if(event == (DEBOUNCE_LONG | KEY_BTN_3)) // Long press: stop and coils off.
+        {
+            stepper_stop();
+            stepper_release();
+        }
+        // Stopped at a new position (or mode): one record in the EEPROM log,
+        // written by the EEIF interrupt. Busy with the one before: next pass.
+        if(!stepper_isBusy())
         {
-            mode_full = (uint8_t)~mode_full;
-            LATBbits.LATB0 = ~PORTBbits.RB0; // Forward (clockwise disable.)
-            btn3_flag = OFF; // return to initial condition for acquisition of other presses.
-            btn1_flag = OFF; // return to initial condition for acquisition of other presses.
+            now.position = stepper_getPosition();
+            now.mode = mode;
+            if((now.position != saved.position || now.mode != saved.mode)
+               && eelog_write(&now, sizeof(now)))
+            {
+                saved = now;
+            }
         }
         // TODO PID stepper motor control.
         
     } // end while
-} // end main
\ No newline at end of file
+} // end main
@@ -0,0 +1,201 @@
+/* Program: Power Manager     File: power.c
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ * Description:
+ *      IDLE/SLEEP when there is no work and watchdog health task. See power.h.
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 10/19/2026 | Antonio Castilho  | Created                                                                    | 00.00.01
+ *________________________________________________________________________________________
+ */
+
+#include <xc.h>
+#include "power.h"
+
+static uint8_t power_mode;
+static volatile uint8_t asleep;        // The core is (or was, until the interrupts run) at rest.
+static volatile uint32_t ticks;        // Ticks since power_ini().
+static volatile uint32_t asleep_ticks; // Ticks that found the core at rest.
+static uint16_t sleeps;                // SLEEP instructions executed.
+static uint8_t watched;                // Tasks checked by power_health().
+static volatile uint8_t alive;         // Tasks alive since the last power_health().
+static uint8_t wdt_reset;
+
+/****************************************************************************************
+ * void power_ini(uint8_t mode);
+ * Clears the counters and takes the cause of the last reset: RCON<TO> = 0 after a WDT time-out
+ * reset (RCON, section 4). Call it at the start of main(), before anything executes CLRWDT or SLEEP,
+ * which set TO again.
+ ****************************************************************************************/
+void power_ini(uint8_t mode)
+{
+    wdt_reset = (uint8_t)(RCONbits.NOT_TO == 0 && RCONbits.NOT_POR == 1);
+    RCONbits.NOT_POR = 1; // Cleared by the hardware at a power-on reset only.
+    CLRWDT();
+
+    power_mode = mode;
+    asleep = 0;
+    ticks = 0;
+    asleep_ticks = 0;
+    sleeps = 0;
+    watched = 0;
+    alive = 0;
+}
+// end of void power_ini(uint8_t mode)
+
+/****************************************************************************************
+ * void power_setMode(uint8_t mode);
+ * POWER_RUN, POWER_IDLE or POWER_SLEEP. POWER_SLEEP stops the timers clocked by Fosc/4.
+ ****************************************************************************************/
+void power_setMode(uint8_t mode)
+{
+    power_mode = mode;
+}
+// end of void power_setMode(uint8_t mode)
+
+/****************************************************************************************
+ * void power_idle(power_busy_t busy);
+ * End of a pass of the main loop: rests until the next interrupt if busy() (or NULL) says
+ * there is no work. The interrupts that woke the core are served before returning, still
+ * counted as time asleep.
+ ****************************************************************************************/
+void power_idle(power_busy_t busy)
+{
+    uint8_t gieh = INTCONbits.GIEH;
+
+    if(power_mode == POWER_RUN) return;
+
+    INTCONbits.GIEH = 0; // From here an interrupt flag wakes the core but is not served.
+    if(busy == 0 || !busy())
+    {
+        OSCCONbits.IDLEN = (power_mode == POWER_IDLE); // SCS<1:0> keep the clock source. Pg 34.
+        asleep = 1;
+        SLEEP();
+        NOP(); // The instruction after SLEEP is executed before the interrupt (section 3).
+        sleeps++;
+    }
+    INTCONbits.GIEH = gieh;
+    NOP();
+    asleep = 0;
+}
+// end of void power_idle(power_busy_t busy)
+
+/****************************************************************************************
+ * void power_tick(void);
+ * Called at every tick, in the interrupt.
+ ****************************************************************************************/
+void power_tick(void)
+{
+    ticks++;
+    if(asleep) asleep_ticks++;
+}
+// end of void power_tick(void)
+
+/****************************************************************************************
+ * void power_watch(uint8_t tasks);
+ * Bits of the tasks that must call power_alive() between two calls of power_health().
+ ****************************************************************************************/
+void power_watch(uint8_t tasks)
+{
+    watched = tasks;
+    alive = 0;
+}
+// end of void power_watch(uint8_t tasks)
+
+/****************************************************************************************
+ * void power_alive(uint8_t task);
+ * The task (bit of power_watch()) is running. Can be called in the interrupts.
+ ****************************************************************************************/
+void power_alive(uint8_t task)
+{
+    uint8_t gieh = INTCONbits.GIEH;
+
+    INTCONbits.GIEH = 0; // Read-modify-write also done by the interrupts.
+    alive |= task;
+    INTCONbits.GIEH = gieh;
+}
+// end of void power_alive(uint8_t task)
+
+/****************************************************************************************
+ * uint8_t power_health(void);
+ * Health task. Services the WDT if all the watched tasks are alive, and starts a new period.
+ * Returns 1 if the WDT was cleared, 0 if some task did not report (the WDT keeps counting).
+ ****************************************************************************************/
+uint8_t power_health(void)
+{
+    if((alive & watched) != watched) return 0;
+
+    CLRWDT();
+    alive = 0;
+    return 1;
+}
+// end of uint8_t power_health(void)
+
+/****************************************************************************************
+ * uint8_t power_wdtReset(void);
+ * Returns 1 if the last reset was caused by the WDT.
+ ****************************************************************************************/
+uint8_t power_wdtReset(void)
+{
+    return wdt_reset;
+}
+// end of uint8_t power_wdtReset(void)
+
+/****************************************************************************************
+ * uint32_t power_getTicks(void);  uint32_t power_getAsleep(void);  uint16_t power_getSleeps(void);
+ * Ticks since power_ini(), ticks at rest and number of sleeps. The 32-bit counters are written
+ * by the interrupt, so they are read with it masked.
+ ****************************************************************************************/
+uint32_t power_getTicks(void)
+{
+    uint32_t value;
+    uint8_t gieh = INTCONbits.GIEH;
+
+    INTCONbits.GIEH = 0;
+    value = ticks;
+    INTCONbits.GIEH = gieh;
+    return value;
+}
+
+uint32_t power_getAsleep(void)
+{
+    uint32_t value;
+    uint8_t gieh = INTCONbits.GIEH;
+
+    INTCONbits.GIEH = 0;
+    value = asleep_ticks;
+    INTCONbits.GIEH = gieh;
+    return value;
+}
+
+uint16_t power_getSleeps(void)
+{
+    return sleeps;
+}
+// end of the counters
+
+/****************************************************************************************
+ * uint8_t power_getPercent(void);
+ * Time at rest since power_ini(), in % (0 to 100).
+ ****************************************************************************************/
+uint8_t power_getPercent(void)
+{
+    uint32_t total;
+    uint32_t rest;
+    uint8_t gieh = INTCONbits.GIEH;
+
+    INTCONbits.GIEH = 0;
+    total = ticks;
+    rest = asleep_ticks;
+    INTCONbits.GIEH = gieh;
+
+    if(total == 0) return 0;
+    while(rest > 0x00FFFFFFUL) // rest * 100 in 32 bits.
+    {
+        rest >>= 1;
+        total >>= 1;
+    }
+    return (uint8_t)(rest * 100 / total);
+}
+// end of uint8_t power_getPercent(void)
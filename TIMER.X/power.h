@@ -0,0 +1,61 @@
+/* Program: Power Manager     File: power.h
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ * Description:
+ *      Puts the core to rest when the main loop has no work, and services the watchdog.
+ *
+ *      power_idle(busy) is called at the end of each pass of the main loop. With the interrupts
+ *      masked it calls busy(); if there is no work the SLEEP instruction is executed. An interrupt
+ *      whose IE bit is set wakes the core even with GIEH = 0, so an event posted between the
+ *      check and the SLEEP is not lost: the core does not sleep, or wakes at once. The interrupt
+ *      is then served when GIEH is restored. Pg 34, section 3 (power managed modes).
+ *
+ *              mode            clock                        wakes on
+ *              POWER_IDLE      CPU off, peripherals on      any enabled interrupt: TIMERx, ADC,
+ *                                                           CCP, EUSART, INT0:INT2
+ *              POWER_SLEEP     all off, lowest current      INT0:INT2, RB change, ADC with RC
+ *                                                           clock, TIMER1 oscillator, WDT
+ *
+ *      Time asleep: power_tick() in the tick interrupt (e.g. swtimer_tick() every 1 ms) counts
+ *      the ticks and the ticks that found the core asleep, which gives the fraction of time at
+ *      rest with the resolution of the tick (power_getPercent()). In POWER_SLEEP the tick only
+ *      runs if it comes from the TIMER1 oscillator; otherwise only the sleeps are counted.
+ *
+ *      Watchdog: the fuses set WDT = ON, WDTPS = 32768: 4 ms * 32768, about 131 s (section 25.2).
+ *      Each task proves it is alive with power_alive(bit); the health task power_health(),
+ *      called periodically (e.g. by a software timer), executes CLRWDT only if every bit of
+ *      power_watch() was set since the last call. A task that stops makes the WDT reset the
+ *      device; power_wdtReset() tells, after the reset, that it was the cause.
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 10/19/2026 | Antonio Castilho  | Created                                                                    | 00.00.01
+ *________________________________________________________________________________________
+ */
+#ifndef POWER_H
+#define	POWER_H
+
+#include <xc.h>
+#include <stdint.h>
+
+// Power managed mode of power_idle(), OSCCON<IDLEN>. Pg 34.
+#define POWER_RUN       0   // Does not rest (busy wait).
+#define POWER_IDLE      1
+#define POWER_SLEEP     2
+
+typedef uint8_t (*power_busy_t)(void); // Returns 1 if the main loop has work.
+
+void power_ini(uint8_t mode);
+void power_setMode(uint8_t mode);
+void power_idle(power_busy_t busy);
+void power_tick(void);
+void power_watch(uint8_t tasks);
+void power_alive(uint8_t task);
+uint8_t power_health(void);
+uint8_t power_wdtReset(void);
+uint32_t power_getTicks(void);
+uint32_t power_getAsleep(void);
+uint16_t power_getSleeps(void);
+uint8_t power_getPercent(void);
+
+#endif	/* POWER_H */
@@ -0,0 +1,197 @@
+/* Program: Software Timers     File: swtimer.c
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ * Description:
+ *      Software timers kept in a delta list. See swtimer.h.
+ *
+ *      Example, list with timers A (5 ticks), B (8 ticks) and C (8 ticks):
+ *              head -> A[5] -> B[3] -> C[0] -> SWTIMER_NONE
+ *      At each tick only the head is decremented; when it reaches 0 the head and every following
+ *      entry with delta 0 have expired.
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 10/19/2026 | Antonio Castilho  | Created                                                                    | 00.00.01
+ *________________________________________________________________________________________
+ */
+
+#include <xc.h>
+#include "swtimer.h"
+
+static uint16_t delta[SWTIMER_MAX];   // Ticks after the previous timer of the list.
+static uint16_t period[SWTIMER_MAX];  // Reload, in ticks. 0 = one shot.
+static uint8_t next[SWTIMER_MAX];     // Next timer of the list.
+static uint8_t active[SWTIMER_MAX];   // The timer is in the list.
+static volatile uint8_t expired[SWTIMER_MAX]; // Expirations not yet served by swtimer_task().
+static swtimer_callback_t callback[SWTIMER_MAX];
+static uint8_t head = SWTIMER_NONE;
+
+/****************************************************************************************
+ * static void swtimer_insert(uint8_t id, uint16_t ticks);
+ * Puts the timer in the list at the position of its expiration. Must run with the tick
+ * interrupt masked (or inside it).
+ ****************************************************************************************/
+static void swtimer_insert(uint8_t id, uint16_t ticks)
+{
+    uint8_t prev = SWTIMER_NONE;
+    uint8_t node = head;
+
+    if(ticks == 0) ticks = 1; // Expires at the next tick.
+
+    while(node != SWTIMER_NONE && delta[node] <= ticks)
+    {
+        ticks -= delta[node];
+        prev = node;
+        node = next[node];
+    }
+    if(node != SWTIMER_NONE) delta[node] -= ticks;
+
+    delta[id] = ticks;
+    next[id] = node;
+    active[id] = 1;
+    if(prev == SWTIMER_NONE) head = id;
+    else next[prev] = id;
+}
+// end of static void swtimer_insert(uint8_t id, uint16_t ticks)
+
+/****************************************************************************************
+ * static void swtimer_remove(uint8_t id);
+ * Takes the timer out of the list, giving its delta to the next one.
+ ****************************************************************************************/
+static void swtimer_remove(uint8_t id)
+{
+    uint8_t prev = SWTIMER_NONE;
+    uint8_t node = head;
+
+    while(node != SWTIMER_NONE && node != id)
+    {
+        prev = node;
+        node = next[node];
+    }
+    if(node == SWTIMER_NONE) return;
+
+    if(next[id] != SWTIMER_NONE) delta[next[id]] += delta[id];
+    if(prev == SWTIMER_NONE) head = next[id];
+    else next[prev] = next[id];
+    active[id] = 0;
+}
+// end of static void swtimer_remove(uint8_t id)
+
+/****************************************************************************************
+ * void swtimer_ini(void);
+ * Stops every software timer.
+ ****************************************************************************************/
+void swtimer_ini(void)
+{
+    SWTIMER_LOCK();
+    for(uint8_t i = 0; i < SWTIMER_MAX; i++)
+    {
+        active[i] = 0;
+        expired[i] = 0;
+        next[i] = SWTIMER_NONE;
+        callback[i] = 0;
+    }
+    head = SWTIMER_NONE;
+    SWTIMER_UNLOCK();
+}
+// end of void swtimer_ini(void)
+
+/****************************************************************************************
+ * void swtimer_start(uint8_t id, uint16_t ticks, uint16_t reload, swtimer_callback_t function);
+ * Starts (or restarts) the timer id. The function runs in swtimer_task() after "ticks" ticks
+ * and then every "reload" ticks. reload = 0 for a one shot timer.
+ * Example: swtimer_start(0, 250, 250, led_toggle); // every 250 ticks.
+ ****************************************************************************************/
+void swtimer_start(uint8_t id, uint16_t ticks, uint16_t reload, swtimer_callback_t function)
+{
+    if(id >= SWTIMER_MAX) return;
+
+    SWTIMER_LOCK();
+    if(active[id]) swtimer_remove(id);
+    expired[id] = 0;
+    period[id] = reload;
+    callback[id] = function;
+    swtimer_insert(id, ticks);
+    SWTIMER_UNLOCK();
+}
+// end of void swtimer_start(...)
+
+/****************************************************************************************
+ * void swtimer_stop(uint8_t id);
+ * Stops the timer id. An expiration not yet served is discarded.
+ ****************************************************************************************/
+void swtimer_stop(uint8_t id)
+{
+    if(id >= SWTIMER_MAX) return;
+
+    SWTIMER_LOCK();
+    if(active[id]) swtimer_remove(id);
+    expired[id] = 0;
+    SWTIMER_UNLOCK();
+}
+// end of void swtimer_stop(uint8_t id)
+
+/****************************************************************************************
+ * uint8_t swtimer_isActive(uint8_t id);
+ * Returns 1 while the timer id is counting.
+ ****************************************************************************************/
+uint8_t swtimer_isActive(uint8_t id)
+{
+    return (id < SWTIMER_MAX) ? active[id] : 0;
+}
+// end of uint8_t swtimer_isActive(uint8_t id)
+
+/****************************************************************************************
+ * uint8_t swtimer_pending(void);
+ * Returns 1 if some callback is waiting for swtimer_task().
+ ****************************************************************************************/
+uint8_t swtimer_pending(void)
+{
+    for(uint8_t i = 0; i < SWTIMER_MAX; i++)
+    {
+        if(expired[i]) return 1;
+    }
+    return 0;
+}
+// end of uint8_t swtimer_pending(void)
+
+/****************************************************************************************
+ * void swtimer_tick(void);
+ * Called at every tick of the hardware timer, in the low priority interrupt.
+ ****************************************************************************************/
+void swtimer_tick(void)
+{
+    uint8_t id;
+
+    if(head == SWTIMER_NONE) return;
+    if(delta[head] > 0) delta[head]--;
+
+    while(head != SWTIMER_NONE && delta[head] == 0)
+    {
+        id = head;
+        head = next[id];
+        active[id] = 0;
+        if(expired[id] < 0xFF) expired[id]++;
+        if(period[id]) swtimer_insert(id, period[id]);
+    }
+}
+// end of void swtimer_tick(void)
+
+/****************************************************************************************
+ * void swtimer_task(void);
+ * Runs, in the main loop, the callback of each expiration counted by swtimer_tick().
+ ****************************************************************************************/
+void swtimer_task(void)
+{
+    for(uint8_t i = 0; i < SWTIMER_MAX; i++)
+    {
+        while(expired[i])
+        {
+            SWTIMER_LOCK();
+            expired[i]--;
+            SWTIMER_UNLOCK();
+            if(callback[i]) callback[i]();
+        }
+    }
+}
+// end of void swtimer_task(void)
@@ -0,0 +1,48 @@
+/* Program: Software Timers     File: swtimer.h
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ * Description:
+ *      Any number of software timers multiplexed on one hardware timer interrupt (the tick).
+ *      The running timers are kept in a delta list, sorted by expiration: each entry stores only
+ *      the ticks after the previous entry, so the tick interrupt only decrements the head.
+ *
+ *      Use:
+ *              swtimer_tick()  - in the tick interrupt (low priority), e.g. TIMER2 every 1 ms;
+ *              swtimer_task() - in the main loop, runs the callback of the expired timers;
+ *              swtimer_start() / swtimer_stop() - in the main loop.
+ *
+ *      A periodic timer is put back in the list by the interrupt itself, at the exact tick of its
+ *      expiration, so the period does not drift even when the main loop is late.
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 10/19/2026 | Antonio Castilho  | Created                                                                    | 00.00.01
+ *________________________________________________________________________________________
+ */
+#ifndef SWTIMER_H
+#define	SWTIMER_H
+
+#include <xc.h>
+#include <stdint.h>
+
+#ifndef SWTIMER_MAX
+    #define SWTIMER_MAX     8       // Number of software timers, id 0 to SWTIMER_MAX - 1.
+#endif
+
+#define SWTIMER_NONE        0xFF
+
+// swtimer_tick() runs in the low priority interrupt; the list is protected by masking it.
+#define SWTIMER_LOCK()      uint8_t swtimer_giel = INTCONbits.GIEL; INTCONbits.GIEL = 0
+#define SWTIMER_UNLOCK()    INTCONbits.GIEL = swtimer_giel
+
+typedef void (*swtimer_callback_t)(void);
+
+void swtimer_ini(void);
+void swtimer_start(uint8_t id, uint16_t ticks, uint16_t reload, swtimer_callback_t function);
+void swtimer_stop(uint8_t id);
+uint8_t swtimer_isActive(uint8_t id);
+uint8_t swtimer_pending(void);
+void swtimer_tick(void);
+void swtimer_task(void);
+
+#endif	/* SWTIMER_H */
@@ -31,6 +31,9 @@
  *                  TMRx = ( 65535 - Count ); Ex.: 65535 - 62500 = 3035; 0xFFFF - 0xF424 = 0x0BDB;
  * 
  *              TMRx = ResolutionMax - ((_XTAL_FREQ * T ) / ( 4 * Prescale ));
+ *
+ *              These formulas are solved at compile time in timer.h, from the periods
+ *              TIMERx_PERIOD_US: prescaler, postscaler (TIMER2) and preload.
  * 
  *              Where:
  *                          Fcy or Ftimer - Instruction Cycle Frequency
@@ -44,12 +47,30 @@
  * _______________________________________________________________________________________
  * Date:          | Author:               | Description:                                                             | Version:
  * 04/22/2022 | Antonio Castilho  | Created                                                                    | 00.00.01
+ * 10/19/2026 | Antonio Castilho  | Interrupt priorities and drift-free reload                      | 00.00.02
+ * 10/19/2026 | Antonio Castilho  | Prescaler and preload calculated at compile time            | 00.00.03
+ * 10/19/2026 | Antonio Castilho  | Reload latency added to the preload                             | 00.00.04
  *________________________________________________________________________________________
  */
 
 #include <xc.h>
 #include "timer.h"
 
+/****************************************************************************************
+ * void timer_interrupts_ini(void);
+ * Turns on the interrupt priority levels (RCONbits.IPEN = 1) and enables both the high
+ * (GIEH) and low (GIEL) priority interrupts. Pg 97.
+ * Each timer is then assigned to a level with timerx_intEnable(). The program must have
+ * the interrupt functions: void __interrupt(high_priority) and __interrupt(low_priority).
+ ****************************************************************************************/
+void timer_interrupts_ini(void)
+{
+    RCONbits.IPEN = 1;        // 1 = Enable priority levels on interrupts.
+    INTCONbits.GIEH = 1;     // 1 = Enables all high priority interrupts.
+    INTCONbits.GIEL = 1;      // 1 = Enables all low priority peripheral interrupts.
+}
+// end of void timer_interrupts_ini(void)
+
 /****************************************************************************************
  * void timer0_ini(void); 
  * Configure registers to start TIMER 0. There are no inputs or outputs.
@@ -70,11 +91,11 @@ void timer0_ini(void)
                                         // 0 = Internal instruction cycle clock (CLKO)
     T0CONbits.T0SE = 0;     // 1 = Increment on high-to-low transition on T0CKI pin
                                         // 0 = Increment on low-to-high transition on T0CKI pin
-    T0CONbits.PSA = 0;       // 1 = TImer0 prescaler IS NOT ASSIGNED. Timer0 clock input bypasses prescaler
+    T0CONbits.PSA = TIMER0_NO_PRESCALE; // 1 = TImer0 prescaler IS NOT ASSIGNED. Timer0 clock input bypasses prescaler
                                         // 0 = Timer0 prescaler IS ASSIGNED. Timer0 clock input comes from prescaler output
-    T0CONbits.T0PS2 = 0;   // |  1   |  1    | 1   |  1  |  0 | 0 | 0 | 0 |
-    T0CONbits.T0PS1 = 1;   // |  1   |  1    | 0   |  0  |  1 | 1 | 0 | 0 |
-    T0CONbits.T0PS0 = 1;   // |  1   |  0    | 1   |  0  |  1 | 0 | 1 | 0 |
+    T0CONbits.T0PS2 = (TIMER0_PRESCALE >> 2) & 1;   // |  1   |  1    | 1   |  1  |  0 | 0 | 0 | 0 |
+    T0CONbits.T0PS1 = (TIMER0_PRESCALE >> 1) & 1;   // |  1   |  1    | 0   |  0  |  1 | 1 | 0 | 0 |
+    T0CONbits.T0PS0 = TIMER0_PRESCALE & 1;          // |  1   |  0    | 1   |  0  |  1 | 0 | 1 | 0 |
                   // Prescale value: | 256 | 128 | 64 | 32 | 16 | 8 | 4 | 2 |   
     
      T0CONbits.TMR0ON = 1; // turn on timer0.
@@ -83,7 +104,7 @@ void timer0_ini(void)
     TMR0H = 0;
     
      // uint16_t timer_value = ResolutionMax - ((_XTAL_FREQ * T ) / ( 4 * Prescale ));
-     timer0_write(3035);  // 0x; Loads the Timer preload value to 500 ms.
+     timer0_write(TIMER0_PRELOAD);  // Loads the Timer preload value to TIMER0_PERIOD_US.
    
 }
 // end of void timer0_ini(void)
@@ -95,11 +116,45 @@ void timer0_ini(void)
  ****************************************************************************************/
 void timer0_write(uint16_t timer_value)
 {
-    TMR0L = (timer_value & 0x00FF);
+    // TMR0H is a buffer, it is only loaded into the timer when TMR0L is written. Pg 126.
     TMR0H = (timer_value >> 8) & 0x00FF;
+    TMR0L = (timer_value & 0x00FF);
 }
 // end of void timer0_write(uint16_t timer_value)
 
+/****************************************************************************************
+ * void timer0_reload(void);
+ * Called after the TIMER0 overflow (usually in the interrupt). The preload is added to the
+ * count that has already run since the overflow, instead of overwriting it, so the interrupt
+ * latency does not accumulate from one period to the next. The counts made between the read
+ * and the write, and the 2 Tcy TMR0 stops after the write, are added too
+ * (TIMER0_RELOAD_LATENCY, timer.h); the write is not in timer0_write() so no call lies
+ * between them.
+ * Note: writing TMR0 clears the prescaler, a remainder of up to (Prescale - 1) cycles
+ * is still lost in each reload.
+ ****************************************************************************************/
+void timer0_reload(void)
+{
+    uint16_t count = TMR0L;  // Reading TMR0L latches TMR0H.
+    count |= (uint16_t)TMR0H << 8;
+    count += (uint16_t)(TIMER0_PRELOAD + TIMER0_RELOAD_LATENCY);
+    TMR0H = (uint8_t)(count >> 8);
+    TMR0L = (uint8_t)count;  // TMR0H goes to the timer with TMR0L.
+}
+// end of void timer0_reload(void)
+
+/****************************************************************************************
+ * void timer0_intEnable(uint8_t priority);
+ * Enables the TIMER0 overflow interrupt with the priority TIMER_PRIO_HIGH or TIMER_PRIO_LOW.
+ ****************************************************************************************/
+void timer0_intEnable(uint8_t priority)
+{
+    INTCON2bits.TMR0IP = priority; // TMR0 Overflow Interrupt Priority bit. Pg 100.
+    INTCONbits.TMR0IF = 0;
+    INTCONbits.TMR0IE = 1;          // 1 = Enables the TMR0 overflow interrupt.
+}
+// end of void timer0_intEnable(uint8_t priority)
+
 /****************************************************************************************
  * void timer1_ini(void)
  * Configure registers to start TIMER 1. There are no inputs or outputs.
@@ -115,8 +170,8 @@ void timer1_ini(void)
     T1CONbits.T1RUN = 1; // 1 = Device clock is derived from Timer1 oscillator
                                       // 0 = Device clock is derived from another source
     
-    T1CONbits.T1CKPS1 = 1; // | 1 | 1 | 0 | 0 |
-    T1CONbits.T1CKPS0 = 0; // | 1 | 0 | 1 | 0 |
+    T1CONbits.T1CKPS1 = (TIMER1_PRESCALE >> 1) & 1; // | 1 | 1 | 0 | 0 |
+    T1CONbits.T1CKPS0 = TIMER1_PRESCALE & 1;        // | 1 | 0 | 1 | 0 |
                      // Prescale value: | 8 | 4 | 2 | 1 |
     
     T1CONbits.T1OSCEN = 1; // 1 = Timer1 oscillator is enabled
@@ -131,7 +186,7 @@ void timer1_ini(void)
     TMR1H = 0;
     
     // uint16_t timer_value = ResolutionMax - ((_XTAL_FREQ * T ) / ( 4 * Prescale ));
-    timer1_write(3035); // 0xF060- Loads the Timer preload value to 250 ms.
+    timer1_write(TIMER1_PRELOAD); // Loads the Timer preload value to TIMER1_PERIOD_US.
 }
 // end of void timer1_ini(void)
 
@@ -142,11 +197,39 @@ void timer1_ini(void)
  ****************************************************************************************/
 void timer1_write(uint16_t timer_value)
 {
-    TMR1L = (timer_value & 0x00FF);
+    // With RD16 = 1, TMR1H is loaded into the timer together with the TMR1L write. Pg 132.
     TMR1H = (timer_value >> 8) & 0x00FF;
+    TMR1L = (timer_value & 0x00FF);
 } 
 // end of void timer1_write(uint16_t timer_value)
 
+/****************************************************************************************
+ * void timer1_reload(void);
+ * Adds the preload and the reload latency (TIMER1_RELOAD_LATENCY) to the running TIMER1
+ * count. See timer0_reload().
+ ****************************************************************************************/
+void timer1_reload(void)
+{
+    uint16_t count = TMR1L;  // Reading TMR1L latches TMR1H (RD16 = 1).
+    count |= (uint16_t)TMR1H << 8;
+    count += (uint16_t)(TIMER1_PRELOAD + TIMER1_RELOAD_LATENCY);
+    TMR1H = (uint8_t)(count >> 8);
+    TMR1L = (uint8_t)count;  // TMR1H goes to the timer with TMR1L.
+}
+// end of void timer1_reload(void)
+
+/****************************************************************************************
+ * void timer1_intEnable(uint8_t priority);
+ * Enables the TIMER1 overflow interrupt with the priority TIMER_PRIO_HIGH or TIMER_PRIO_LOW.
+ ****************************************************************************************/
+void timer1_intEnable(uint8_t priority)
+{
+    IPR1bits.TMR1IP = priority; // Pg 106.
+    PIR1bits.TMR1IF = 0;
+    PIE1bits.TMR1IE = 1;         // 1 = Enables the TMR1 overflow interrupt. Pg 105.
+}
+// end of void timer1_intEnable(uint8_t priority)
+
 /******************************************************************************
  * void timer2_ini(void);
  * Configure registers to start TIMER 2. There are no inputs or outputs.
@@ -156,14 +239,14 @@ void timer2_ini()
 {
     T2CONbits.TMR2ON = 0; // turn off timer2 to start setup.
     // T2CON = 0x06; // Configuration TIMER2, pg 137.
-    T2CONbits.T2OUTPS3 = 0; // |  1  | 1  | 1   | 1   | 1   | 1  | 1   | 1 | 0 | 0 | 0 | 0 | 0 | 0 | 0 | 0 |
-    T2CONbits.T2OUTPS2 = 0; // |  1  | 1  | 1   | 1   | 0   | 0  | 0   | 0 | 1 | 1 | 1 | 1 | 0 | 0 | 0 | 0 |
-    T2CONbits.T2OUTPS1 = 1; // |  1  | 1  | 0   | 0   | 1   | 1  | 0   | 0 | 1 | 1 | 0 | 0 | 1 | 1 | 0 | 0 |
-    T2CONbits.T2OUTPS0 = 1; // |  1  | 0  | 1   | 0   | 1   | 0  | 1   | 0 | 1 | 0 | 1 | 0 | 1 | 0 | 1 | 0 |
+    T2CONbits.T2OUTPS3 = (TIMER2_POSTSCALE >> 3) & 1; // |  1  | 1  | 1   | 1   | 1   | 1  | 1   | 1 | 0 | 0 | 0 | 0 | 0 | 0 | 0 | 0 |
+    T2CONbits.T2OUTPS2 = (TIMER2_POSTSCALE >> 2) & 1; // |  1  | 1  | 1   | 1   | 0   | 0  | 0   | 0 | 1 | 1 | 1 | 1 | 0 | 0 | 0 | 0 |
+    T2CONbits.T2OUTPS1 = (TIMER2_POSTSCALE >> 1) & 1; // |  1  | 1  | 0   | 0   | 1   | 1  | 0   | 0 | 1 | 1 | 0 | 0 | 1 | 1 | 0 | 0 |
+    T2CONbits.T2OUTPS0 = TIMER2_POSTSCALE & 1;        // |  1  | 0  | 1   | 0   | 1   | 0  | 1   | 0 | 1 | 0 | 1 | 0 | 1 | 0 | 1 | 0 |
                      // Postscale value: | 16 | 15 | 14 | 13 | 12 | 11 | 10 | 9 | 8 | 7 | 6 | 5 | 4 | 3 | 2 | 1 |
 
-    T2CONbits.T2CKPS1 = 0; //  | 0 | 0 |  1  |
-    T2CONbits.T2CKPS0 = 1; //  | 0 | 1 |  x  |
+    T2CONbits.T2CKPS1 = (TIMER2_PRESCALE >> 1) & 1; //  | 0 | 0 |  1  |
+    T2CONbits.T2CKPS0 = TIMER2_PRESCALE & 1;        //  | 0 | 1 |  x  |
                       // Prescale value: | 1 | 4 | 16 |
     
     T2CONbits.TMR2ON = 1; // 1 = Timer2 is on
@@ -171,7 +254,7 @@ void timer2_ini()
     
     TMR2 = 0; 
     // uint16_t timer_value = ResolutionMax - ((_XTAL_FREQ * T ) / ( 4 * Prescale * Postscale));
-    timer2_write(130); // 0x83 - Loads the Timer preload value to 1 ms.
+    timer2_write(TIMER2_PERIOD); // Loads the Timer period to TIMER2_PERIOD_US.
 }
 // end of void timer2_ini().
 
@@ -186,6 +269,19 @@ void timer2_write(uint16_t timer_value)
 }
 // end of void timer2_write(uint16_t timer_value)
 
+/****************************************************************************************
+ * void timer2_intEnable(uint8_t priority);
+ * Enables the TMR2 to PR2 match interrupt. TIMER2 restarts by itself on the match, so it
+ * has no reload: it is the best time base for periodic interrupts.
+ ****************************************************************************************/
+void timer2_intEnable(uint8_t priority)
+{
+    IPR1bits.TMR2IP = priority;
+    PIR1bits.TMR2IF = 0;
+    PIE1bits.TMR2IE = 1;         // 1 = Enables the TMR2 to PR2 match interrupt.
+}
+// end of void timer2_intEnable(uint8_t priority)
+
 /****************************************************************************************
  * void timer3_ini(void)
  * Configure registers to start TIMER3. There are no inputs or outputs.
@@ -204,8 +300,8 @@ void timer3_ini()
                                         //         Timer1 is the capture/compare clock source for CCP1
                                         // 00 = Timer1 is the capture/compare clock source for both CCP modules
     
-    T3CONbits.T3CKPS1 = 1; // | 1 | 1 | 0 | 0 |
-    T3CONbits.T3CKPS0 = 1; // | 1 | 0 | 1 | 0 |
+    T3CONbits.T3CKPS1 = (TIMER3_PRESCALE >> 1) & 1; // | 1 | 1 | 0 | 0 |
+    T3CONbits.T3CKPS0 = TIMER3_PRESCALE & 1;        // | 1 | 0 | 1 | 0 |
                    // Prescale value: | 8 | 4 | 2 | 1 |
     
     T3CONbits.T3NSYNC = 1; // 1 = Do not synchronize external clock input
@@ -218,7 +314,7 @@ void timer3_ini()
     TMR3L = 0;
     TMR3H = 0;
      // uint16_t timer_value = ResolutionMax - ((_XTAL_FREQ * T ) / ( 4 * Prescale ));
-    timer3_write(3035); // 0xFF82 - Loads the Timer preload value to 250 ms.
+    timer3_write(TIMER3_PRELOAD); // Loads the Timer preload value to TIMER3_PERIOD_US.
 }
 // end of void timer3_ini().
 
@@ -229,7 +325,35 @@ void timer3_ini()
  ****************************************************************************************/
 void timer3_write(uint16_t timer_value)
 {
-    TMR3L = (timer_value & 0x00FF);
+    // With RD16 = 1, TMR3H is loaded into the timer together with the TMR3L write. Pg 140.
     TMR3H = (timer_value >> 8) & 0x00FF;
+    TMR3L = (timer_value & 0x00FF);
 }
 // end of void timer3_write(uint16_t timer_value)
+
+/****************************************************************************************
+ * void timer3_reload(void);
+ * Adds the preload and the reload latency (TIMER3_RELOAD_LATENCY) to the running TIMER3
+ * count. See timer0_reload().
+ ****************************************************************************************/
+void timer3_reload(void)
+{
+    uint16_t count = TMR3L;  // Reading TMR3L latches TMR3H (RD16 = 1).
+    count |= (uint16_t)TMR3H << 8;
+    count += (uint16_t)(TIMER3_PRELOAD + TIMER3_RELOAD_LATENCY);
+    TMR3H = (uint8_t)(count >> 8);
+    TMR3L = (uint8_t)count;  // TMR3H goes to the timer with TMR3L.
+}
+// end of void timer3_reload(void)
+
+/****************************************************************************************
+ * void timer3_intEnable(uint8_t priority);
+ * Enables the TIMER3 overflow interrupt with the priority TIMER_PRIO_HIGH or TIMER_PRIO_LOW.
+ ****************************************************************************************/
+void timer3_intEnable(uint8_t priority)
+{
+    IPR2bits.TMR3IP = priority; // Pg 109.
+    PIR2bits.TMR3IF = 0;
+    PIE2bits.TMR3IE = 1;         // 1 = Enables the TMR3 overflow interrupt. Pg 108.
+}
+// end of void timer3_intEnable(uint8_t priority)
@@ -19,6 +19,10 @@
  * _______________________________________________________________________________________
  * Date:          | Author:               | Description:                                                             | Version:
  * 04/22/2022 | Antonio Castilho  | Created                                                                    | 00.00.01
+ * 10/19/2026 | Antonio Castilho  | Interrupt priorities and drift-free reload                      | 00.00.02
+ * 10/19/2026 | Antonio Castilho  | Prescaler and preload calculated at compile time            | 00.00.03
+ * 10/19/2026 | Antonio Castilho  | Solver in Fcy units of 15625/4 Hz, clocks below 4 MHz       | 00.00.04
+ * 10/19/2026 | Antonio Castilho  | Reload latency added to the preload                             | 00.00.05
  *________________________________________________________________________________________
  */
 #ifndef TIMER_H
@@ -32,17 +36,150 @@
 #endif                                        // see fuse_bits.h and config.h
 
 
+/****************************************************************************************
+ * Desired periods, in microseconds. Can be defined before including timer.h.
+ ****************************************************************************************/
+#ifndef TIMER0_PERIOD_US
+    #define TIMER0_PERIOD_US    500000UL   // 500 ms.
+#endif
+#ifndef TIMER1_PERIOD_US
+    #define TIMER1_PERIOD_US    125000UL   // 125 ms.
+#endif
+#ifndef TIMER2_PERIOD_US
+    #define TIMER2_PERIOD_US    1000UL     // 1 ms.
+#endif
+#ifndef TIMER3_PERIOD_US
+    #define TIMER3_PERIOD_US    250000UL   // 250 ms.
+#endif
+
+/****************************************************************************************
+ * Compile-time solver: prescaler, postscaler and preload for a period T in microseconds.
+ *              Count = T * Fcy / Prescale;         Fcy = _XTAL_FREQ / 4.
+ *              TMRx = 65536 - Count;               (TIMER0, TIMER1, TIMER3)
+ *              PR2 = Count / Postscale - 1;         (TIMER2)
+ * The smallest prescaler that reaches the period is chosen (best resolution). The count is
+ * rounded to the nearest integer. A period that the timer cannot reach stops the build with
+ * an error in the TIMER_ASSERT() line.
+ * Fcy is used in units of 15625 / 4 Hz, so every clock of the PIC18F4550 is exact (INTRC
+ * 31.25 kHz gives Fcy = 7812.5 Hz) and the products fit in 32 bits (XC8 has no 64 bits):
+ *              T * Fcy = T[us] * (_XTAL_FREQ / 15625) / 256 cycles.
+ ****************************************************************************************/
+#define TIMER_FOSC_K            ((uint32_t)(_XTAL_FREQ / 15625UL))
+#define TIMER_CYC256(us)        ((uint32_t)(us) * TIMER_FOSC_K)   // 256 * cycles of T.
+// Count = cycles / d, rounded to the nearest integer (d = prescale * postscale).
+#define TIMER_COUNT(us, d)      (((TIMER_CYC256(us) / (128UL * (d))) + 1UL) / 2UL)
+// 1 when the rounded count fits in top with the prescale ps.
+#define TIMER_FITS(us, top, ps) (TIMER_CYC256(us) < ((top) * 256UL + 128UL) * (ps))
+
+// Compilation error (array of negative size) when the condition is false.
+#define TIMER_ASSERT(cond, name)    typedef char name[(cond) ? 1 : -1]
+
+// TIMER0, 16 bits. Prescale 1 (PSA = 1), 2 ... 256.
+#define TIMER0_PS(us)       (TIMER_FITS(us, 65536UL, 1UL) ? 1UL : \
+                             TIMER_FITS(us, 65536UL, 2UL) ? 2UL : \
+                             TIMER_FITS(us, 65536UL, 4UL) ? 4UL : \
+                             TIMER_FITS(us, 65536UL, 8UL) ? 8UL : \
+                             TIMER_FITS(us, 65536UL, 16UL) ? 16UL : \
+                             TIMER_FITS(us, 65536UL, 32UL) ? 32UL : \
+                             TIMER_FITS(us, 65536UL, 64UL) ? 64UL : \
+                             TIMER_FITS(us, 65536UL, 128UL) ? 128UL : 256UL)
+#define TIMER0_T0PS(us)     (TIMER0_PS(us) <= 2UL ? 0 : TIMER0_PS(us) == 4UL ? 1 : \
+                             TIMER0_PS(us) == 8UL ? 2 : TIMER0_PS(us) == 16UL ? 3 : \
+                             TIMER0_PS(us) == 32UL ? 4 : TIMER0_PS(us) == 64UL ? 5 : \
+                             TIMER0_PS(us) == 128UL ? 6 : 7)
+#define TIMER0_PSA(us)      (TIMER0_PS(us) == 1UL ? 1 : 0)
+#define TIMER0_COUNT(us)    TIMER_COUNT(us, TIMER0_PS(us))
+#define TIMER0_MAX_US       (0xFFFFFFFFUL / TIMER_FOSC_K)     // 256 * 65536 cycles.
+
+// TIMER1 and TIMER3, 16 bits. Prescale 1, 2, 4 or 8.
+#define TIMER13_PS(us)      (TIMER_FITS(us, 65536UL, 1UL) ? 1UL : \
+                             TIMER_FITS(us, 65536UL, 2UL) ? 2UL : \
+                             TIMER_FITS(us, 65536UL, 4UL) ? 4UL : 8UL)
+#define TIMER13_CKPS(us)    (TIMER13_PS(us) == 1UL ? 0 : TIMER13_PS(us) == 2UL ? 1 : \
+                             TIMER13_PS(us) == 4UL ? 2 : 3)
+#define TIMER13_COUNT(us)   TIMER_COUNT(us, TIMER13_PS(us))
+#define TIMER13_MAX_US      (134217728UL / TIMER_FOSC_K)      // 8 * 65536 cycles.
+
+// TIMER2, 8 bits with period register. Prescale 1, 4 or 16; postscale 1 to 16.
+#define TIMER2_PS(us)       (TIMER_CYC256(us) <= 1048576UL ? 1UL : \
+                             TIMER_CYC256(us) <= 4194304UL ? 4UL : 16UL)
+#define TIMER2_CKPS(us)     (TIMER2_PS(us) == 1UL ? 0 : TIMER2_PS(us) == 4UL ? 1 : 2)
+#define TIMER2_POST(us)     ((TIMER_CYC256(us) + 65536UL * TIMER2_PS(us) - 1) / (65536UL * TIMER2_PS(us)))
+#define TIMER2_PR2(us)      (TIMER_COUNT(us, TIMER2_PS(us) * TIMER2_POST(us)) - 1)
+#define TIMER2_MAX_US       (16777216UL / TIMER_FOSC_K)       // 16 * 16 * 256 cycles.
+
+// The shortest period: the count rounds to 1.
+#define TIMER_MIN_US        ((128UL + TIMER_FOSC_K - 1) / TIMER_FOSC_K)
+
+/****************************************************************************************
+ * Values used by timerx_ini() and timerx_reload().
+ ****************************************************************************************/
+#define TIMER0_PRELOAD      ((uint16_t)(65536UL - TIMER0_COUNT(TIMER0_PERIOD_US)))
+#define TIMER0_PRESCALE     TIMER0_T0PS(TIMER0_PERIOD_US)
+#define TIMER0_NO_PRESCALE  TIMER0_PSA(TIMER0_PERIOD_US)
+#define TIMER1_PRELOAD      ((uint16_t)(65536UL - TIMER13_COUNT(TIMER1_PERIOD_US)))
+#define TIMER1_PRESCALE     TIMER13_CKPS(TIMER1_PERIOD_US)
+#define TIMER2_PERIOD       ((uint8_t)TIMER2_PR2(TIMER2_PERIOD_US)) // PR2, Timer2 resets itself on the match.
+#define TIMER2_PRESCALE     TIMER2_CKPS(TIMER2_PERIOD_US)
+#define TIMER2_POSTSCALE    ((uint8_t)(TIMER2_POST(TIMER2_PERIOD_US) - 1)) // T2OUTPS<3:0>.
+#define TIMER3_PRELOAD      ((uint16_t)(65536UL - TIMER13_COUNT(TIMER3_PERIOD_US)))
+#define TIMER3_PRESCALE     TIMER13_CKPS(TIMER3_PERIOD_US)
+
+/****************************************************************************************
+ * Reload latency: the timer goes on counting from the read of TMRxL to the write of TMRxL
+ * in timerx_reload(), and TMR0 stops for 2 Tcy after a write (pg 125). These counts are
+ * added to the preload, so they are not lost at each period.
+ * TIMER_RELOAD_TCY - Tcy from the read to the write:
+ *      XC8: 13, counted on the instructions of the lines of timerx_reload() (MOVFF, CLRF,
+ *           MOVF, IORWF, MOVLW, ADDWF, MOVLW, ADDWFC, MOVFF, MOVFF) without bank changes;
+ *           measure it with the stopwatch of MPLAB X, and define it before timer.h, when
+ *           the compiler or its optimization changes;
+ *      register model of tools/host: 3, one per access, measured by tests/timer_reload.c.
+ * With a prescaler the latency is rounded to whole counts.
+ ****************************************************************************************/
+#ifndef TIMER_RELOAD_TCY
+    #if defined(__XC8)
+        #define TIMER_RELOAD_TCY    13UL
+    #else
+        #define TIMER_RELOAD_TCY    3UL
+    #endif
+#endif
+#define TIMER_LATENCY(tcy, ps)  (((tcy) + (ps) / 2UL) / (ps))
+#define TIMER0_RELOAD_LATENCY   TIMER_LATENCY(TIMER_RELOAD_TCY + 2UL, TIMER0_PS(TIMER0_PERIOD_US))
+#define TIMER1_RELOAD_LATENCY   TIMER_LATENCY(TIMER_RELOAD_TCY, TIMER13_PS(TIMER1_PERIOD_US))
+#define TIMER3_RELOAD_LATENCY   TIMER_LATENCY(TIMER_RELOAD_TCY, TIMER13_PS(TIMER3_PERIOD_US))
+
+// Fosc from 15625 Hz: INTRC 31.25 kHz, INTOSC 125 kHz to 8 MHz, any whole MHz crystal, PLL 48 MHz.
+TIMER_ASSERT(_XTAL_FREQ >= 15625UL && _XTAL_FREQ % 15625UL == 0, timer_fosc_must_be_multiple_of_15625hz);
+TIMER_ASSERT(TIMER0_PERIOD_US >= TIMER_MIN_US && TIMER0_PERIOD_US <= TIMER0_MAX_US, timer0_period_unreachable);
+TIMER_ASSERT(TIMER1_PERIOD_US >= TIMER_MIN_US && TIMER1_PERIOD_US <= TIMER13_MAX_US, timer1_period_unreachable);
+TIMER_ASSERT(TIMER2_PERIOD_US >= TIMER_MIN_US && TIMER2_PERIOD_US <= TIMER2_MAX_US, timer2_period_unreachable);
+TIMER_ASSERT(TIMER3_PERIOD_US >= TIMER_MIN_US && TIMER3_PERIOD_US <= TIMER13_MAX_US, timer3_period_unreachable);
+
+// Interrupt priority, used with RCONbits.IPEN = 1.
+#define TIMER_PRIO_LOW      0
+#define TIMER_PRIO_HIGH     1
+
+void timer_interrupts_ini(void);
+
 void timer0_ini();
 void timer0_write(uint16_t timer_value);
+void timer0_reload(void);
+void timer0_intEnable(uint8_t priority);
 
 void timer1_ini();
 void timer1_write(uint16_t timer_value);
+void timer1_reload(void);
+void timer1_intEnable(uint8_t priority);
 
 void timer2_ini();
 void timer2_write(uint16_t timer_value);
+void timer2_intEnable(uint8_t priority);
 
 void timer3_ini();
 void timer3_write(uint16_t timer_value);
+void timer3_reload(void);
+void timer3_intEnable(uint8_t priority);
 
 #endif	/* TIMER_H */
 
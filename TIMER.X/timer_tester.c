@@ -2,23 +2,124 @@
  * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
  * Description:
  *      This program tests the TIMER settings.
+ *      TIMER0 is served by the high priority interrupt; TIMER1 and TIMER2 by the low priority
+ *      one. TIMER2 is the 1 ms tick of the software timers (swtimer.c).
+ *      TIMER3 is the 32-bit time base (timebase.c): each falling edge on RC1 (CCP2) is time
+ *      stamped and toggles LED4; the time between two edges is kept in edge_interval_us.
+ *      The interrupts only post events (event.c), one queue per priority level; the LEDs are
+ *      toggled by the main loop.
+ *      With no work left the main loop rests in IDLE until the next interrupt (power.c); the
+ *      health task clears the WDT every second if TIMER0 and TIMER1 are alive, and keeps the
+ *      time at rest in rest_percent.
  *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
  * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
  * _______________________________________________________________________________________
  * Date:          | Author:               | Description:                                                             | Version:
  * 04/22/2022 | Antonio Castilho  | Created                                                                    | 00.00.01
+ * 10/19/2026 | Antonio Castilho  | Timers served by high and low priority interrupts          | 00.00.02
+ * 10/19/2026 | Antonio Castilho  | TIMER3 as 32-bit time base with CCP2 capture                | 00.00.03
+ * 10/19/2026 | Antonio Castilho  | Timer overflows posted as events to the main loop        | 00.00.04
+ * 10/19/2026 | Antonio Castilho  | IDLE between interrupts, WDT served by a health task     | 00.00.05
  *________________________________________________________________________________________
  */
 
 #include <xc.h>
 #include "timer.h"
+#include "swtimer.h"
+#include "timebase.h"
+#include "event.h"
+#include "power.h"
 #include "fuse_bits.h"
 #include "lcd.h"
 
+#define SWT_LED5        0  // Software timer of LED5.
+#define SWT_LED3        1  // Software timer of LED3.
+#define SWT_HEALTH      2  // Software timer of the health task.
+
+#define TASK_TIMER0     0x01 // Tasks watched by the health task.
+#define TASK_TIMER1     0x02
+
+volatile uint32_t edge_interval_us; // Time between the last two edges on RC1.
+volatile uint8_t rest_percent;      // Time in IDLE since the start, %.
+volatile uint8_t wdt_reset;         // The last reset was caused by the WDT.
+
+EVENT_QUEUE(events_high, 4); // Posted by isr_high.
+EVENT_QUEUE(events_low, 4);  // Posted by isr_low.
+
+/****************************************************************************************
+ * Software timer callbacks, executed in the main loop by swtimer_task().
+ ****************************************************************************************/
+static void led5_toggle(void)
+{
+    LATBbits.LATB5 = (uint8_t)(~PORTBbits.RB5);
+}
+
+static void led3_toggle(void)
+{
+    LATBbits.LATB3 = (uint8_t)(~PORTBbits.RB3);
+}
+
+static void health_task(void)
+{
+    power_health(); // CLRWDT only if TIMER0 and TIMER1 reported since the last second.
+    rest_percent = power_getPercent();
+}
+
+/****************************************************************************************
+ * static uint8_t main_busy(void);
+ * Work for the main loop, checked by power_idle() with the interrupts masked.
+ ****************************************************************************************/
+static uint8_t main_busy(void)
+{
+    return (uint8_t)(event_count(&events_high) || event_count(&events_low) || swtimer_pending());
+}
+
+/****************************************************************************************
+ * void __interrupt(high_priority) isr_high(void);
+ * TIMER0 overflow. An overflow (TMR0IF = 1) will be generated every 500 ms. As the LED will
+ * change state every TMR0IF event, it will be 500 ms on and 500 ms off: 1 Hz.
+ ****************************************************************************************/
+void __interrupt(high_priority) isr_high(void)
+{
+    timebase_isr(); // TIMER3 overflow and CCP2 capture.
+
+    if(INTCONbits.TMR0IE && INTCONbits.TMR0IF)
+    {
+        INTCONbits.TMR0IF = 0; // the TMR0IF bit must be cleared in software; pg 129.
+        timer0_reload();
+        event_post(&events_high, EVENT_TIMER, 0, 0);
+    }
+}
+
+/****************************************************************************************
+ * void __interrupt(low_priority) isr_low(void);
+ * TIMER1 (LED6, 125 ms) and TIMER2 (software timers tick).
+ ****************************************************************************************/
+void __interrupt(low_priority) isr_low(void)
+{
+    if(PIE1bits.TMR1IE && PIR1bits.TMR1IF)
+    {
+        PIR1bits.TMR1IF = 0;
+        timer1_reload();
+        event_post(&events_low, EVENT_TIMER, 1, 0);
+    }
+
+    if(PIE1bits.TMR2IE && PIR1bits.TMR2IF)
+    {
+        PIR1bits.TMR2IF = 0; // TIMER2 restarts by itself at the PR2 match, no reload.
+        swtimer_tick();
+        power_tick();
+    }
+}
+
 void main(void) 
 {
-    uint8_t tmer0_l = 0;
-    uint8_t tmer0_h = 0;
+    uint32_t edge_stamp = 0;         // Time stamp of the last edge on RC1, in ticks.
+    uint32_t edge_previous = 0;
+    event_t event;
+
+    power_ini(POWER_IDLE); // Before anything clears the WDT: keeps the cause of the reset.
+    wdt_reset = power_wdtReset();
 
     lcd_wellcome();
     
@@ -30,54 +131,56 @@ void main(void)
     LATBbits.LATB7 = 1; // Turn the LED7 of FATEC board as off.
     TRISBbits.TRISB6 = 0; // Set as digital output. To check the operation of TIMER1.
     LATBbits.LATB6 = 1; // Turn the LED6 of FATEC board as off.
-    TRISBbits.TRISB5 = 0; // Set as digital output. To check the operation of TIMER2.
+    TRISBbits.TRISB5 = 0; // Set as digital output. To check the operation of the software timers.
     LATBbits.LATB5 = 1; // Turn the LED6 of FATEC board as off.
-    TRISBbits.TRISB4 = 0; // Set as digital output. To check the operation of TIMER3.
+    TRISBbits.TRISB4 = 0; // Set as digital output. To check the CCP2 captures.
     LATBbits.LATB4 = 1; // Turn the LED6 of FATEC board as off.    
+    TRISBbits.TRISB3 = 0; // Set as digital output. To check the operation of the software timers.
+    LATBbits.LATB3 = 1; // Turn the LED3 of FATEC board as off.
     
+    swtimer_ini();
+    swtimer_start(SWT_LED5, 500, 500, led5_toggle); // LED5: 500 ticks on, 500 ticks off.
+    swtimer_start(SWT_LED3, 100, 100, led3_toggle); // LED3: 100 ticks on, 100 ticks off.
+    swtimer_start(SWT_HEALTH, 1000, 1000, health_task); // Every second.
+    power_watch(TASK_TIMER0 | TASK_TIMER1);
+
     timer0_ini(); // Set TIMER0 
     timer1_ini(); // Set Timer1
     timer2_ini(); // Set Timer2
-    timer3_ini();
+    timebase_ini(); // TIMER3 as time base.
+    timebase_captureIni(2, TIMEBASE_FALLING); // Time stamps of the edges on RC1.
+    
+    timer0_intEnable(TIMER_PRIO_HIGH);
+    timer1_intEnable(TIMER_PRIO_LOW);
+    timer2_intEnable(TIMER_PRIO_LOW);
+    timer_interrupts_ini();
     
     while(1)
     {
-        if(INTCONbits.TMR0IF == 1)
-        {
-            LATBbits.LATB7 = (uint8_t)(~PORTBbits.RB7);
-            INTCONbits.TMR0IF = 0; // the TMR0IF bit must be cleared in software; pg 129.
-            timer0_write(3035);  // 0x; Loads the Timer preload value to 500 ms.
-            
-            /* An overflow (TMR0IF = 1) will be generated every 500 ms. As the LED will change 
-             * state every TMR0IF, it will be 500 ms on and 500 ms off. Therefore, a frequency 
-             * of 1 Hz with a period of 1 s.
-             */
-        }
-        
-        if(PIR1bits.TMR1IF == 1)
+        while(event_get(&events_high, &event) || event_get(&events_low, &event))
         {
-            LATBbits.LATB6 = (uint8_t)(~PORTBbits.RB6);
-            PIR1bits.TMR1IF = 0;
-            timer1_write(3035);  // 0x0BDB; Loads the Timer preload value to 125 ms.            
-            /* The LED will change state every 125 ms. Frequency 4 Hz. Period 250 ms. */
+            if(event.type != EVENT_TIMER) continue;
+            if(event.arg == 0)
+            {
+                LATBbits.LATB7 = (uint8_t)(~PORTBbits.RB7); // TIMER0, LED7.
+                power_alive(TASK_TIMER0);
+            }
+            if(event.arg == 1)
+            {
+                LATBbits.LATB6 = (uint8_t)(~PORTBbits.RB6); // TIMER1, LED6.
+                power_alive(TASK_TIMER1);
+            }
         }
-        
-        if(PIR1bits.TMR2IF == 1)
-        {
-            LATBbits.LATB5 = (uint8_t)(~PORTBbits.RB5);
-            PIR1bits.TMR2IF = 0; 
-            timer2_write(130);  // 0x0BDB; Loads the Timer preload value to 1 ms.
-            /* Frequency 500 Hz, Period 2 ms*/
-        }
-        
-         if(PIR2bits.TMR3IF == 1)
+
+        swtimer_task(); // Callbacks of the software timers that have expired.
+
+        if(timebase_captureGet(2, &edge_stamp))
         {
+            edge_interval_us = ticks_to_us(edge_stamp - edge_previous);
+            edge_previous = edge_stamp;
             LATBbits.LATB4 = (uint8_t)(~PORTBbits.RB4);
-            PIR2bits.TMR3IF = 0; // the TMR0IF bit must be cleared in software; pg 129.
-            timer3_write(3035);  // 0x; Loads the Timer preload value to 250 ms.
-            /* Frequency 2 Hz, Period 500 ms*/
         }
-        
-        // TODO Implement interrupts to verify TIMER operation
+
+        power_idle(main_busy); // IDLE until the next interrupt (TIMER2 every 1 ms at most).
     }
 }
@@ -0,0 +1,73 @@
+/* ****************************************************************************
+ * Project: Control Functions             File adc.c                 March/2022
+ * ****************************************************************************
+ * File description:       
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * * Program Archive for the Advanced Topics Course in Microcontroller 
+ *   Programming, Technology Colleges In Automotive Electronics, 
+ *   FATEC Santo Andr. Professor Wesley Medeiros Torres.
+ *   <http://www.fatecsantoandre.edu.br/>.
+ * * MicroChip Developer Help sample program files. 
+ *   <https://microchipdeveloper.com/>.
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 04/16/2022| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | One source in common/, ADC_CHANNELS (AN0 up to AN3)
+ ******************************************************************************/ 
+#include <xc.h>
+#include "adc.h"
+
+/******************************************************************************
+ * Function: void adc_ini();
+ * Description: The function starts analog channels.
+ * Example: adc_ini(); // Channels AN0 .. AN(ADC_CHANNELS - 1), see adc.h.
+ * Input: void
+ * Output: void
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 03/22/2022| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Channels of ADC_CHANNELS
+ ******************************************************************************/
+void adc_ini(void)
+{
+    // Configure Port A as input, according to the channels that will be needed.
+    TRISA = (uint8_t)((1u << ADC_CHANNELS) - 1);  // RA0 .. RA3: AN0 .. AN3.
+    ADCON1 = (uint8_t)(0x0F - ADC_CHANNELS);      // PCFG: AN0 .. AN(ADC_CHANNELS - 1). Pg 262.
+    ADCON2 = 0xBE; // Right Justified, 4Tad and Fosc/32. Pg 263.
+    ADCON0bits.ADON = 1;
+    ADRESH=0;	   // Flush ADC output Register. Pg 261.
+    ADRESL=0;
+}
+/* end of function void adc_ini(void)
+*******************************************************************************/
+
+/*******************************************************************************
+ * Function: int16_t adc_read(uint8_t channel)
+ * Description: Read the channel.
+ * Input: Channel number.
+ * Output: Value read between 0 and 1023, for 5V reference voltage.
+ * Created in: 03/22/2022 by Antonio Aparecido Ariza Castilho
+ ******************************************************************************/
+uint16_t adc_read(uint8_t ch)
+{
+    uint16_t value;
+    
+    ADCON0bits.CHS = ch; // selects the channel to be read.
+    ADCON0bits.GO = 1;   // start conversion.
+    while(ADCON0bits.GO_DONE == 1); // wait for the conversion.
+    value = (uint16_t)((ADRESH * 256) + ADRESL);
+    return value;
+}
+/* end of function uint16_t adc_read(uint8_t ch)
+*******************************************************************************/
\ No newline at end of file
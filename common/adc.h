@@ -0,0 +1,54 @@
+/* ****************************************************************************
+ * Project: Control Functions             File adc.h                 March/2022
+ * ****************************************************************************
+ * File description:       
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * * Program Archive for the Advanced Topics Course in Microcontroller 
+ *   Programming, Technology Colleges In Automotive Electronics, 
+ *   FATEC Santo Andr. Professor Wesley Medeiros Torres.
+ *   <http://www.fatecsantoandre.edu.br/>.
+ * * MicroChip Developer Help sample program files. 
+ *   <https://microchipdeveloper.com/>.
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 04/16/2022| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | One source in common/, ADC_CHANNELS (AN0 up to AN3)
+ ******************************************************************************/ 
+
+#ifndef ADC_H
+#define	ADC_H
+
+/******************************************************************************/
+// Include header files.
+/******************************************************************************/
+#include <xc.h>
+#include <stdlib.h>
+#include <math.h>
+// Board constants: from the adc.h of the project, which includes this file.
+
+/******************************************************************************/
+// Channels AN0 .. AN(ADC_CHANNELS - 1), on RA0 .. RA3. Default 1 (AN0).
+/******************************************************************************/
+#ifndef ADC_CHANNELS
+    #define ADC_CHANNELS    1
+#endif
+typedef char adc_channels_check[(ADC_CHANNELS >= 1 && ADC_CHANNELS <= 4) ? 1 : -1];
+
+/******************************************************************************/
+// Function prototypes
+/******************************************************************************/
+void adc_ini(void);
+uint16_t adc_read(uint8_t ch);
+/******************************************************************************/
+#endif	/* ADC_H */
+
@@ -0,0 +1,240 @@
+/* ****************************************************************************
+ * Project: Control Functions             File debounce.c                October/2026
+ * ****************************************************************************
+ * File description: Debounce of all the buttons with vertical counters. See
+ *     debounce.h.
+ *     Vertical counter of one port, bit n for input n (i = sample differs from
+ *     the debounced state):
+ *         i = 0: ct1:ct0 = 11 (counter stopped);
+ *         i = 1: ct1:ct0 = 11 -> 10 -> 01 -> 00 -> 11, and at this last one the
+ *                state changes.
+ *     The events go through an event queue (event.c): the interrupt is the
+ *     producer, debounce_get() the consumer.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Queue of event.c
+ * 10/19/2026| Antonio Castilho  | One source in common/ for Bouncing.X and StepperMotor.X
+ ******************************************************************************/
+
+#include <xc.h>
+#include "debounce.h"
+
+#define LONG_TICKS      (DEBOUNCE_LONG_MS / DEBOUNCE_TICK_MS)
+#define REPEAT_TICKS    (DEBOUNCE_REPEAT_MS / DEBOUNCE_TICK_MS)
+
+typedef struct
+{
+    uint8_t state;  // Debounced, 1 = pressed.
+    uint8_t ct0;    // Vertical counter, low bits.
+    uint8_t ct1;    // Vertical counter, high bits.
+} debounce_port_t;
+
+#if DEBOUNCE_PORTB_MASK
+static debounce_port_t port_b;
+#endif
+static debounce_port_t port_e;
+static uint16_t hold_ticks; // Ticks with some button held since the last press.
+
+EVENT_QUEUE(debounce_events, DEBOUNCE_QUEUE);
+
+/******************************************************************************
+ * Function: static uint8_t debounce_port(debounce_port_t *port, uint8_t sample)
+ * Description: One sample of the 8 inputs of a port in the vertical counter.
+ * Input: counters of the port and the sample, 1 = pressed.
+ * Output: inputs whose debounced state changed.
+ ******************************************************************************/
+static uint8_t debounce_port(debounce_port_t *port, uint8_t sample)
+{
+    uint8_t i = port->state ^ sample;
+
+    port->ct0 = (uint8_t)~(port->ct0 & i);
+    port->ct1 = (uint8_t)(port->ct0 ^ (port->ct1 & i));
+    i &= port->ct0 & port->ct1;
+    port->state ^= i;
+    return i;
+}
+// end of function static uint8_t debounce_port(...)
+
+/******************************************************************************
+ * Function: static void debounce_post(uint8_t type, uint8_t keys, uint8_t key)
+ * Description: Puts one event in the queue for each bit set in keys. When the
+ * queue is full the event is lost and counted (debounce_getDrops()).
+ * Input: event type, inputs (bit 0 is key) and key of bit 0.
+ * Output: void
+ ******************************************************************************/
+static void debounce_post(uint8_t type, uint8_t keys, uint8_t key)
+{
+    for(; keys; keys >>= 1, key++)
+    {
+        if(keys & 0x01) event_post(&debounce_events, EVENT_KEY, (uint8_t)(type | key), 0);
+    }
+}
+// end of function static void debounce_post(...)
+
+/******************************************************************************
+ * Function: void debounce_ini(void)
+ * Description: Inputs of the masks, state taken from the pins (a button held
+ * at the start gives no DEBOUNCE_PRESS), TIMER0 tick in low priority.
+ * RE0:RE2 must be digital (ADCON1, see adc_ini()). The program must call
+ * debounce_isr() in isr_low and enable the interrupts (IPEN, GIEH, GIEL).
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void debounce_ini(void)
+{
+#if DEBOUNCE_PORTB_MASK
+    TRISB |= DEBOUNCE_PORTB_MASK;
+    INTCON2bits.RBPU = 0; // PORTB pull-ups. Pg 113.
+    port_b.state = (uint8_t)(~PORTB & DEBOUNCE_PORTB_MASK);
+    port_b.ct0 = 0xFF;
+    port_b.ct1 = 0xFF;
+#endif
+    TRISE |= DEBOUNCE_PORTE_MASK;
+    port_e.state = (uint8_t)(~PORTE & DEBOUNCE_PORTE_MASK);
+    port_e.ct0 = 0xFF;
+    port_e.ct1 = 0xFF;
+
+    hold_ticks = 0;
+    event_flush(&debounce_events);
+
+    T0CON = 0x44; // 0b01000100 TMR0 off, 8-bit, internal clock, prescale 1:32. Pg 121.
+    TMR0L = (uint8_t)(256 - DEBOUNCE_TMR0_COUNTS);
+    INTCON2bits.TMR0IP = 0;
+    INTCONbits.TMR0IF = 0;
+    INTCONbits.TMR0IE = 1;
+    T0CONbits.TMR0ON = 1;
+}
+// end of function void debounce_ini(void)
+
+/******************************************************************************
+ * Function: void debounce_tick(void)
+ * Description: One sample of all the inputs: updates the debounced states and
+ * puts the events in the queue. Called by debounce_isr() at each tick; can be
+ * called by another tick of 1 to 5 ms instead (TIMER0 then not needed).
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void debounce_tick(void)
+{
+    uint8_t changed;
+    uint8_t pressed = 0;
+    uint8_t held;
+
+#if DEBOUNCE_PORTB_MASK
+    changed = debounce_port(&port_b, (uint8_t)(~PORTB & DEBOUNCE_PORTB_MASK));
+    if(changed)
+    {
+        pressed = changed & port_b.state;
+        debounce_post(DEBOUNCE_PRESS, pressed, DEBOUNCE_KEY_RB(0));
+        debounce_post(DEBOUNCE_RELEASE, changed & (uint8_t)~port_b.state, DEBOUNCE_KEY_RB(0));
+    }
+#endif
+    changed = debounce_port(&port_e, (uint8_t)(~PORTE & DEBOUNCE_PORTE_MASK));
+    if(changed)
+    {
+        pressed |= changed & port_e.state;
+        debounce_post(DEBOUNCE_PRESS, changed & port_e.state, DEBOUNCE_KEY_RE(0));
+        debounce_post(DEBOUNCE_RELEASE, changed & (uint8_t)~port_e.state, DEBOUNCE_KEY_RE(0));
+    }
+
+    // Long press and repeat of the buttons held, counted from the last press.
+    held = port_e.state;
+#if DEBOUNCE_PORTB_MASK
+    held |= port_b.state;
+#endif
+    if(pressed || !held)
+    {
+        hold_ticks = 0;
+        return;
+    }
+    if(++hold_ticks == LONG_TICKS)
+    {
+        debounce_post(DEBOUNCE_LONG, port_e.state, DEBOUNCE_KEY_RE(0));
+#if DEBOUNCE_PORTB_MASK
+        debounce_post(DEBOUNCE_LONG, port_b.state, DEBOUNCE_KEY_RB(0));
+#endif
+    }
+    else if(hold_ticks == LONG_TICKS + REPEAT_TICKS)
+    {
+        debounce_post(DEBOUNCE_REPEAT, port_e.state, DEBOUNCE_KEY_RE(0));
+#if DEBOUNCE_PORTB_MASK
+        debounce_post(DEBOUNCE_REPEAT, port_b.state, DEBOUNCE_KEY_RB(0));
+#endif
+        hold_ticks = LONG_TICKS;
+    }
+}
+// end of function void debounce_tick(void)
+
+/******************************************************************************
+ * Function: uint8_t debounce_get(void)
+ * Description: Takes the oldest event of the queue, without waiting.
+ * Example: e = debounce_get();
+ *          if(e == (DEBOUNCE_PRESS | KEY_BTN_1)) ...
+ * Input: void
+ * Output: event (type | key), or DEBOUNCE_NONE if the queue is empty.
+ ******************************************************************************/
+uint8_t debounce_get(void)
+{
+    event_t event;
+
+    if(!event_get(&debounce_events, &event)) return DEBOUNCE_NONE;
+    return event.arg;
+}
+// end of function uint8_t debounce_get(void)
+
+/******************************************************************************
+ * Function: uint16_t debounce_getDrops(void)
+ * Description: Events lost because the queue was full.
+ * Input: void
+ * Output: events lost since the start.
+ ******************************************************************************/
+uint16_t debounce_getDrops(void)
+{
+    return event_drops(&debounce_events);
+}
+// end of function uint16_t debounce_getDrops(void)
+
+/******************************************************************************
+ * Function: uint8_t debounce_isPressed(uint8_t key)
+ * Description: Debounced state of one input.
+ * Input: key (DEBOUNCE_KEY_RB(n), DEBOUNCE_KEY_RE(n), KEY_BTN_x).
+ * Output: 1 pressed, 0 released.
+ ******************************************************************************/
+uint8_t debounce_isPressed(uint8_t key)
+{
+#if DEBOUNCE_PORTB_MASK
+    if(key < 8) return (uint8_t)((port_b.state >> key) & 0x01);
+#endif
+    if(key < 8) return 0;
+    return (uint8_t)((port_e.state >> (key - 8)) & 0x01);
+}
+// end of function uint8_t debounce_isPressed(uint8_t key)
+
+/******************************************************************************
+ * Function: void debounce_isr(void)
+ * Description: TIMER0 tick. TMR0L is advanced, not loaded, so the latency of
+ * the interrupt does not stretch the tick. Call it in isr_low.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void debounce_isr(void)
+{
+    if(INTCONbits.TMR0IE && INTCONbits.TMR0IF)
+    {
+        INTCONbits.TMR0IF = 0;
+        TMR0L += (uint8_t)(256 - DEBOUNCE_TMR0_COUNTS);
+        debounce_tick();
+    }
+}
+// end of function void debounce_isr(void)
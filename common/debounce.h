@@ -0,0 +1,87 @@
+/* ****************************************************************************
+ * Project: Control Functions             File debounce.h                October/2026
+ * ****************************************************************************
+ * File description: Debounce of all the buttons with vertical counters.
+ *     TIMER0 gives a tick of DEBOUNCE_TICK_MS; at each tick the inputs of
+ *     PORTB (DEBOUNCE_PORTB_MASK) and PORTE (DEBOUNCE_PORTE_MASK) are read at
+ *     once and each bit has a 2-bit counter kept "vertically": bit n of ct0 and
+ *     ct1 is the counter of input n, so the 8 inputs of a port are counted by a
+ *     few logic instructions, without loops. An input only changes state after
+ *     4 equal samples that differ from the state (4 ticks, 8 ms by default).
+ *     The buttons of the FATEC board close to GND: 0 on the pin is "pressed".
+ *
+ *     Events, put in a queue by the interrupt and read by debounce_get():
+ *         DEBOUNCE_PRESS    the button was pressed;
+ *         DEBOUNCE_RELEASE  the button was released;
+ *         DEBOUNCE_LONG     still pressed after DEBOUNCE_LONG_MS;
+ *         DEBOUNCE_REPEAT   still pressed, every DEBOUNCE_REPEAT_MS after the LONG.
+ *     Event byte: type (bits 7:4) | key (bits 3:0). Keys 0 to 7 are RB0 to RB7,
+ *     keys 8 to 15 are RE0 to RE7 (KEY_BTN_1 ... for the FATEC board).
+ *     The time of LONG and REPEAT is counted once for all the buttons held:
+ *     it starts again at each new press.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * * Dannegger, P. Debouncing 8 keys, sampling 4 times, with vertical
+ *   counters. AVR Freaks / mikrocontroller.net, 2004.
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Queue of event.c
+ * 10/19/2026| Antonio Castilho  | One source in common/ for Bouncing.X and StepperMotor.X
+ ******************************************************************************/
+
+#ifndef DEBOUNCE_H
+#define	DEBOUNCE_H
+
+#include <xc.h>
+#include "event.h"
+// _XTAL_FREQ: from the debounce.h of the project, which includes this file.
+
+#ifndef DEBOUNCE_PORTB_MASK
+    #define DEBOUNCE_PORTB_MASK 0x00 // PORTB inputs. LEDs on the FATEC board.
+#endif
+#ifndef DEBOUNCE_PORTE_MASK
+    #define DEBOUNCE_PORTE_MASK 0x07 // RE0:RE2, BTN_1 to BTN_3.
+#endif
+
+#define DEBOUNCE_TICK_MS    2    // 1 to 5 ms.
+#define DEBOUNCE_LONG_MS    800
+#define DEBOUNCE_REPEAT_MS  200
+#define DEBOUNCE_QUEUE      8    // Events, power of 2.
+
+// TIMER0 8-bit, prescale 1:32, counts of one tick. Pg 123.
+#define DEBOUNCE_TMR0_COUNTS ((_XTAL_FREQ / 4 / 32) * DEBOUNCE_TICK_MS / 1000)
+typedef char debounce_tick_check[(DEBOUNCE_TMR0_COUNTS >= 16 && DEBOUNCE_TMR0_COUNTS <= 256) ? 1 : -1];
+
+// Events.
+#define DEBOUNCE_NONE       0x00
+#define DEBOUNCE_PRESS      0x10
+#define DEBOUNCE_RELEASE    0x20
+#define DEBOUNCE_LONG       0x30
+#define DEBOUNCE_REPEAT     0x40
+
+#define DEBOUNCE_TYPE(event)    ((event) & 0xF0)
+#define DEBOUNCE_KEY(event)     ((event) & 0x0F)
+
+#define DEBOUNCE_KEY_RB(n)  (n)
+#define DEBOUNCE_KEY_RE(n)  (8 + (n))
+#define KEY_BTN_1           DEBOUNCE_KEY_RE(0)
+#define KEY_BTN_2           DEBOUNCE_KEY_RE(1)
+#define KEY_BTN_3           DEBOUNCE_KEY_RE(2)
+
+void debounce_ini(void);
+void debounce_tick(void);
+uint8_t debounce_get(void);
+uint8_t debounce_isPressed(uint8_t key);
+uint16_t debounce_getDrops(void);
+void debounce_isr(void);
+
+#endif	/* DEBOUNCE_H */
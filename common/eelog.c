@@ -0,0 +1,334 @@
+/* ****************************************************************************
+ * Project: Control Functions             File eelog.c                   October/2026
+ * ****************************************************************************
+ * File description: Log of records in the data EEPROM. See eelog.h.
+ *     Write of a record: eelog_write() fills record[] and calls eelog_next(),
+ *     which starts the write of the first byte that differs from the EEPROM;
+ *     at the end of each write (EEIF) eelog_isr() reads the byte back and
+ *     calls eelog_next() again, up to the check byte, written last.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet, Section 7.0 Data EEPROM Memory.
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | One source in common/ for ECTsensor.X and StepperMotor.X
+ ******************************************************************************/
+
+#include <xc.h>
+#include "eelog.h"
+
+#define EELOG_TRIES     3   // Writes of a byte before the record is given up.
+
+static uint8_t newest_slot;             // Slot of the newest record.
+static uint16_t newest_seq;             // Its seq.
+static uint8_t newest_valid;            // There is a record.
+static uint8_t newest_data[EELOG_DATA]; // Its data.
+
+static uint8_t record[EELOG_RECORD];    // Record being written.
+static uint8_t record_addr;             // EEPROM address of record[0].
+static volatile uint8_t record_index;   // Byte being written.
+static uint8_t record_tries;
+static volatile uint8_t record_busy;
+static uint16_t record_errors;          // Records given up.
+
+/******************************************************************************
+ * Function: static uint8_t eelog_readByte(uint8_t addr)
+ * Description: Reads one byte of the data EEPROM (one instruction cycle).
+ * Input: address, 0 to 255.
+ * Output: byte.
+ ******************************************************************************/
+static uint8_t eelog_readByte(uint8_t addr)
+{
+    EEADR = addr;
+    EECON1bits.EEPGD = 0; // Data EEPROM.
+    EECON1bits.CFGS = 0;
+    EECON1bits.RD = 1;
+    return EEDATA;
+}
+// end of function static uint8_t eelog_readByte(uint8_t addr)
+
+/******************************************************************************
+ * Function: static void eelog_writeByte(uint8_t addr, uint8_t data)
+ * Description: Starts the write of one byte (erase and write, about 4 ms) and
+ * returns; EEIF is set at the end. The 55h/AAh sequence must not be broken
+ * by an interrupt, so GIEH is cleared during it.
+ * Input: address and byte.
+ * Output: void
+ ******************************************************************************/
+static void eelog_writeByte(uint8_t addr, uint8_t data)
+{
+    uint8_t gieh = INTCONbits.GIEH;
+
+    EEADR = addr;
+    EEDATA = data;
+    EECON1bits.EEPGD = 0;
+    EECON1bits.CFGS = 0;
+    EECON1bits.WREN = 1;
+    PIR2bits.EEIF = 0;
+    INTCONbits.GIEH = 0;
+    EECON2 = 0x55;
+    EECON2 = 0xAA;
+    EECON1bits.WR = 1;
+    INTCONbits.GIEH = gieh;
+}
+// end of function static void eelog_writeByte(uint8_t addr, uint8_t data)
+
+/******************************************************************************
+ * Function: static uint8_t eelog_check(const uint8_t *bytes)
+ * Description: CRC-8 (x^8 + x^2 + x + 1, start 0xFF) of seq and data of a
+ * record. An erased slot (all 0xFF) or a cleared one (all 0x00) fails it.
+ * Input: record.
+ * Output: check byte.
+ ******************************************************************************/
+static uint8_t eelog_check(const uint8_t *bytes)
+{
+    uint8_t crc = 0xFF;
+    uint8_t i;
+    uint8_t bit;
+
+    for(i = 0; i < EELOG_RECORD - 1; i++)
+    {
+        crc ^= bytes[i];
+        for(bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+// end of function static uint8_t eelog_check(const uint8_t *bytes)
+
+/******************************************************************************
+ * Function: static uint8_t eelog_readSlot(uint8_t slot, uint8_t *bytes)
+ * Description: Reads a slot and tells if it holds a valid record.
+ * Input: slot, 0 to EELOG_SLOTS - 1, and buffer of EELOG_RECORD bytes.
+ * Output: 1 valid, 0 erased or cut.
+ ******************************************************************************/
+static uint8_t eelog_readSlot(uint8_t slot, uint8_t *bytes)
+{
+    uint8_t addr = (uint8_t)(EELOG_START + slot * EELOG_RECORD);
+    uint8_t i;
+
+    for(i = 0; i < EELOG_RECORD; i++) bytes[i] = eelog_readByte((uint8_t)(addr + i));
+    return (uint8_t)(eelog_check(bytes) == bytes[EELOG_RECORD - 1]);
+}
+// end of function static uint8_t eelog_readSlot(uint8_t slot, uint8_t *bytes)
+
+/******************************************************************************
+ * Function: static void eelog_next(void)
+ * Description: Starts the write of the next byte of record[] that differs
+ * from the EEPROM. With all of them equal the record is done.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+static void eelog_next(void)
+{
+    while(record_index < EELOG_RECORD)
+    {
+        if(eelog_readByte((uint8_t)(record_addr + record_index)) != record[record_index])
+        {
+            eelog_writeByte((uint8_t)(record_addr + record_index), record[record_index]);
+            return;
+        }
+        record_index++;
+        record_tries = 0;
+    }
+    EECON1bits.WREN = 0; // No write by mistake until the next record.
+    record_busy = 0;
+}
+// end of function static void eelog_next(void)
+
+/******************************************************************************
+ * Function: uint8_t eelog_ini(void)
+ * Description: Finds the newest record, reading each slot once, and enables
+ * the EEIF interrupt in low priority. The program must call eelog_isr() in
+ * isr_low and enable the interrupts (IPEN, GIEH, GIEL).
+ * Input: void
+ * Output: 1 if there is a record (eelog_read()), 0 if the log is empty.
+ ******************************************************************************/
+uint8_t eelog_ini(void)
+{
+    uint8_t bytes[EELOG_RECORD];
+    uint8_t slot;
+    uint8_t i;
+    uint16_t seq;
+
+    newest_valid = 0;
+    newest_slot = EELOG_SLOTS - 1; // The first record goes to slot 0.
+    newest_seq = 0xFFFF;           // With seq 0.
+    for(slot = 0; slot < EELOG_SLOTS; slot++)
+    {
+        if(!eelog_readSlot(slot, bytes)) continue;
+        seq = (uint16_t)(bytes[0] | ((uint16_t)bytes[1] << 8));
+        if(newest_valid && (int16_t)(seq - newest_seq) <= 0) continue;
+        newest_valid = 1;
+        newest_slot = slot;
+        newest_seq = seq;
+        for(i = 0; i < EELOG_DATA; i++) newest_data[i] = bytes[2 + i];
+    }
+
+    record_busy = 0;
+    record_errors = 0;
+    IPR2bits.EEIP = 0;
+    PIR2bits.EEIF = 0;
+    PIE2bits.EEIE = 1;
+    return newest_valid;
+}
+// end of function uint8_t eelog_ini(void)
+
+/******************************************************************************
+ * Function: uint8_t eelog_write(const void *data, uint8_t size)
+ * Description: Starts the write of a new record in the slot after the newest
+ * one and returns, without waiting. From here on eelog_read() gives this data.
+ * Input: data and its size (up to EELOG_DATA bytes, the rest is 0).
+ * Output: 1 started, 0 busy with the record before or the EEPROM with a write
+ * of another module (try again later).
+ ******************************************************************************/
+uint8_t eelog_write(const void *data, uint8_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint8_t giel;
+    uint8_t i;
+
+    if(record_busy || EECON1bits.WR) return 0; // Also a write of another module.
+    if(size > EELOG_DATA) size = EELOG_DATA;
+
+    newest_slot = (uint8_t)((newest_slot + 1 == EELOG_SLOTS) ? 0 : newest_slot + 1);
+    newest_seq++;
+    newest_valid = 1;
+    record[0] = (uint8_t)newest_seq;
+    record[1] = (uint8_t)(newest_seq >> 8);
+    for(i = 0; i < EELOG_DATA; i++)
+    {
+        newest_data[i] = (i < size) ? bytes[i] : 0;
+        record[2 + i] = newest_data[i];
+    }
+    record[EELOG_RECORD - 1] = eelog_check(record);
+    record_addr = (uint8_t)(EELOG_START + newest_slot * EELOG_RECORD);
+    record_index = 0;
+    record_tries = 0;
+    record_busy = 1;
+
+    giel = INTCONbits.GIEL; // eelog_isr() only after the first write is started.
+    INTCONbits.GIEL = 0;
+    eelog_next();
+    INTCONbits.GIEL = giel;
+    return 1;
+}
+// end of function uint8_t eelog_write(const void *data, uint8_t size)
+
+/******************************************************************************
+ * Function: uint8_t eelog_read(void *data, uint8_t size)
+ * Description: Data of the newest record (taken from RAM, no EEPROM access).
+ * Input: buffer and its size (up to EELOG_DATA bytes).
+ * Output: 1 read, 0 the log is empty.
+ ******************************************************************************/
+uint8_t eelog_read(void *data, uint8_t size)
+{
+    uint8_t *bytes = (uint8_t *)data;
+    uint8_t i;
+
+    if(!newest_valid) return 0;
+    if(size > EELOG_DATA) size = EELOG_DATA;
+    for(i = 0; i < size; i++) bytes[i] = newest_data[i];
+    return 1;
+}
+// end of function uint8_t eelog_read(void *data, uint8_t size)
+
+/******************************************************************************
+ * Function: uint8_t eelog_readOld(uint8_t age, void *data, uint8_t size)
+ * Description: Data of an older record of the log, read from the EEPROM.
+ * Input: age (0 newest, 1 the one before ... EELOG_SLOTS - 1), buffer and its
+ * size (up to EELOG_DATA bytes).
+ * Output: 1 read, 0 no such record or a record is being written.
+ ******************************************************************************/
+uint8_t eelog_readOld(uint8_t age, void *data, uint8_t size)
+{
+    uint8_t record_old[EELOG_RECORD];
+    uint8_t *bytes = (uint8_t *)data;
+    uint8_t slot;
+    uint8_t i;
+
+    if(record_busy || !newest_valid || age >= EELOG_SLOTS) return 0;
+    slot = (uint8_t)((newest_slot >= age) ? newest_slot - age : newest_slot + EELOG_SLOTS - age);
+    if(!eelog_readSlot(slot, record_old)) return 0;
+    if((uint16_t)(record_old[0] | ((uint16_t)record_old[1] << 8)) != (uint16_t)(newest_seq - age)) return 0;
+    if(size > EELOG_DATA) size = EELOG_DATA;
+    for(i = 0; i < size; i++) bytes[i] = record_old[2 + i];
+    return 1;
+}
+// end of function uint8_t eelog_readOld(uint8_t age, void *data, uint8_t size)
+
+/******************************************************************************
+ * Function: uint8_t eelog_isBusy(void)
+ * Description: Tells if a record is being written.
+ * Input: void
+ * Output: 1 writing, 0 idle.
+ ******************************************************************************/
+uint8_t eelog_isBusy(void)
+{
+    return record_busy;
+}
+// end of function uint8_t eelog_isBusy(void)
+
+/******************************************************************************
+ * Function: uint16_t eelog_getSeq(void)
+ * Description: seq of the newest record (records written since the log was
+ * erased, modulo 65536).
+ * Input: void
+ * Output: seq, 0xFFFF with the log empty.
+ ******************************************************************************/
+uint16_t eelog_getSeq(void)
+{
+    return newest_seq;
+}
+// end of function uint16_t eelog_getSeq(void)
+
+/******************************************************************************
+ * Function: uint16_t eelog_getErrors(void)
+ * Description: Records given up because a byte read back wrong EELOG_TRIES
+ * times (worn cell). At the next start the record before is the newest.
+ * Input: void
+ * Output: records given up since eelog_ini().
+ ******************************************************************************/
+uint16_t eelog_getErrors(void)
+{
+    return record_errors;
+}
+// end of function uint16_t eelog_getErrors(void)
+
+/******************************************************************************
+ * Function: void eelog_isr(void)
+ * Description: End of the write of a byte: reads it back and starts the next
+ * one (or the same one again). Call it in isr_low.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void eelog_isr(void)
+{
+    if(PIE2bits.EEIE && PIR2bits.EEIF)
+    {
+        PIR2bits.EEIF = 0;
+        if(!record_busy) return;
+        if(eelog_readByte((uint8_t)(record_addr + record_index)) == record[record_index])
+        {
+            record_index++;
+            record_tries = 0;
+        }
+        else if(++record_tries >= EELOG_TRIES)
+        {
+            record_errors++;
+            record_index = EELOG_RECORD; // The check byte is not written.
+        }
+        eelog_next();
+    }
+}
+// end of function void eelog_isr(void)
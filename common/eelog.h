@@ -0,0 +1,70 @@
+/* ****************************************************************************
+ * Project: Control Functions             File eelog.h                   October/2026
+ * ****************************************************************************
+ * File description: Log of records in the data EEPROM, kept across power cycles.
+ *     The area EELOG_START .. EELOG_START + EELOG_SIZE - 1 of the EEPROM is a
+ *     ring of slots of EELOG_RECORD bytes:
+ *         | seq low | seq high | data (EELOG_DATA bytes) | check |
+ *     seq grows by one at each record and check is a CRC-8 of seq and data.
+ *     Each new record goes to the slot after the newest one, so the writes are
+ *     spread over all the slots (wear leveling): a cell is written once every
+ *     EELOG_SLOTS records. Bytes equal to the ones in the EEPROM are not
+ *     written again.
+ *
+ *     eelog_ini() reads all the slots once and takes as the newest the valid
+ *     record of largest seq, compared as (int16_t)(a - b) > 0 so the wrap of
+ *     seq at 65535 does not matter. An erased slot (0xFF) or a record cut by a
+ *     power loss fails the check and is skipped: the record before it is
+ *     still the newest.
+ *
+ *     eelog_write() does not wait: it starts the first byte and returns. Each
+ *     byte takes about 4 ms; the EEIF interrupt (eelog_isr() in isr_low)
+ *     checks the byte written and starts the next one. While a record is
+ *     being written eelog_write() returns 0 and the program tries again later.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet, Section 7.0 Data EEPROM Memory.
+ * * Microchip AN1095, Emulating Data EEPROM for PIC18 and PIC24 (ring of
+ *   records with a sequence number).
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | One source in common/ for ECTsensor.X and StepperMotor.X
+ ******************************************************************************/
+
+#ifndef EELOG_H
+#define	EELOG_H
+
+#include <xc.h>
+#include <stdint.h>
+
+#ifndef EELOG_START
+    #define EELOG_START     0x00    // First byte of the log in the EEPROM.
+#endif
+#ifndef EELOG_SIZE
+    #define EELOG_SIZE      128     // Bytes; the rest of the 256 is free.
+#endif
+
+#define EELOG_RECORD    8                       // Bytes of a slot, power of 2.
+#define EELOG_DATA      (EELOG_RECORD - 3)      // Data bytes of a record.
+#define EELOG_SLOTS     (EELOG_SIZE / EELOG_RECORD)
+typedef char eelog_size_check[(EELOG_START + EELOG_SIZE <= 256 && EELOG_SLOTS >= 2
+                               && EELOG_SIZE % EELOG_RECORD == 0) ? 1 : -1];
+
+uint8_t eelog_ini(void);
+uint8_t eelog_write(const void *data, uint8_t size);
+uint8_t eelog_read(void *data, uint8_t size);
+uint8_t eelog_readOld(uint8_t age, void *data, uint8_t size);
+uint8_t eelog_isBusy(void);
+uint16_t eelog_getSeq(void);
+uint16_t eelog_getErrors(void);
+void eelog_isr(void);
+
+#endif	/* EELOG_H */
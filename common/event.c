@@ -0,0 +1,121 @@
+/* ****************************************************************************
+ * Project: Control Functions             File event.c                   October/2026
+ * ****************************************************************************
+ * File description: Event queues from the interrupts to the main loop. See
+ *     event.h.
+ *     One slot is always left empty: head == tail is empty and
+ *     head + 1 == tail is full, so each side needs only its own index.
+ *     XC8 duplicates event_post() when it is called from both interrupt
+ *     levels (warning 1510), each copy with its own compiled stack.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | One source in common/ for Bouncing.X, CANet.X,
+ *           |                   | StepperMotor.X and TIMER.X
+ ******************************************************************************/
+
+#include <xc.h>
+#include "event.h"
+
+/******************************************************************************
+ * Function: uint8_t event_post(event_queue_t *queue, uint8_t type, uint8_t arg,
+ *                              uint16_t data)
+ * Description: Puts one event at the head of the queue. Producer side: call
+ * it from one interrupt level only. The slot is filled before head moves, so
+ * the main loop never sees a slot that is being written.
+ * Input: queue, event type (EVENT_xxx), arg and data of the event.
+ * Output: 1 if queued, 0 if the queue is full (the event is counted in drops).
+ ******************************************************************************/
+uint8_t event_post(event_queue_t *queue, uint8_t type, uint8_t arg, uint16_t data)
+{
+    uint8_t head = queue->head;
+    uint8_t next = (uint8_t)((head + 1) & queue->mask);
+
+    if(next == queue->tail)
+    {
+        queue->drops++;
+        return 0;
+    }
+    queue->buffer[head].type = type;
+    queue->buffer[head].arg = arg;
+    queue->buffer[head].data = data;
+    queue->head = next;
+    return 1;
+}
+// end of function uint8_t event_post(...)
+
+/******************************************************************************
+ * Function: uint8_t event_get(event_queue_t *queue, event_t *event)
+ * Description: Takes the oldest event of the queue, without waiting. Consumer
+ * side: call it from the main loop only. The slot is copied before tail
+ * moves, so the interrupt never writes a slot that is being read.
+ * Example: while(event_get(&events, &e)) ...
+ * Input: queue and the event to be filled.
+ * Output: 1 if an event was taken, 0 if the queue is empty.
+ ******************************************************************************/
+uint8_t event_get(event_queue_t *queue, event_t *event)
+{
+    uint8_t tail = queue->tail;
+
+    if(tail == queue->head) return 0;
+    event->type = queue->buffer[tail].type;
+    event->arg = queue->buffer[tail].arg;
+    event->data = queue->buffer[tail].data;
+    queue->tail = (uint8_t)((tail + 1) & queue->mask);
+    return 1;
+}
+// end of function uint8_t event_get(event_queue_t *queue, event_t *event)
+
+/******************************************************************************
+ * Function: uint8_t event_count(const event_queue_t *queue)
+ * Description: Events waiting in the queue (can grow while it is read).
+ * Input: queue
+ * Output: number of events.
+ ******************************************************************************/
+uint8_t event_count(const event_queue_t *queue)
+{
+    return (uint8_t)((queue->head - queue->tail) & queue->mask);
+}
+// end of function uint8_t event_count(const event_queue_t *queue)
+
+/******************************************************************************
+ * Function: uint16_t event_drops(const event_queue_t *queue)
+ * Description: Events lost because the queue was full. The counter has two
+ * bytes written by the interrupt, so it is read until two readings agree.
+ * Input: queue
+ * Output: events lost since the start.
+ ******************************************************************************/
+uint16_t event_drops(const event_queue_t *queue)
+{
+    uint16_t drops;
+
+    do
+    {
+        drops = queue->drops;
+    } while(drops != queue->drops);
+    return drops;
+}
+// end of function uint16_t event_drops(const event_queue_t *queue)
+
+/******************************************************************************
+ * Function: void event_flush(event_queue_t *queue)
+ * Description: Discards the events waiting in the queue. Consumer side: only
+ * tail is written, so it is safe with the interrupt enabled.
+ * Input: queue
+ * Output: void
+ ******************************************************************************/
+void event_flush(event_queue_t *queue)
+{
+    queue->tail = queue->head;
+}
+// end of function void event_flush(event_queue_t *queue)
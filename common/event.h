@@ -0,0 +1,85 @@
+/* ****************************************************************************
+ * Project: Control Functions             File event.h                   October/2026
+ * ****************************************************************************
+ * File description: Event queues from the interrupts to the main loop.
+ *     An interrupt posts a typed event (type, arg, data) and returns; the main
+ *     loop takes the events in order with event_get() and does the work, so
+ *     the flags are not polled and no event is lost between two passes of the
+ *     loop (up to the size of the queue).
+ *
+ *     Each queue has a single producer and a single consumer:
+ *         producer  one interrupt priority level, writes only head and drops;
+ *         consumer  the main loop, writes only tail.
+ *     head and tail are single bytes, read and written in one instruction, and
+ *     each side only writes its own index after the slot is filled (producer)
+ *     or copied (consumer), so no interrupt needs to be masked. A queue must
+ *     not be posted by both isr_high and isr_low: use one queue per level.
+ *     When the queue is full the new event is lost and counted in drops.
+ *
+ *     Use:
+ *         EVENT_QUEUE(events, 8);                        // Size: power of 2.
+ *         isr:   event_post(&events, EVENT_TIMER, 1, 0);
+ *         main:  while(event_get(&events, &e)) { switch(e.type) ... }
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * * Lamport, L. Specifying concurrent program modules. ACM TOPLAS, 1983
+ *   (single producer, single consumer queue without locks).
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | One source in common/ for Bouncing.X, CANet.X,
+ *           |                   | StepperMotor.X and TIMER.X
+ ******************************************************************************/
+
+#ifndef EVENT_H
+#define	EVENT_H
+
+#include <xc.h>
+#include <stdint.h>
+
+// Event types.
+#define EVENT_NONE      0
+#define EVENT_TIMER     1   // arg: timer number.
+#define EVENT_CAPTURE   2   // arg: CCP number, data: captured value.
+#define EVENT_KEY       3   // arg: button event (debounce.h).
+#define EVENT_CAN       4   // MCP2515 interrupt (INT2), CANINTF read by the main loop.
+#define EVENT_ADC       5   // arg: channel, data: result.
+#define EVENT_USER      0x80 // 0x80 to 0xFF: events of the program.
+
+typedef struct
+{
+    uint8_t type;
+    uint8_t arg;
+    uint16_t data;
+} event_t;
+
+typedef struct
+{
+    volatile event_t *buffer;
+    uint8_t mask;               // Size - 1.
+    volatile uint8_t head;      // Next slot to fill, written by the producer.
+    volatile uint8_t tail;      // Next slot to take, written by the consumer.
+    volatile uint16_t drops;    // Events lost, written by the producer.
+} event_queue_t;
+
+// Defines a queue of size events (2 to 128, power of 2), static to the file.
+#define EVENT_QUEUE(name, size) \
+    typedef char name##_size_check[((size) >= 2 && (size) <= 128 && ((size) & ((size) - 1)) == 0) ? 1 : -1]; \
+    static volatile event_t name##_buffer[size]; \
+    static event_queue_t name = { name##_buffer, (size) - 1, 0, 0, 0 }
+
+uint8_t event_post(event_queue_t *queue, uint8_t type, uint8_t arg, uint16_t data);
+uint8_t event_get(event_queue_t *queue, event_t *event);
+uint8_t event_count(const event_queue_t *queue);
+uint16_t event_drops(const event_queue_t *queue);
+void event_flush(event_queue_t *queue);
+
+#endif	/* EVENT_H */
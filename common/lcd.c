@@ -0,0 +1,1067 @@
+/* ****************************************************************************
+ * Project: Control Functions             File lcd.c                 March/2022
+ * ****************************************************************************
+ * File description: Functions for 16x2 LCD display control, with PIC18F4550.      
+ * 
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * 
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * 
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * * MicroChip Developer Help sample program files. 
+ *   <https://microchipdeveloper.com/>.
+ * * HD44780U dot-matrix liquid crystal display controller Datasheet
+ *   <https://www.digchip.com/datasheets/parts/datasheet/740/HD44780U-pdf.php>
+ * 
+ * 03/23/2022| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Texts of program memory, lcd_prtRom() with TBLRD*+
+ * 10/19/2026| Antonio Castilho  | Pin map, one masked write of LATD per nibble, LCD_D7 = RD7
+ * 10/19/2026| Antonio Castilho  | lcd_iniStart(), lcd_task(), lcd_splash(): start without waiting
+ * 10/19/2026| Antonio Castilho  | Geometry (16x2, 20x4, 40x2, 40x4 with E2), clip/wrap, frame buffer
+ * 10/19/2026| Antonio Castilho  | I2C backpack (PCF8574), queue sent by the SSP interrupt
+ * 10/19/2026| Antonio Castilho  | One source in common/ for the nine projects, lcd_i2cQueue volatile
+ * 10/19/2026| Antonio Castilho  | ms_time(), us_time(): their time on the host model
+ * 10/19/2026| Antonio Castilho  | lcd_prtRom() streams with TBLRD*+, texts const __rom char
+ * 10/19/2026| Antonio Castilho  | lcd_com(): clear and home wait 1.6 ms on the port bus too
+ * 10/19/2026| Antonio Castilho  | ms_time(), us_time(): __delay_ms()/__delay_us() of XC8, not a bare loop
+ ******************************************************************************/
+
+/******************************************************************************/
+// Includes
+/******************************************************************************/
+#include <xc.h>
+#include <stdlib.h>
+#include <math.h>
+#include "lcd.h"
+
+#ifndef _XTAL_FREQ
+    #error "lcd.c: _XTAL_FREQ from the lcd.h of the project"
+#endif
+
+/******************************************************************************/
+
+// Welcome message, in program memory.
+static const __rom char lcd_welcome1[] = "Seja Bem Vindo! ";
+static const __rom char lcd_welcome2[] = "PIC18F4550 FATEC";
+
+/******************************************************************************
+ * Bus of the display, from the pin map of lcd.h.
+ * LCD_NIBBLE(n): bits of the latch for the nibble n on D4..D7.
+ * LCD_LAT ^= (LCD_LAT ^ bits) & mask changes only the bits of the mask and
+ * the latch is written by one instruction (XORWF LATx,F): an interrupt that
+ * changes other pins of the port between the read and the write is not undone,
+ * and E, RS and RW never go through a wrong level. PORTx is never read: a pin
+ * loaded by the display could read back different from its latch.
+ ******************************************************************************/
+#if LCD_PIN_D5 == LCD_PIN_D4 + 1 && LCD_PIN_D6 == LCD_PIN_D4 + 2 && LCD_PIN_D7 == LCD_PIN_D4 + 3
+    #define LCD_NIBBLE(n)   ((uint8_t)(((n) & 0x0F) << LCD_PIN_D4))
+#else
+    #define LCD_NIBBLE(n)   ((uint8_t)((((n) & 0x01) ? LCD_MASK(LCD_PIN_D4) : 0) \
+                                       | (((n) & 0x02) ? LCD_MASK(LCD_PIN_D5) : 0) \
+                                       | (((n) & 0x04) ? LCD_MASK(LCD_PIN_D6) : 0) \
+                                       | (((n) & 0x08) ? LCD_MASK(LCD_PIN_D7) : 0)))
+#endif
+
+#define LCD_LAT_SET(bits, mask) (LCD_LAT ^= (uint8_t)((LCD_LAT ^ (bits)) & (mask)))
+
+#if LCD_BUS == LCD_BUS_I2C
+/******************************************************************************
+ * Queue of the I2C backpack, see lcd.h. lcd_i2cHead is written only by the
+ * lcd_ functions and lcd_i2cTail only by lcd_isr(), one byte each: the
+ * interrupt is never disabled to put a byte. The queue is volatile as well:
+ * lcd_isr() sends the bytes lcd_i2cPut() stores, so each store must be in
+ * RAM before lcd_i2cHead moves past it.
+ ******************************************************************************/
+#define LCD_I2C_IDLE    0   // No transfer: lcd_i2cPut() starts one.
+#define LCD_I2C_START   1   // START being sent.
+#define LCD_I2C_DATA    2   // Address or a byte of the queue being sent.
+#define LCD_I2C_STOP    3   // STOP being sent.
+
+typedef char lcd_i2c_check[(LCD_I2C_QUEUE >= 16 && LCD_I2C_QUEUE <= 255) ? 1 : -1];
+
+static volatile uint8_t lcd_i2cQueue[LCD_I2C_QUEUE];
+static volatile uint8_t lcd_i2cHead;        // Next free place.
+static volatile uint8_t lcd_i2cTail;        // Next byte to send.
+static volatile uint8_t lcd_i2cState = LCD_I2C_IDLE;
+static uint8_t lcd_i2cLast = LCD_BL_MASK;   // Outputs after the last byte put.
+
+#define LCD_CHAR_WAIT()     // The bus time of the bytes is the wait.
+#else
+#define LCD_CHAR_WAIT()     us_time(200)
+#endif
+
+/******************************************************************************
+ * Geometry, see lcd.h. The cursor of the display is followed here (lcd_row,
+ * lcd_col), so lcd_prtChar() knows the end of the row without reading the
+ * display (RW is always 0).
+ * The DDRAM address of a row is computed, not read from a const table: the
+ * path of lcd_prtChar() reads no program memory, so TBLPTR stays where
+ * lcd_prtRom() left it.
+ ******************************************************************************/
+#if LCD_CONTROLLERS == 2
+#define LCD_ROW_ADDR(row)   (((row) & 1) ? 0x00 : 0x40)
+#else
+#define LCD_ROW_ADDR(row)   ((((row) & 1) ? 0x00 : 0x40) + (((row) > 2) ? LCD_COLS : 0))
+#endif
+
+static uint8_t lcd_row = 1;                     // Cursor: row 1 to LCD_ROWS,
+static uint8_t lcd_col;                         // column (LCD_COLS or more: past the end).
+static uint8_t lcd_e = LCD_MASK(LCD_PIN_E);     // E of the controller of lcd_row.
+static uint8_t lcd_wrap = LCD_CLIP;
+
+#if LCD_FRAME
+static uint8_t lcd_frame[LCD_ROWS][LCD_COLS];           // Characters of the screen.
+static uint8_t lcd_dirty[LCD_ROWS][(LCD_COLS + 7) / 8]; // Bit 1: not yet on the display.
+static uint8_t fb_row = 1;                              // Next character of lcd_fbPut().
+static uint8_t fb_col;
+static void lcd_fbReset(void);
+static void lcd_fbLost(void);
+#endif
+
+#if LCD_BUS == LCD_BUS_I2C
+/******************************************************************************
+ * Function: void lcd_isr(void)
+ * Description: SSP interrupt (SSPIF), one step of the write to the backpack:
+ *              after the START the address, after each byte (ACK) the next
+ *              of the queue, with the queue empty the STOP, and after it a
+ *              new START if bytes were put meanwhile. Returns at once when
+ *              SSPIF is 0, so it can share the interrupt with other modules.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void lcd_isr(void)
+{
+    uint8_t tail;
+
+    if(PIR2bits.BCLIF) // Bus collision (SDA held low): the bytes are lost.
+    {
+        PIR2bits.BCLIF = 0;
+        lcd_i2cTail = lcd_i2cHead;
+        lcd_i2cState = LCD_I2C_IDLE;
+    }
+    if(!PIR1bits.SSPIF) return;
+    PIR1bits.SSPIF = 0;
+
+    if(lcd_i2cState == LCD_I2C_START)
+    {
+        SSPBUF = (uint8_t)(LCD_I2C_ADDR << 1); // R/W = 0: write.
+        lcd_i2cState = LCD_I2C_DATA;
+    }
+    else if(lcd_i2cState == LCD_I2C_DATA)
+    {
+        if(SSPCON2bits.ACKSTAT) lcd_i2cTail = lcd_i2cHead; // No backpack.
+        tail = lcd_i2cTail;
+        if(tail != lcd_i2cHead)
+        {
+            SSPBUF = lcd_i2cQueue[tail];
+            if(++tail == LCD_I2C_QUEUE) tail = 0;
+            lcd_i2cTail = tail;
+        }
+        else
+        {
+            SSPCON2bits.PEN = 1;
+            lcd_i2cState = LCD_I2C_STOP;
+        }
+    }
+    else if(lcd_i2cState == LCD_I2C_STOP)
+    {
+        if(lcd_i2cTail != lcd_i2cHead)
+        {
+            SSPCON2bits.SEN = 1;
+            lcd_i2cState = LCD_I2C_START;
+        }
+        else
+        {
+            lcd_i2cState = LCD_I2C_IDLE;
+        }
+    }
+}
+/* end of function
+ * void lcd_isr(void)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: static void lcd_i2cPut(uint8_t byte)
+ * Description: Puts a byte (outputs of the PCF8574) in the queue, and starts
+ *              a write if none is in progress. With the queue full, waits:
+ *              lcd_isr() is called here too, with SSPIE at 0 so the interrupt
+ *              does not take the same SSPIF, and the queue moves even with the
+ *              interrupts not yet enabled (lcd_ini()).
+ * Input: Byte.
+ * Output: void
+ ******************************************************************************/
+static void lcd_i2cPut(uint8_t byte)
+{
+    uint8_t head = lcd_i2cHead;
+
+    if(++head == LCD_I2C_QUEUE) head = 0;
+    while(head == lcd_i2cTail) // Full.
+    {
+        PIE1bits.SSPIE = 0;
+        lcd_isr();
+        PIE1bits.SSPIE = 1;
+    }
+    lcd_i2cQueue[lcd_i2cHead] = byte;
+    lcd_i2cHead = head;
+    lcd_i2cLast = byte;
+    if(lcd_i2cState == LCD_I2C_IDLE)
+    {
+        lcd_i2cState = LCD_I2C_START;
+        SSPCON2bits.SEN = 1;
+    }
+}
+/* end of function
+ * static void lcd_i2cPut(uint8_t byte)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: static void lcd_i2cHold(uint16_t us)
+ * Description: Wait of the display inside the write: copies of the last byte
+ *              (no edge of E) for the time beyond the byte of the next E.
+ * Input: Time, us.
+ * Output: void
+ ******************************************************************************/
+static void lcd_i2cHold(uint16_t us)
+{
+    while(us > LCD_I2C_BYTE_US)
+    {
+        lcd_i2cPut(lcd_i2cLast);
+        us = (uint16_t)(us - LCD_I2C_BYTE_US);
+    }
+}
+/* end of function
+ * static void lcd_i2cHold(uint16_t us)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: static void lcd_i2cIni(void)
+ * Description: MSSP in I2C master mode at LCD_I2C_HZ, SSP interrupt of low
+ *              priority, empty queue. RB0 (SDA) and RB1 (SCL) inputs and
+ *              digital: AN10 and AN12 off in ADCON1, AN0..AN9 as they were.
+ *              Section 19.4.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+static void lcd_i2cIni(void)
+{
+    PIE1bits.SSPIE = 0;
+    TRISBbits.TRISB0 = 1; // The MSSP drives the lines (open drain).
+    TRISBbits.TRISB1 = 1;
+    if((ADCON1 & 0x0F) < 0x05) ADCON1 = (uint8_t)((ADCON1 & 0xF0) | 0x05);
+    SSPCON1 = 0;
+    SSPSTAT = (LCD_I2C_HZ > 100000) ? 0x00 : 0x80; // SMP: slew rate control at 400 kHz only.
+    SSPADD = (uint8_t)(_XTAL_FREQ / (4UL * LCD_I2C_HZ) - 1);
+    SSPCON2 = 0;
+    SSPCON1 = 0x28; // SSPEN, I2C master, clock = FOSC / (4 * (SSPADD + 1)).
+    lcd_i2cHead = 0;
+    lcd_i2cTail = 0;
+    lcd_i2cState = LCD_I2C_IDLE;
+    IPR1bits.SSPIP = 0;
+    PIR1bits.SSPIF = 0;
+    PIE1bits.SSPIE = 1;
+}
+/* end of function
+ * static void lcd_i2cIni(void)
+*******************************************************************************/
+#endif
+
+/******************************************************************************
+ * Function: static void lcd_nibble(uint8_t nibble, uint8_t rs, uint8_t e,
+ *                                  uint16_t us)
+ * Description: Puts the nibble on D4..D7 with RS, RW = 0 and E = 0 in one
+ *              write of the latch, then the pulse of E (bit set and bit clear,
+ *              one instruction each). The display reads the data on the
+ *              falling edge of E. On the backpack the same states are
+ *              bytes of the queue, E = 1 then E = 0 (and RS first when it
+ *              changes); the time of a byte on the bus is the wait.
+ * Input: Nibble (bits 3:0), RS (0 command, 1 data), E of the controllers
+ *        (lcd_e, or LCD_E_MASK for all) and the time of each step.
+ * Output: void
+ ******************************************************************************/
+static void lcd_nibble(uint8_t nibble, uint8_t rs, uint8_t e, uint16_t us)
+{
+#if LCD_BUS == LCD_BUS_I2C
+    uint8_t out = (uint8_t)(LCD_NIBBLE(nibble) | (rs ? LCD_MASK(LCD_PIN_RS) : 0) | LCD_BL_MASK);
+
+    (void)us;
+    if((lcd_i2cLast ^ out) & LCD_MASK(LCD_PIN_RS)) lcd_i2cPut(out); // RS before E.
+    lcd_i2cPut((uint8_t)(out | e));
+    lcd_i2cPut(out);
+#else
+    LCD_LAT_SET(LCD_NIBBLE(nibble) | (rs ? LCD_MASK(LCD_PIN_RS) : 0), LCD_BUS_MASK);
+    us_time(us);
+    LCD_LAT |= e;
+    us_time(us);
+    LCD_LAT &= (uint8_t)~e;
+    us_time(us);
+#endif
+}
+/* end of function
+ * static void lcd_nibble(uint8_t nibble, uint8_t rs, uint8_t e, uint16_t us)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: static void lcd_write(uint8_t byte, uint8_t rs, uint8_t e,
+ *                                 uint16_t us)
+ * Description: A command or a character in two nibbles, high one first.
+ * Input: As lcd_nibble().
+ * Output: void
+ ******************************************************************************/
+static void lcd_write(uint8_t byte, uint8_t rs, uint8_t e, uint16_t us)
+{
+    lcd_nibble((uint8_t)(byte >> 4), rs, e, us);
+    lcd_nibble(byte, rs, e, us);
+}
+/* end of function
+ * static void lcd_write(uint8_t byte, uint8_t rs, uint8_t e, uint16_t us)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: static uint8_t lcd_fit(uint8_t *row, uint8_t *col)
+ * Description: Place of the next character after the rules of LCD_CLIP and
+ *              LCD_WRAP: past the last column it is lost, or it goes to
+ *              column 0 of the next row (after the last row, row 1).
+ * Input: Row and column, changed on a wrap.
+ * Output: 1 the character is written at row, col; 0 it is lost.
+ ******************************************************************************/
+static uint8_t lcd_fit(uint8_t *row, uint8_t *col)
+{
+    if(*row == 0 || *row > LCD_ROWS) return 0;
+    if(*col < LCD_COLS) return 1;
+    if(lcd_wrap == LCD_CLIP) return 0;
+    *row = (uint8_t)(*row % LCD_ROWS + 1);
+    *col = 0;
+    return 1;
+}
+/* end of function
+ * static uint8_t lcd_fit(uint8_t *row, uint8_t *col)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_goto(const uint8_t row, const uint8_t col)
+ * Description: Moves the cursor to a row (1 to LCD_ROWS) and column (0 to
+ *              LCD_COLS - 1), on the controller of the row. Row 0 is row 1,
+ *              column 0, as before. Outside the display nothing is sent and
+ *              the characters after it follow the rules of lcd_setWrap().
+ * Input: Row and column.
+ * Output: void
+ ******************************************************************************/
+void lcd_goto(const uint8_t row, const uint8_t col)
+{
+    lcd_row = row;
+    lcd_col = col;
+    if(row == 0)
+    {
+        lcd_row = 1;
+        lcd_col = 0;
+    }
+    if(lcd_row > LCD_ROWS || lcd_col >= LCD_COLS) return;
+#if LCD_CONTROLLERS == 2
+    lcd_e = (lcd_row > 2) ? LCD_MASK(LCD_PIN_E2) : LCD_MASK(LCD_PIN_E);
+#endif
+    lcd_write((uint8_t)(0x80 | (LCD_ROW_ADDR(lcd_row) + lcd_col)), 0, lcd_e, 10);
+}
+/* end of function
+ * void lcd_goto(const uint8_t row, const uint8_t col)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_setWrap(const uint8_t mode)
+ * Description: What happens to a text longer than its row, in lcd_prtChar(),
+ *              lcd_prtStr() and the others, and in the frame buffer.
+ * Input: LCD_CLIP (lost, default) or LCD_WRAP (next row).
+ * Output: void
+ ******************************************************************************/
+void lcd_setWrap(const uint8_t mode)
+{
+    lcd_wrap = mode;
+}
+/* end of function
+ * void lcd_setWrap(const uint8_t mode)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_com(uint8_t cmd);
+ * Description: Sends a command to the LCD display.
+ * Example: lcd_com(0x01);
+ * Input: Command in 8 bits, conforme LCD datasheet.
+ * Output: void
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 03/23/2022| Antonio Castilho  | Function has been created
+ * 07/01/2023| Antonio Castilho  | Created function to waste time and replaced in LCD functions
+ *                                             | us_time() e ms_time() that repalces time_waster_us() and others
+ * 10/19/2026| Antonio Castilho  | Clear and home wait 1.6 ms on both buses
+ ******************************************************************************/
+void lcd_com(uint8_t cmd)
+{
+    lcd_write(cmd, 0, LCD_E_MASK, 10); // All the controllers.
+
+#if LCD_BUS == LCD_BUS_I2C
+    if(cmd == 0x01 || cmd == 0x02) lcd_i2cHold(1600); // Clear, home: 1.52 ms.
+#else
+    if(cmd == 0x01 || cmd == 0x02) us_time(1600);     // Clear, home: 1.52 ms, as on the backpack.
+#endif
+    if(cmd == 0x01 || cmd == 0x02) // Clear, home: cursor at row 1, column 0.
+    {
+        lcd_row = 1;
+        lcd_col = 0;
+        lcd_e = LCD_MASK(LCD_PIN_E);
+    }
+#if LCD_FRAME
+    if(cmd == 0x01) lcd_fbLost();
+#endif
+}
+/* end of function
+ * void lcd_com(uint8_t cmd)
+*******************************************************************************/
+
+/******************************************************************************
+ * Start of the display: 4-bit interface, initializing by instruction
+ * (HD44780U datasheet). Each step is a nibble (8-bit interface still) or a
+ * command, and the time to wait after it, in us. Shared by lcd_ini(), that
+ * waits, and lcd_task(), that returns while waiting. On the backpack the
+ * waits of lcd_ini() and the short ones of lcd_task() are made in the write
+ * (lcd_delay()); the long ones of lcd_task() count from its end.
+ ******************************************************************************/
+#define LCD_NIB     1   // Only the high nibble (8-bit interface at the start).
+#define LCD_CMD     0
+
+typedef struct
+{
+    uint8_t type;
+    uint8_t data;
+    uint16_t wait;  // us.
+} lcd_step_t;
+
+static const lcd_step_t lcd_steps[] =
+{
+    { LCD_NIB, 0x03, 5000 },    // Function set, 8 bits: > 4.1 ms.
+    { LCD_NIB, 0x03, 200 },     // > 100 us.
+    { LCD_NIB, 0x03, 100 },
+    { LCD_NIB, 0x02, 100 },     // 4 bits from here.
+    { LCD_CMD, 0x2C, 50 },      // Function set. 4 bits, 2 rows, 5x10 dots.
+    { LCD_CMD, 0x06, 50 },      // Entry mode set. Increment. No shift.
+    { LCD_CMD, 0x0F, 50 },      // Display on/off control. Display on, cursor on, cursor blink.
+    { LCD_CMD, 0x01, 2000 }     // Clear display: 1.52 ms.
+};
+#define LCD_STEPS   (sizeof(lcd_steps) / sizeof(lcd_steps[0]))
+
+// Instruction cycles of a time in us, for the clock of lcd_task().
+#define LCD_CYCLES(us)  ((uint32_t)(us) * (_XTAL_FREQ / 4000000UL))
+
+// States of lcd_task().
+#define LCD_ST_INI      0   // Steps of lcd_steps[].
+#define LCD_ST_SPLASH   1   // Splash being written or kept.
+#define LCD_ST_READY    2   // Display free for the program.
+
+static uint8_t lcd_state = LCD_ST_READY;
+static uint8_t lcd_step;            // Next step of lcd_steps[].
+static uint32_t lcd_since;          // Clock at the last step.
+static uint32_t lcd_wait;           // Cycles to wait from lcd_since.
+static const __rom char *lcd_splashText[2];
+static uint8_t lcd_splashRow = 2;   // Next row of the splash; 2: none to write.
+static uint32_t lcd_splashHold;     // Cycles the splash is kept.
+
+/******************************************************************************
+ * Function: static void lcd_delay(uint16_t us)
+ * Description: Wait after a step: us_time(), or on the backpack copies of the
+ *              last byte (lcd_i2cHold()) and no CPU time.
+ * Input: Time, us.
+ * Output: void
+ ******************************************************************************/
+static void lcd_delay(uint16_t us)
+{
+#if LCD_BUS == LCD_BUS_I2C
+    lcd_i2cHold(us);
+#else
+    us_time(us);
+#endif
+}
+/* end of function
+ * static void lcd_delay(uint16_t us)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: static uint16_t lcd_iniStep(uint8_t step)
+ * Description: Makes one step of the start of the display.
+ * Input: Step, 0 to LCD_STEPS - 1.
+ * Output: Time to wait after it, in us.
+ ******************************************************************************/
+static uint16_t lcd_iniStep(uint8_t step)
+{
+    if(lcd_steps[step].type == LCD_NIB)
+    {
+        lcd_nibble(lcd_steps[step].data, 0, LCD_E_MASK, 10);
+    }
+    else
+    {
+        lcd_com(lcd_steps[step].data);
+    }
+    return lcd_steps[step].wait;
+}
+/* end of function
+ * static uint16_t lcd_iniStep(uint8_t step)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: static void lcd_pins(void)
+ * Description: All the lines of the LCD at 0 and outputs; the other pins of
+ *              the port unchanged (on the backpack: the MSSP started and a
+ *              first byte, lines at 0, backlight on). Cursor and frame buffer
+ *              as after a clear.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+static void lcd_pins(void)
+{
+#if LCD_BUS == LCD_BUS_I2C
+    lcd_i2cIni();
+    lcd_i2cPut(LCD_BL_MASK);
+#else
+    LCD_LAT_SET(0, LCD_BUS_MASK);
+    LCD_TRIS &= (uint8_t)~LCD_BUS_MASK;
+#endif
+    lcd_row = 1;
+    lcd_col = 0;
+    lcd_e = LCD_MASK(LCD_PIN_E);
+#if LCD_FRAME
+    lcd_fbReset(); // The start ends with a clear.
+#endif
+}
+/* end of function
+ * static void lcd_pins(void)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_ini(void);
+ * Description: Initializes the LCD display and configures it to suit the 
+ *              project: data in 4 bits, 2 lines, 5x10 dots, 
+ *              cursor on and blinking. Waits about 60 ms; see lcd_iniStart()
+ *              for a start that does not wait.
+ * Input: void
+ * Output: void
+ * Created in: 03/23/2022 by Antonio Aparecido Ariza Castilho
+ ******************************************************************************/
+void lcd_ini(void)
+{
+    uint8_t step;
+
+    lcd_pins();
+    us_time(LCD_POWER_US);
+    for(step = 0; step < LCD_STEPS; step++)
+    {
+        lcd_delay(lcd_iniStep(step));
+    }
+    lcd_state = LCD_ST_READY;
+}
+/* end of function
+ * void lcd_ini(void)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_iniStart(uint32_t now)
+ * Description: Starts the display without waiting: lcd_task() makes the steps
+ *              of lcd_ini() when their time comes.
+ * Example: lcd_iniStart(timebase_now());
+ * Input: Clock, instruction cycles (timebase_now()).
+ * Output: void
+ ******************************************************************************/
+void lcd_iniStart(uint32_t now)
+{
+    lcd_pins();
+    lcd_step = 0;
+    lcd_since = now;
+    lcd_wait = LCD_CYCLES(LCD_POWER_US);
+    lcd_state = LCD_ST_INI;
+}
+/* end of function
+ * void lcd_iniStart(uint32_t now)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_splash(const __rom char *row1, const __rom char *row2, uint16_t ms)
+ * Description: Texts of program memory written by lcd_task() on rows 1 and 2
+ *              after the start (or at once, with the display free), and kept
+ *              for ms: lcd_task() returns 0 until then.
+ * Example: lcd_splash(&ui_text[TXT_WELCOME], &ui_text[TXT_VERSION], 3000);
+ * Input: Texts (0: row not written) and time.
+ * Output: void
+ ******************************************************************************/
+void lcd_splash(const __rom char *row1, const __rom char *row2, uint16_t ms)
+{
+    lcd_splashText[0] = row1;
+    lcd_splashText[1] = row2;
+    lcd_splashHold = (uint32_t)ms * (_XTAL_FREQ / 4000UL);
+    lcd_splashRow = 0;
+    if(lcd_state == LCD_ST_READY) lcd_state = LCD_ST_SPLASH;
+}
+/* end of function
+ * void lcd_splash(const __rom char *row1, const __rom char *row2, uint16_t ms)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: uint8_t lcd_task(uint32_t now)
+ * Description: Next step of the start or of the splash, if its time has
+ *              come; returns at once otherwise. Waits up to LCD_INLINE_US
+ *              are made here; a longer one returns and goes on in a later
+ *              call. One row of the splash per call (about 7 ms).
+ * Example: if(lcd_task(timebase_now())) lcd_prtInt(1, 7, temp);
+ * Input: Clock, instruction cycles (timebase_now()).
+ * Output: 1 display free for the program, 0 start or splash in progress.
+ ******************************************************************************/
+uint8_t lcd_task(uint32_t now)
+{
+    uint16_t wait;
+
+    if(lcd_state == LCD_ST_READY) return 1;
+#if LCD_BUS == LCD_BUS_I2C
+    if(lcd_i2cState != LCD_I2C_IDLE) // Bytes still in the queue: the wait is from the end.
+    {
+        lcd_since = now;
+        return 0;
+    }
+#endif
+    if((uint32_t)(now - lcd_since) < lcd_wait) return 0;
+    lcd_since = now;
+    lcd_wait = 0;
+
+    if(lcd_state == LCD_ST_INI)
+    {
+        while(lcd_step < LCD_STEPS)
+        {
+            wait = lcd_iniStep(lcd_step++);
+            if(wait > LCD_INLINE_US)
+            {
+                lcd_wait = LCD_CYCLES(wait);
+                break;
+            }
+            lcd_delay(wait);
+        }
+        if(lcd_step == LCD_STEPS) lcd_state = LCD_ST_SPLASH;
+        return 0;
+    }
+
+    if(lcd_splashRow < 2)
+    {
+        if(lcd_splashText[lcd_splashRow]) lcd_prtRom((uint8_t)(lcd_splashRow + 1), 0, lcd_splashText[lcd_splashRow]);
+        if(++lcd_splashRow == 2) lcd_wait = lcd_splashHold;
+        return 0;
+    }
+    lcd_state = LCD_ST_READY;
+    return 1;
+}
+/* end of function
+ * uint8_t lcd_task(uint32_t now)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_prtChar(uint8_t data)
+ * Description: Writes a byte, ie a character on the display. 
+ *              It is a helper function, for lcd_printString. 
+ *              At the cursor; past the end of the row see lcd_setWrap().
+ * Input: Byte representing an ASCII value, valid for the lcd.
+ * Output: void
+ * Created in: 03/26/2022 by Antonio Aparecido Ariza Castilho
+ ******************************************************************************/
+void lcd_prtChar(uint8_t dat)
+{
+    uint8_t row = lcd_row;
+
+    if(!lcd_fit(&lcd_row, &lcd_col)) return;
+    if(lcd_row != row) lcd_goto(lcd_row, 0); // Wrapped to the next row.
+    lcd_write(dat, 1, lcd_e, 40);
+    lcd_col++;
+}
+/* end of function 
+ * void lcd_prtChar(uint8_t dat)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_prtStr(int8_t row, int8_t col, uint8_t data)
+ * Description: Writes a string to the display starting at the indicated row
+ *              and column, until it finds a null character, which is the end 
+ *              of the string.
+ * Example: lcd_prtStr(0,0,("Seja Bem Vindo!!"));
+ * Input: Row and column and the string.
+ * Output: void
+ * Created in: 03/26/2022 by Antonio Aparecido Ariza Castilho
+ ******************************************************************************/
+void lcd_prtStr(const uint8_t row, const uint8_t col, const uint8_t *str)
+{
+    lcd_goto(row, col);
+    
+    while(*str)
+    {
+        LCD_CHAR_WAIT();
+        lcd_prtChar(*str);
+        str++;
+    }
+      
+}
+/* end of function
+ * lcd_prtStr(int8_t row, int8_t col, const uint8_t *str)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_prtRom(const uint8_t row, const uint8_t col,
+ *                           const __rom char *str)
+ * Description: Writes a string of program memory (for example the texts of
+ *              ui_text[], see lcd_prtText()) starting at the row and column.
+ *              TBLPTR is loaded once and TBLRD*+ streams the characters from
+ *              the flash to the display, without a copy in RAM and without
+ *              the generic pointer of lcd_prtStr(). lcd_prtChar() reads no
+ *              program memory (LCD_ROW_ADDR()), so TBLPTR is not moved between
+ *              two characters; an interrupt that reads it has it saved by XC8
+ *              with the context. __rom: XC8 refuses a pointer to RAM here.
+ * Example: lcd_prtRom(1, 0, text); where text is a const __rom char array.
+ * Input: Row and column and the string.
+ * Output: void
+ ******************************************************************************/
+void lcd_prtRom(const uint8_t row, const uint8_t col, const __rom char *str)
+{
+    uint8_t c;
+
+    lcd_goto(row, col);
+#if defined(__XC8)
+    TBLPTRU = 0; // 32 KB of program memory: bits 21:16 are 0. Section 6.2.
+    TBLPTRH = (uint8_t)((uint16_t)str >> 8);
+    TBLPTRL = (uint8_t)((uint16_t)str);
+    while(1)
+    {
+        asm("TBLRD*+");
+        c = TABLAT;
+        if(!c) break;
+        LCD_CHAR_WAIT();
+        lcd_prtChar(c);
+    }
+#else
+    while((c = (uint8_t)*str++) != 0) // Built with gcc on a PC: plain pointer.
+    {
+        LCD_CHAR_WAIT();
+        lcd_prtChar(c);
+    }
+#endif
+}
+/* end of function
+ * void lcd_prtRom(const uint8_t row, const uint8_t col, const __rom char *str)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_wellcome(void)
+ * Description: Initializes the display, cursor off, and writes the welcome
+ *              message (texts of program memory).
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void lcd_wellcome(void)
+{
+    lcd_ini();
+    lcd_cursorOff();
+    lcd_prtRom(1, 0, lcd_welcome1);
+    lcd_prtRom(2, 0, lcd_welcome2);
+}
+/* end of function
+ * void lcd_wellcome(void)
+*******************************************************************************/
+
+#if LCD_FRAME
+/******************************************************************************
+ * Function: static void lcd_fbReset(void)
+ * Description: Frame buffer of a clear display: spaces, nothing to send.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+static void lcd_fbReset(void)
+{
+    uint8_t row;
+    uint8_t col;
+
+    for(row = 0; row < LCD_ROWS; row++)
+    {
+        for(col = 0; col < LCD_COLS; col++) lcd_frame[row][col] = ' ';
+        for(col = 0; col < (LCD_COLS + 7) / 8; col++) lcd_dirty[row][col] = 0;
+    }
+    fb_row = 1;
+    fb_col = 0;
+}
+/* end of function
+ * static void lcd_fbReset(void)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: static void lcd_fbLost(void)
+ * Description: The display was cleared (lcd_clear()): the characters of the
+ *              frame buffer that are not spaces are sent again.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+static void lcd_fbLost(void)
+{
+    uint8_t row;
+    uint8_t col;
+
+    for(row = 0; row < LCD_ROWS; row++)
+    {
+        for(col = 0; col < LCD_COLS; col++)
+        {
+            if(lcd_frame[row][col] != ' ') lcd_dirty[row][col >> 3] |= (uint8_t)(1u << (col & 7));
+        }
+    }
+}
+/* end of function
+ * static void lcd_fbLost(void)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: static void lcd_fbPut(uint8_t c)
+ * Description: A character at fb_row, fb_col of the frame buffer, marked to
+ *              be sent only if it is not the one already there.
+ * Input: Character.
+ * Output: void
+ ******************************************************************************/
+static void lcd_fbPut(uint8_t c)
+{
+    uint8_t *cell;
+
+    if(!lcd_fit(&fb_row, &fb_col)) return;
+    cell = &lcd_frame[fb_row - 1][fb_col];
+    if(*cell != c)
+    {
+        *cell = c;
+        lcd_dirty[fb_row - 1][fb_col >> 3] |= (uint8_t)(1u << (fb_col & 7));
+    }
+    fb_col++;
+}
+/* end of function
+ * static void lcd_fbPut(uint8_t c)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: static void lcd_fbGoto(const uint8_t row, const uint8_t col)
+ * Description: Place of the next lcd_fbPut(); row 0 is row 1, column 0.
+ * Input: Row and column.
+ * Output: void
+ ******************************************************************************/
+static void lcd_fbGoto(const uint8_t row, const uint8_t col)
+{
+    fb_row = row ? row : 1;
+    fb_col = row ? col : 0;
+}
+/* end of function
+ * static void lcd_fbGoto(const uint8_t row, const uint8_t col)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_fbClear(void)
+ * Description: Spaces in all the frame buffer (sent by lcd_fbFlush() only
+ *              where there was something else).
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void lcd_fbClear(void)
+{
+    uint8_t row;
+    uint8_t col;
+
+    for(row = 1; row <= LCD_ROWS; row++)
+    {
+        lcd_fbGoto(row, 0);
+        for(col = 0; col < LCD_COLS; col++) lcd_fbPut(' ');
+    }
+}
+/* end of function
+ * void lcd_fbClear(void)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_fbStr(const uint8_t row, const uint8_t col,
+ *                          const uint8_t *str)
+ * Description: lcd_prtStr() in the frame buffer.
+ * Example: lcd_fbStr(3, 0, name); lcd_fbFlush(0);
+ * Input: Row and column and the string.
+ * Output: void
+ ******************************************************************************/
+void lcd_fbStr(const uint8_t row, const uint8_t col, const uint8_t *str)
+{
+    lcd_fbGoto(row, col);
+    while(*str) lcd_fbPut(*str++);
+}
+/* end of function
+ * void lcd_fbStr(const uint8_t row, const uint8_t col, const uint8_t *str)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_fbRom(const uint8_t row, const uint8_t col,
+ *                          const __rom char *str)
+ * Description: lcd_prtRom() in the frame buffer (TBLRD*+, no copy in RAM).
+ * Example: lcd_fbText(1, 0, TXT_SPEED);
+ * Input: Row and column and the string of program memory.
+ * Output: void
+ ******************************************************************************/
+void lcd_fbRom(const uint8_t row, const uint8_t col, const __rom char *str)
+{
+    uint8_t c;
+
+    lcd_fbGoto(row, col);
+#if defined(__XC8)
+    TBLPTRU = 0; // 32 KB of program memory. Section 6.2.
+    TBLPTRH = (uint8_t)((uint16_t)str >> 8);
+    TBLPTRL = (uint8_t)((uint16_t)str);
+    while(1)
+    {
+        asm("TBLRD*+");
+        c = TABLAT;
+        if(!c) break;
+        lcd_fbPut(c);
+    }
+#else
+    while((c = (uint8_t)*str++) != 0) lcd_fbPut(c);
+#endif
+}
+/* end of function
+ * void lcd_fbRom(const uint8_t row, const uint8_t col, const __rom char *str)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: void lcd_fbInt(const uint8_t row, const uint8_t col,
+ *                          const int32_t value)
+ * Description: lcd_prtInt() in the frame buffer.
+ * Input: Row and column and the integer number.
+ * Output: void
+ ******************************************************************************/
+void lcd_fbInt(const uint8_t row, const uint8_t col, const int32_t value)
+{
+    uint8_t str[12]; // "-2147483648" and '\0'.
+
+    ltoa((char *)str, value, 10);
+    lcd_fbStr(row, col, str);
+}
+/* end of function
+ * void lcd_fbInt(const uint8_t row, const uint8_t col, const int32_t value)
+*******************************************************************************/
+
+/******************************************************************************
+ * Function: uint8_t lcd_fbFlush(uint8_t max)
+ * Description: Sends to the display the characters of the frame buffer that
+ *              changed, row by row, with lcd_goto() only where the cursor is
+ *              not already there. Bytes of lcd_dirty[] at 0 are skipped 8
+ *              columns at a time. With max, returns after max characters
+ *              (about 0.5 ms each; on the backpack only put in the queue)
+ *              and goes on in the next call.
+ * Example: while(!lcd_fbFlush(8)) other_task();
+ * Input: Characters to send in this call, 0 for all.
+ * Output: 1 the display is equal to the frame buffer, 0 there is more.
+ ******************************************************************************/
+uint8_t lcd_fbFlush(uint8_t max)
+{
+    uint8_t row;
+    uint8_t col;
+    uint8_t bit;
+    uint8_t sent = 0;
+
+    for(row = 0; row < LCD_ROWS; row++)
+    {
+        for(col = 0; col < LCD_COLS; col++)
+        {
+            if(!lcd_dirty[row][col >> 3])
+            {
+                col |= 7;   // Next byte of lcd_dirty[].
+                continue;
+            }
+            bit = (uint8_t)(1u << (col & 7));
+            if(!(lcd_dirty[row][col >> 3] & bit)) continue;
+            if(max && sent == max) return 0;
+            lcd_dirty[row][col >> 3] &= (uint8_t)~bit;
+            if(lcd_row != row + 1 || lcd_col != col) lcd_goto((uint8_t)(row + 1), col);
+            lcd_write(lcd_frame[row][col], 1, lcd_e, 40);
+            lcd_col++;
+            sent++;
+        }
+    }
+    return 1;
+}
+/* end of function
+ * uint8_t lcd_fbFlush(uint8_t max)
+*******************************************************************************/
+#endif
+
+/******************************************************************************
+ * Function: void lcd_prtInt(const uint8_t row, const uint8_t col,
+ *           const uint16_t str);
+ * Description: Write integer number on LCD display.
+ * Example: lcd_prtInt(0, 0, value); where value is a variable that contains 
+ *          an integer and must be of the required size.
+ * Input: Row and column and the integer number.
+ * Output: void
+* ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 04/02/2022| Antonio Castilho  | Function has been created
+ ******************************************************************************/
+void lcd_prtInt(const uint8_t row, const uint8_t col, const int32_t value)
+{
+    uint8_t str[12]; // "-2147483648" and '\0'.
+    ltoa((char *)str, value, 10);
+    
+    lcd_prtStr(row,col,str);
+}// end of function
+
+
+
+/*******************************************************************************
+ * Function: uint8_t digit_counter(uint16_t number);
+ * Description: Helper function to count the number of digits of an integer
+ * Input: Integer.
+ * Output: Number of digits.
+ * Created in: 04/17/2022 by Antonio Aparecido Ariza Castilho
+ ******************************************************************************/
+uint8_t digit_counter(uint16_t number)
+{
+    uint8_t n = 0;
+    while(number >= 10)
+    {
+        number = number / 10;
+        n++;
+        
+    }
+    return n;
+}//end of function uint8_t digit_counter(uint16_t number);
+
+/*******************************************************************************
+ * Function: void ms_time(uint16_t ms);
+ * Description: Function to spend CPU time: ms times __delay_ms(1), which XC8
+ *              counts in instruction cycles from _XTAL_FREQ. The loop adds a
+ *              few cycles each time, so the wait is never shorter than asked.
+ * Input: Integer for the value of milliseconds to spend.
+ * Output: void.
+ * Created in: 07/01/2023 by Antonio Aparecido Ariza Castilho
+ ******************************************************************************/
+void ms_time(uint16_t ms)
+{
+    while(ms--) __delay_ms(1); // On the host model: the cycles of 1 ms.
+} // end ms_time(uint16 ms)
+
+/*******************************************************************************
+ * Function: void us_time(uint16_t ms);
+ * Description: Function to spend CPU time: steps of __delay_us(10), the last
+ *              one for the rest (1 to 9 us) too, so never shorter than asked.
+ *              At 8 MHz 10 us is 20 Tcy, a step of the loop a few more.
+ * Input: Integer for the microseconds to spend value
+ * Output: void.
+ * Created in: 07/01/2023 by Antonio Aparecido Ariza Castilho
+ ******************************************************************************/
+void us_time(uint16_t us)
+{
+    while(us >= 10)
+    {
+        __delay_us(10);
+        us -= 10;
+    }
+    if(us) __delay_us(10);
+} // end us_time(uint16_t us)
\ No newline at end of file
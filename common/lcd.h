@@ -0,0 +1,340 @@
+/* ****************************************************************************
+ * Project: Control Functions             File lcd.c                 March/2022
+ * ****************************************************************************
+ * File description: Functions for 16x2 LCD display control, with PIC18F4550.      
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * * MicroChip Developer Help sample program files. 
+ *   <https://microchipdeveloper.com/>.
+ * * HD44780U dot-matrix liquid crystal display controller Datasheet
+ *   <https://www.digchip.com/datasheets/parts/datasheet/740/HD44780U-pdf.php>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 03/23/2022| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Texts of program memory, lcd_prtRom() with TBLRD*+
+ * 10/19/2026| Antonio Castilho  | Pin map, one masked write of LATD per nibble, LCD_D7 = RD7
+ * 10/19/2026| Antonio Castilho  | lcd_iniStart(), lcd_task(), lcd_splash(): start without waiting
+ * 10/19/2026| Antonio Castilho  | Geometry (16x2, 20x4, 40x2, 40x4 with E2), clip/wrap, frame buffer
+ * 10/19/2026| Antonio Castilho  | I2C backpack (PCF8574), queue sent by the SSP interrupt
+ * 10/19/2026| Antonio Castilho  | One source in common/ for the nine projects, lcd_i2cQueue volatile
+ * 10/19/2026| Antonio Castilho  | lcd_prtRom() streams with TBLRD*+, texts const __rom char
+ ******************************************************************************/
+
+#ifndef LCD_16X2_H
+#define	LCD_16X2_H
+
+/******************************************************************************/
+// Include header files.
+/******************************************************************************/
+#include <xc.h>
+#include <stdlib.h>
+#include <math.h>
+// _XTAL_FREQ and the pin map of the board, if not the one below: from the
+// lcd.h of the project, which includes this file.
+
+
+/******************************************************************************/
+// Geometry of the display
+/******************************************************************************/
+// Columns and rows of the module: 16x2 (default), 20x4, 40x2 or 40x4; 16x1,
+// 16x4, 20x2 and 24x2 work too. Rows 1 to LCD_ROWS, columns 0 to LCD_COLS - 1.
+// DDRAM address of column 0 of each row (LCD_ROW_ADDR() of lcd.c):
+//     row 1: 0x00    row 2: 0x40
+//     row 3: 0x00 + LCD_COLS    row 4: 0x40 + LCD_COLS  (rows 3 and 4 are
+//     the end of the lines of rows 1 and 2)
+// A 40x4 has 160 characters and a controller takes 80: it has two, with the
+// same bus and one E each, rows 1 and 2 on E and rows 3 and 4 on E2 (both at
+// 0x00 and 0x40 of their controller). The commands (lcd_com()) go to both.
+// A text longer than the row is cut at the last column (LCD_CLIP, default)
+// or goes on at column 0 of the next row (LCD_WRAP), see lcd_setWrap().
+#ifndef LCD_COLS
+    #define LCD_COLS        16
+#endif
+#ifndef LCD_ROWS
+    #define LCD_ROWS        2
+#endif
+
+#if LCD_ROWS == 4 && LCD_COLS > 20
+    #define LCD_CONTROLLERS 2
+#else
+    #define LCD_CONTROLLERS 1
+#endif
+
+// The build fails with a geometry the controller can not address.
+typedef char lcd_geometry_check[(LCD_COLS >= 8 && ((LCD_ROWS >= 1 && LCD_ROWS <= 2 && LCD_COLS <= 40)
+        || (LCD_ROWS == 4 && (LCD_COLS <= 20 || LCD_COLS == 40)))) ? 1 : -1];
+
+#define LCD_CLIP        0   // lcd_setWrap(): characters after the last column are lost.
+#define LCD_WRAP        1   // lcd_setWrap(): they go on in the next row.
+
+/******************************************************************************/
+// Bus of the display
+/******************************************************************************/
+// LCD_BUS_PORT (default): the lines of the display on a port of the PIC, pin
+// map below. LCD_BUS_I2C: a PCF8574 backpack on the MSSP, see "I2C backpack";
+// the pin map is then the one of the outputs P0..P7 of the PCF8574.
+#define LCD_BUS_PORT    0
+#define LCD_BUS_I2C     1
+#ifndef LCD_BUS
+    #define LCD_BUS     LCD_BUS_PORT
+#endif
+
+/******************************************************************************/
+// LCD Display pins setting
+/******************************************************************************/
+// Pin map: bit of the port of each line. All the lines on one port; the
+// driver only writes its latch (LATx), never PORTx, and only the bits below.
+// lcd.c makes the bus functions from this map at compile time: data bits
+// D4..D7 in order (contiguous) are one shift, other orders one OR per bit;
+// either way each nibble is a single write of the latch.
+// A board with other pins defines them before this file (all of them).
+#ifndef LCD_PIN_E
+#if LCD_BUS == LCD_BUS_I2C
+    // Outputs of the usual backpack. No LCD_LAT: the latch is the PCF8574.
+    #define LCD_PIN_RS      0       // P0
+    #define LCD_PIN_RW      1       // P1 (always 0: write only)
+    #define LCD_PIN_E       2       // P2
+    #if LCD_CONTROLLERS == 2
+        #define LCD_PIN_E2  3       // P3: E of rows 3 and 4 of a 40x4, backlight wired on.
+    #else
+        #define LCD_PIN_BL  3       // P3: backlight, always on.
+    #endif
+    #define LCD_PIN_D4      4       // P4
+    #define LCD_PIN_D5      5       // P5
+    #define LCD_PIN_D6      6       // P6
+    #define LCD_PIN_D7      7       // P7
+#else
+    #define LCD_LAT         LATD    // Output latch of the port of the display.
+    #define LCD_TRIS        TRISD
+    #define LCD_PIN_E       0       // RD0
+    #define LCD_PIN_RS      1       // RD1
+    #define LCD_PIN_RW      2       // RD2 (always 0: write only)
+    //                                 RD3 free to use
+    #define LCD_PIN_D4      4       // RD4
+    #define LCD_PIN_D5      5       // RD5
+    #define LCD_PIN_D6      6       // RD6
+    #define LCD_PIN_D7      7       // RD7
+    #if LCD_CONTROLLERS == 2
+        #define LCD_PIN_E2  3       // RD3: E of rows 3 and 4 of a 40x4.
+    #endif
+#endif
+#endif
+
+#define LCD_MASK(pin)   ((uint8_t)(1u << (pin)))
+#if LCD_CONTROLLERS == 2
+    #define LCD_E_MASK  (LCD_MASK(LCD_PIN_E) | LCD_MASK(LCD_PIN_E2))
+    typedef char lcd_e2_check[(LCD_PIN_E2 < 8) ? 1 : -1];
+#else
+    #define LCD_E_MASK  LCD_MASK(LCD_PIN_E)
+#endif
+#define LCD_DATA_MASK   (LCD_MASK(LCD_PIN_D4) | LCD_MASK(LCD_PIN_D5) \
+                         | LCD_MASK(LCD_PIN_D6) | LCD_MASK(LCD_PIN_D7))
+#define LCD_BUS_MASK    (LCD_DATA_MASK | LCD_E_MASK \
+                         | LCD_MASK(LCD_PIN_RS) | LCD_MASK(LCD_PIN_RW))
+#ifdef LCD_PIN_BL
+    #define LCD_BL_MASK LCD_MASK(LCD_PIN_BL)    // Kept at 1 in every byte to the backpack.
+    typedef char lcd_bl_check[(LCD_PIN_BL < 8 && !(LCD_BL_MASK & LCD_BUS_MASK)) ? 1 : -1];
+#else
+    #define LCD_BL_MASK 0
+#endif
+
+// The build fails if a pin is out of the port or two lines share a pin.
+typedef char lcd_pin_check[(LCD_PIN_E < 8 && LCD_PIN_RS < 8 && LCD_PIN_RW < 8
+        && LCD_PIN_D4 < 8 && LCD_PIN_D5 < 8 && LCD_PIN_D6 < 8 && LCD_PIN_D7 < 8
+        && (LCD_E_MASK | LCD_MASK(LCD_PIN_RS) | LCD_MASK(LCD_PIN_RW)
+            | LCD_MASK(LCD_PIN_D4) | LCD_MASK(LCD_PIN_D5) | LCD_MASK(LCD_PIN_D6)
+            | LCD_MASK(LCD_PIN_D7)) == (LCD_E_MASK + LCD_MASK(LCD_PIN_RS)
+            + LCD_MASK(LCD_PIN_RW) + LCD_MASK(LCD_PIN_D4) + LCD_MASK(LCD_PIN_D5)
+            + LCD_MASK(LCD_PIN_D6) + LCD_MASK(LCD_PIN_D7))) ? 1 : -1];
+/******************************************************************************/
+
+/******************************************************************************/
+// Macros for cursor positioning (16x2 names; lcd_goto() for any place)
+/******************************************************************************/
+#define r1c1()     lcd_goto(1, 0) // row 1, column 1.
+#define r1c2()     lcd_goto(1, 1)
+#define r1c3()     lcd_goto(1, 2)
+#define r1c4()     lcd_goto(1, 3)
+#define r1c5()     lcd_goto(1, 4)
+#define r1c6()     lcd_goto(1, 5)
+#define r1c7()     lcd_goto(1, 6)
+#define r1c8()     lcd_goto(1, 7)
+#define r1c9()     lcd_goto(1, 8)
+#define r1c10()    lcd_goto(1, 9)
+#define r1c11()    lcd_goto(1, 10)
+#define r1c12()    lcd_goto(1, 11)
+#define r1c13()    lcd_goto(1, 12)
+#define r1c14()    lcd_goto(1, 13)
+#define r1c15()    lcd_goto(1, 14)
+#define r1c16()    lcd_goto(1, 15)
+#define r2c1()     lcd_goto(2, 0) // row 2 , column 1
+#define r2c2()     lcd_goto(2, 1)
+#define r2c3()     lcd_goto(2, 2)
+#define r2c4()     lcd_goto(2, 3)
+#define r2c5()     lcd_goto(2, 4)
+#define r2c6()     lcd_goto(2, 5)
+#define r2c7()     lcd_goto(2, 6)
+#define r2c8()     lcd_goto(2, 7)
+#define r2c9()     lcd_goto(2, 8)
+#define r2c10()    lcd_goto(2, 9)
+#define r2c11()    lcd_goto(2, 10)
+#define r2c12()    lcd_goto(2, 11)
+#define r2c13()    lcd_goto(2, 12)
+#define r2c14()    lcd_goto(2, 13)
+#define r2c15()    lcd_goto(2, 14)
+#define r2c16()    lcd_goto(2, 15)
+/******************************************************************************/
+
+/******************************************************************************
+ * Macros for Display Control Functions.
+ ******************************************************************************/
+#define lcd_clear()                lcd_com(0x01) // Display clear.
+#define lcd_cursorHome()     lcd_com(0x02) // Put cursor in row and column 0.
+#define lcd_cursorOff()         lcd_com(0x0C) // Display on, cursor off.
+#define lcd_cursorBlinks()     lcd_com(0x0F) // Display on, cursor blinks
+#define lcd_off()                  lcd_com(0x08) // Display off.
+#define lcd_on()                  lcd_com(0x0E) // Display on, cursor on, no blinks.
+/******************************************************************************/
+
+/******************************************************************************
+ * Texts in program memory.
+ * The texts of a program are listed once, in its ui_text.h:
+ *     #define UI_TEXT(T) \
+ *         T(TXT_WELCOME, "Seja Bem Vindo! ") \
+ *         T(TXT_VERSION, "LCD Interface v0")
+ *     enum { UI_TEXT(LCD_TEXT_ENUM) UI_TEXT_SIZE };
+ *     extern const __rom char ui_text[UI_TEXT_SIZE];
+ * and the table is defined in one of its .c files:
+ *     const __rom char ui_text[UI_TEXT_SIZE] = UI_TEXT(LCD_TEXT_STR);
+ * The enum gives the offset of each text in the table, computed by the
+ * compiler; the table is in program memory, all the texts one after the
+ * other with their '\0'. lcd_prtText(1, 0, TXT_WELCOME) streams the text to
+ * the display with TBLRD*+, without a copy in RAM and without the generic
+ * (RAM or program memory) pointer of lcd_prtStr().
+ * const __rom char: program memory only. lcd_prtRom(), lcd_fbRom() and
+ * lcd_splash() take this type, so XC8 refuses a string of RAM there (its
+ * address would be read as a flash address); a RAM string goes to lcd_prtStr().
+ * The host build (tools/host/xc.h) defines __rom empty and has no such check.
+ ******************************************************************************/
+#define LCD_TEXT_ENUM(name, str)    name, name##_END = name + sizeof(str) - 1,
+#define LCD_TEXT_STR(name, str)     str "\0"
+#define lcd_prtText(row, col, id)   lcd_prtRom(row, col, &ui_text[id])
+#define lcd_fbText(row, col, id)    lcd_fbRom(row, col, &ui_text[id])
+
+/******************************************************************************
+ * Frame buffer.
+ * lcd_fbStr(), lcd_fbRom(), lcd_fbInt() and lcd_fbClear() write a copy of the
+ * screen in RAM, LCD_ROWS x LCD_COLS characters, and mark (one bit each) the
+ * characters that changed. lcd_fbFlush() sends only those, with a cursor move
+ * only where two of them are not side by side. A screen drawn again as a
+ * whole at each update (a dashboard) costs on the bus only what changed,
+ * on any geometry. Rows, columns and LCD_CLIP / LCD_WRAP as in lcd_prtStr().
+ * lcd_clear() does not clear the copy: the next lcd_fbFlush() writes it again.
+ * RAM: LCD_ROWS * LCD_COLS + LCD_ROWS * (LCD_COLS + 7) / 8 bytes, 36 for a
+ * 16x2 and 180 for a 40x4.
+ ******************************************************************************/
+#ifndef LCD_FRAME
+    #define LCD_FRAME       1   // 0: no frame buffer (lcd_fb functions), no RAM for it.
+#endif
+
+/******************************************************************************
+ * Start without waiting.
+ * lcd_ini() waits about 60 ms (power on and the steps of the start of the
+ * HD44780U). lcd_iniStart() only starts them; lcd_task(), called in the main
+ * loop with a free running count of instruction cycles (timebase_now() of
+ * timebase.c), makes each step when its time comes and returns at once, so
+ * the program reads its sensors meanwhile. The splash of lcd_splash() is
+ * written after the start and kept for its time. lcd_task() returns 1 when
+ * the display is free for the program; while it returns 0 no other lcd_
+ * function may be called.
+ *     lcd_iniStart(timebase_now());
+ *     lcd_splash(&ui_text[TXT_WELCOME], &ui_text[TXT_VERSION], 3000);
+ *     while(1)
+ *     {
+ *         value = adc_read(0);                    // From the start.
+ *         if(lcd_task(timebase_now())) lcd_prtInt(2, 0, value);
+ *     }
+ ******************************************************************************/
+#define LCD_POWER_US    50000   // Power on to the first step: > 40 ms (VCC 2.7 V).
+#define LCD_INLINE_US   100     // Waits up to this are made inside lcd_task().
+
+/******************************************************************************
+ * I2C backpack (LCD_BUS == LCD_BUS_I2C).
+ * A byte written to the PCF8574 sets its 8 outputs: a nibble is two bytes,
+ * the data with E = 1 and the same with E = 0 (and one before them when RS
+ * changes, for its set up time). The lcd_ functions only put the bytes in a
+ * queue and return; the SSP interrupt sends them, in one write (START,
+ * address, the bytes, STOP) as long as the queue does not run empty. A byte
+ * takes 90 us at 100 kHz, more than the 37 us of a character or command of
+ * the HD44780U, so there is no other wait; a clear or home (1.52 ms) and the
+ * steps of the start are followed by copies of the last byte, the bus time
+ * being the wait. A 16x2 screen is about 150 bytes: lcd_fbFlush(0) of all of
+ * it returns in a fraction of a ms and is sent in one write of about 13 ms.
+ * With the queue full, a lcd_ function waits for room.
+ * The program calls lcd_isr() from its interrupt (low priority, SSPIP = 0)
+ * and enables the interrupts (IPEN, GIEH, GIEL):
+ *     void __interrupt(low_priority) isr_low(void)
+ *     {
+ *         lcd_isr();
+ *     }
+ * lcd_task() returns 0 while the queue of the start or of the splash is
+ * sent. A backpack that does not answer (NACK) loses the bytes of the write.
+ * SDA is RB0 and SCL RB1 (digital: lcd.c leaves AN0..AN9 of ADCON1 only);
+ * the MSSP is not then free for the SPI of the MCP2515 (CANet.X).
+ ******************************************************************************/
+#ifndef LCD_I2C_ADDR
+    #define LCD_I2C_ADDR    0x27    // 7 bits. PCF8574, A2..A0 at 1 (PCF8574A: 0x3F).
+#endif
+#ifndef LCD_I2C_HZ
+    #define LCD_I2C_HZ      100000  // SCL; the PCF8574 is specified up to 100 kHz.
+#endif
+#ifndef LCD_I2C_QUEUE
+    #define LCD_I2C_QUEUE   160     // Bytes (RAM), up to 255.
+#endif
+#define LCD_I2C_BYTE_US ((9000000UL + LCD_I2C_HZ - 1) / LCD_I2C_HZ) // 8 bits and ACK.
+
+/******************************************************************************/
+// Function prototypes
+/******************************************************************************/
+void lcd_com(uint8_t cmd); // Send a command to the display
+void lcd_ini(void); // initialize the display
+void lcd_iniStart(uint32_t now); // Start without waiting, see lcd_task().
+void lcd_splash(const __rom char *row1, const __rom char *row2, uint16_t ms);
+uint8_t lcd_task(uint32_t now);
+void lcd_prtChar(uint8_t dat); // Write char in display.
+void lcd_prtStr(const uint8_t row, const uint8_t col, const uint8_t *str); //Write string.
+void lcd_prtInt(const uint8_t row, const uint8_t col, const int32_t str);
+void lcd_prtRom(const uint8_t row, const uint8_t col, const __rom char *str); // String of program memory.
+void lcd_goto(const uint8_t row, const uint8_t col); // Cursor to row (1 to LCD_ROWS) and column.
+void lcd_setWrap(const uint8_t mode); // LCD_CLIP or LCD_WRAP.
+#if LCD_FRAME
+void lcd_fbClear(void);
+void lcd_fbStr(const uint8_t row, const uint8_t col, const uint8_t *str);
+void lcd_fbRom(const uint8_t row, const uint8_t col, const __rom char *str);
+void lcd_fbInt(const uint8_t row, const uint8_t col, const int32_t value);
+uint8_t lcd_fbFlush(uint8_t max);
+#endif
+void lcd_wellcome(void); // lcd_ini() and the welcome message.
+#if LCD_BUS == LCD_BUS_I2C
+void lcd_isr(void); // SSP interrupt: next byte of the queue of the backpack.
+#endif
+
+uint8_t digit_counter(uint16_t number);
+
+void ms_time(uint16_t ms);
+void us_time(uint16_t us);
+
+/******************************************************************************/
+
+
+#endif	/* LCD_16X2_H */
+
@@ -0,0 +1,92 @@
+/* Program: ECT Sensor     File: ntc.c     
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ * Description:
+ *          Functions related to obtaining temperature through NTC thermistors.
+ *          Iguau NTC Thermistor 201.0805 <www.iguacu.com.br>.
+ * 
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 04/25/2022 | Antonio Castilho  | Created                                                                    | 00.00.01
+ * 10/19/2026 | Antonio Castilho  | Parameters of param.c, rx computed once                    | 00.00.02
+ * 10/19/2026 | Antonio Castilho  | One source in common/ for ECTsensor.X and Bench.X             | 00.00.03
+ *________________________________________________________________________________________
+ */
+
+/****************************************************************************************
+ * Function: uint16_t ntc_get(uint8_t ch)
+ * ***************************************************************************************
+ * The ntc_get() function reads the specified channel where the NTC thermistor is connected with the 
+ * adc_read() function and converts the value into temperature in degrees Celsius. Range from 0 to 100.00 'C . 
+ * To convert the value, the Beta Formula is applied, which uses a material coefficient, which can be obtained 
+ * through measurements. In a table, kindly provided by the sensor manufacturer, it is possible to obtain the 
+ * values of temperature x resistance, and thus define values of the constants of the formula.
+ *
+ *                       resistor_ntc = r0 * e^(beta*(1/temperature-1/r0))
+ * Where:
+ *              temperature - temperature being read.
+ *              resistor_ntc - is the resistance at the temperature (in Kelvin) being read.
+ *              r0 - is the reference resistance at temperature t0.
+ *              beta - single material constant.
+ * 
+ * The beta value was obtained by analyzing various information in the NTC thermistor data sheets and 
+ * running experiments directly with the component.
+ * The values are parameters (param_list.h) that can be changed while the program runs.
+ * ***************************************************************************************
+ * Input: Channel where the NTC Thermistor sensor is connected.
+ * Output: Void. 
+ ****************************************************************************************/
+
+#include <xc.h>
+#include "ntc.h"
+#include "prof.h"
+#include "param.h"
+
+static float ntc_rx; // r0 * e^(-beta / t0), computed by ntc_update().
+
+uint16_t ntc_get(uint8_t ch)
+{
+    uint16_t average = 0; // Measurement average.
+    uint16_t temperature = 0; // Temperature being read.
+    uint16_t resistor_ntc = 0; // Is the resistance at the temperature being read.
+    uint16_t voltage = 0; // Voltage obtained on the ADC channel.
+    uint8_t n_sample = (uint8_t)param_get(PARAM_NTC_SAMPLES);
+    float r_ref = (float)param_get(PARAM_NTC_R_REF);
+    
+    for(uint8_t i = 0; i < n_sample; i++)
+    {
+        PROF_ENTER(PROBE_ADC);
+        average += adc_read(ch); // Makes an amount of ADC channel measurements specified in ntc.h.
+        PROF_EXIT(PROBE_ADC);
+        __delay_ms(10);
+    }
+    // Calculate the voltage.
+    voltage = (uint16_t)round( ( ( (float)VCC *  ((float)average/(float)n_sample) ) / 1023.0 ) *100 );
+    // Calculates resistance on NTC thermistor.
+    resistor_ntc = (uint16_t)round(((float)voltage/100.0) * (r_ref / ((float)VCC - ((float)voltage/100.0 ))));
+    // Calculates temperature using Formula Beta and the parameters of param_list.h.
+    temperature = (uint16_t)round(( ( (float)param_get(PARAM_NTC_BETA) / log( ((float)resistor_ntc) / ntc_rx ) ) - 273.15 ) *100 );
+    // Returns the temperature value accurately to two decimal places. cd.dc.
+    return temperature;
+    
+    // TODO Take this function to an RTOS system.
+    // TODO Enlarge range to mdc.dc (0 to 1000.00).
+    // TODO Develop other functions to use with NTC thermistor.
+}
+
+/****************************************************************************************
+ * Function: void ntc_update(void)
+ * ***************************************************************************************
+ * Computes again rx = r0 * e^(-beta / t0), the part of the Beta Formula that only depends on
+ * the parameters, so exp() is not called at each reading. Called by param.c when beta, r0 or t0
+ * change (param_list.h) and by param_ini().
+ * ***************************************************************************************
+ * Input: void
+ * Output: void
+ ****************************************************************************************/
+void ntc_update(void)
+{
+    ntc_rx = (float)param_get(PARAM_NTC_R0)
+             * (float)exp(-(float)param_get(PARAM_NTC_BETA) / (float)param_get(PARAM_NTC_T0));
+}
@@ -0,0 +1,35 @@
+/* Program: ECT Sensor     File: ntc.h    
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ * Description:
+ *      This program uses a Thermistor to measure the temperature and display it on the LCD Display.
+ *      The Thermistor chosen is an Iguau 201.0805, for automotive application <www.iguacu.com.br>.
+ *      Function definitions are in the ntc.c file.
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 04/25/2022 | Antonio Castilho  | Created                                                                    | 00.00.01
+ * 10/19/2026 | Antonio Castilho  | Constants are parameters of param_list.h                    | 00.00.02
+ * 10/19/2026 | Antonio Castilho  | One source in common/ for ECTsensor.X and Bench.X             | 00.00.03
+ *________________________________________________________________________________________
+ */
+
+// This is a guard condition so that contents of this file are not included
+// more than once.  
+#ifndef NTC_H
+#define	NTC_H
+#include <xc.h>
+#include <math.h>
+// _XTAL_FREQ, the probes and adc_read(): from the ntc.h of the project, which includes this file.
+
+// Beta, r0, t0, reference resistor and number of samples are parameters (param_list.h),
+// changed at run time; param_ini() must be called before ntc_get().
+
+// Values of the suitability circuit for reading the NTC thermistor.
+#define VCC      5 // Reference voltage.
+
+uint16_t ntc_get(uint8_t ch);
+void ntc_update(void);
+
+#endif	/* NTC_H */
+
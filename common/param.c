@@ -0,0 +1,381 @@
+/* ****************************************************************************
+ * Project: Control Functions             File param.c                   October/2026
+ * ****************************************************************************
+ * File description: Parameters changed at run time. See param.h.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet, Section 7.0 Data EEPROM Memory.
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | One source in common/ for ECTsensor.X and Bench.X
+ * 10/19/2026| Antonio Castilho  | Two blocks written in turn with seq, param_getErrors()
+ ******************************************************************************/
+
+#include <xc.h>
+#include "param.h"
+
+#define PARAM_TRIES     3   // Writes of a byte before the save is given up.
+
+#define PARAM_ENTRY(name, type, def, min, max, changed) { type, def, min, max, changed },
+static const param_info_t param_info[PARAM_N] = { PARAM_LIST(PARAM_ENTRY) };
+
+#define PARAM_SEQ       2   // Position of seq in a block.
+#define PARAM_VALUES    3   // Position of the first value.
+
+static int32_t param_value[PARAM_N];
+static uint8_t save_image[PARAM_EE_SIZE];  // Block being written.
+static uint8_t save_index;
+static uint8_t save_tries;
+static uint8_t save_busy;
+static uint8_t save_start;  // EEPROM address of the block for the next save.
+static uint8_t save_seq;    // seq of the newest valid block.
+static uint16_t save_errors; // Saves given up.
+
+/******************************************************************************
+ * Function: static uint8_t param_readByte(uint8_t addr)
+ * Description: Reads one byte of the data EEPROM.
+ * Input: address.
+ * Output: byte.
+ ******************************************************************************/
+static uint8_t param_readByte(uint8_t addr)
+{
+    EEADR = addr;
+    EECON1bits.EEPGD = 0;
+    EECON1bits.CFGS = 0;
+    EECON1bits.RD = 1;
+    return EEDATA;
+}
+// end of function static uint8_t param_readByte(uint8_t addr)
+
+/******************************************************************************
+ * Function: static uint16_t param_crc(const uint8_t *bytes, uint8_t length)
+ * Description: CRC-16/CCITT-FALSE (x^16 + x^12 + x^5 + 1, start 0xFFFF).
+ * Input: bytes and how many.
+ * Output: CRC.
+ ******************************************************************************/
+static uint16_t param_crc(const uint8_t *bytes, uint8_t length)
+{
+    uint16_t crc = 0xFFFF;
+    uint8_t bit;
+
+    while(length--)
+    {
+        crc ^= (uint16_t)*bytes++ << 8;
+        for(bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+// end of function static uint16_t param_crc(const uint8_t *bytes, uint8_t length)
+
+/******************************************************************************
+ * Function: static uint8_t param_readBlock(uint8_t start)
+ * Description: Reads a block of the EEPROM to save_image and checks it.
+ * Input: EEPROM address of the block.
+ * Output: 1 valid (version, count and CRC), 0 not.
+ ******************************************************************************/
+static uint8_t param_readBlock(uint8_t start)
+{
+    uint8_t i;
+
+    for(i = 0; i < PARAM_EE_SIZE; i++) save_image[i] = param_readByte((uint8_t)(start + i));
+    return (uint8_t)(save_image[0] == PARAM_VERSION && save_image[1] == PARAM_N
+            && param_crc(save_image, PARAM_EE_SIZE - 2)
+               == (uint16_t)(save_image[PARAM_EE_SIZE - 2] | ((uint16_t)save_image[PARAM_EE_SIZE - 1] << 8)));
+}
+// end of function static uint8_t param_readBlock(uint8_t start)
+
+/******************************************************************************
+ * Function: static void param_changedAll(void)
+ * Description: Calls each function of the list once, after all the values
+ * changed at once (start, defaults).
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+static void param_changedAll(void)
+{
+    uint8_t i;
+    uint8_t j;
+
+    for(i = 0; i < PARAM_N; i++)
+    {
+        if(!param_info[i].changed) continue;
+        for(j = 0; j < i && param_info[j].changed != param_info[i].changed; j++);
+        if(j == i) param_info[i].changed();
+    }
+}
+// end of function static void param_changedAll(void)
+
+/******************************************************************************
+ * Function: void param_ini(void)
+ * Description: Values of the newest valid EEPROM block, defaults without
+ * one, and the dependent values computed (all the functions of the list
+ * called). The next save goes to the other block.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void param_ini(void)
+{
+    uint8_t i;
+    uint8_t valid0;
+    uint8_t valid;
+    uint8_t seq0;
+    int32_t value;
+
+    valid0 = param_readBlock(PARAM_EE_START);
+    seq0 = save_image[PARAM_SEQ];
+    valid = param_readBlock((uint8_t)(PARAM_EE_START + PARAM_EE_SIZE));
+    if(valid && (!valid0 || (int8_t)(save_image[PARAM_SEQ] - seq0) > 0))
+    {
+        save_start = PARAM_EE_START;    // Block 1 is the newest, in save_image.
+    }
+    else
+    {
+        valid = valid0;
+        if(valid) (void)param_readBlock(PARAM_EE_START);
+        save_start = (uint8_t)(PARAM_EE_START + PARAM_EE_SIZE);
+    }
+    save_seq = valid ? save_image[PARAM_SEQ] : 0xFF; // The first save with seq 0.
+
+    for(i = 0; i < PARAM_N; i++)
+    {
+        value = (int32_t)((uint32_t)save_image[PARAM_VALUES + 4 * i]
+                | ((uint32_t)save_image[PARAM_VALUES + 1 + 4 * i] << 8)
+                | ((uint32_t)save_image[PARAM_VALUES + 2 + 4 * i] << 16)
+                | ((uint32_t)save_image[PARAM_VALUES + 3 + 4 * i] << 24));
+        if(!valid || value < param_info[i].min || value > param_info[i].max) value = param_info[i].def;
+        param_value[i] = value;
+    }
+    save_busy = 0;
+    save_errors = 0;
+    param_changedAll();
+}
+// end of function void param_ini(void)
+
+/******************************************************************************
+ * Function: int32_t param_get(uint8_t id)
+ * Description: Value of a parameter.
+ * Example: beta = (uint16_t)param_get(PARAM_NTC_BETA);
+ * Input: PARAM_name.
+ * Output: value (0 for an unknown id).
+ ******************************************************************************/
+int32_t param_get(uint8_t id)
+{
+    if(id >= PARAM_N) return 0;
+    return param_value[id];
+}
+// end of function int32_t param_get(uint8_t id)
+
+/******************************************************************************
+ * Function: uint8_t param_set(uint8_t id, int32_t value)
+ * Description: Changes a parameter (in RAM; param_save() keeps it) and calls
+ * its function, if the value is new.
+ * Input: PARAM_name and value, inside the limits of the list.
+ * Output: PARAM_OK, PARAM_ERROR_ID or PARAM_ERROR_RANGE (value not changed).
+ ******************************************************************************/
+uint8_t param_set(uint8_t id, int32_t value)
+{
+    if(id >= PARAM_N) return PARAM_ERROR_ID;
+    if(value < param_info[id].min || value > param_info[id].max) return PARAM_ERROR_RANGE;
+    if(value == param_value[id]) return PARAM_OK;
+    param_value[id] = value;
+    if(param_info[id].changed) param_info[id].changed();
+    return PARAM_OK;
+}
+// end of function uint8_t param_set(uint8_t id, int32_t value)
+
+/******************************************************************************
+ * Function: void param_defaults(void)
+ * Description: All the parameters back to the defaults (in RAM; param_save()
+ * keeps them).
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void param_defaults(void)
+{
+    uint8_t i;
+
+    for(i = 0; i < PARAM_N; i++) param_value[i] = param_info[i].def;
+    param_changedAll();
+}
+// end of function void param_defaults(void)
+
+/******************************************************************************
+ * Function: uint8_t param_save(void)
+ * Description: Starts the save of the values in the EEPROM block not holding
+ * the newest values, with the next seq; param_task() writes them. A value
+ * changed during the save goes in the next one.
+ * Input: void
+ * Output: 1 started, 0 a save is in progress.
+ ******************************************************************************/
+uint8_t param_save(void)
+{
+    uint8_t i;
+    uint16_t crc;
+
+    if(save_busy) return 0;
+    save_image[0] = PARAM_VERSION;
+    save_image[1] = PARAM_N;
+    save_image[PARAM_SEQ] = (uint8_t)(save_seq + 1);
+    for(i = 0; i < PARAM_N; i++)
+    {
+        save_image[PARAM_VALUES + 4 * i] = (uint8_t)param_value[i];
+        save_image[PARAM_VALUES + 1 + 4 * i] = (uint8_t)(param_value[i] >> 8);
+        save_image[PARAM_VALUES + 2 + 4 * i] = (uint8_t)(param_value[i] >> 16);
+        save_image[PARAM_VALUES + 3 + 4 * i] = (uint8_t)(param_value[i] >> 24);
+    }
+    crc = param_crc(save_image, PARAM_EE_SIZE - 2);
+    save_image[PARAM_EE_SIZE - 2] = (uint8_t)crc;
+    save_image[PARAM_EE_SIZE - 1] = (uint8_t)(crc >> 8);
+    save_index = 0;
+    save_tries = 0;
+    save_busy = 1;
+    return 1;
+}
+// end of function uint8_t param_save(void)
+
+/******************************************************************************
+ * Function: uint8_t param_isSaving(void)
+ * Description: Tells if a save is in progress.
+ * Input: void
+ * Output: 1 saving, 0 idle.
+ ******************************************************************************/
+uint8_t param_isSaving(void)
+{
+    return save_busy;
+}
+// end of function uint8_t param_isSaving(void)
+
+/******************************************************************************
+ * Function: void param_task(void)
+ * Description: With a save in progress and the EEPROM idle, starts the write
+ * of the next byte that differs from the EEPROM (the byte written before is
+ * read back here, and written again if wrong). Returns at once; call it in
+ * the main loop, the save takes about 4 ms per byte changed. At the end the
+ * block written holds the newest values and the next save goes to the other
+ * one; a save given up (a byte wrong after PARAM_TRIES writes) is counted and
+ * leaves the newest values in the other block, the next save tries again
+ * in the same one.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void param_task(void)
+{
+    uint8_t addr;
+    uint8_t gieh;
+
+    if(!save_busy || EECON1bits.WR || PARAM_EE_BUSY()) return;
+
+    while(save_index < PARAM_EE_SIZE
+          && param_readByte((uint8_t)(save_start + save_index)) == save_image[save_index])
+    {
+        save_index++;
+        save_tries = 0;
+    }
+    if(save_index == PARAM_EE_SIZE)
+    {
+        EECON1bits.WREN = 0;
+        save_busy = 0;
+        save_seq = save_image[PARAM_SEQ];
+        save_start = (uint8_t)((save_start == PARAM_EE_START) ? PARAM_EE_START + PARAM_EE_SIZE
+                                                               : PARAM_EE_START);
+        return;
+    }
+    if(save_tries++ == PARAM_TRIES)
+    {
+        EECON1bits.WREN = 0;
+        save_busy = 0;
+        save_errors++;
+        return;
+    }
+
+    addr = (uint8_t)(save_start + save_index);
+    EEADR = addr;
+    EEDATA = save_image[save_index];
+    EECON1bits.EEPGD = 0;
+    EECON1bits.CFGS = 0;
+    EECON1bits.WREN = 1;
+    gieh = INTCONbits.GIEH;
+    INTCONbits.GIEH = 0; // 55h/AAh sequence without interrupts.
+    EECON2 = 0x55;
+    EECON2 = 0xAA;
+    EECON1bits.WR = 1;
+    INTCONbits.GIEH = gieh;
+}
+// end of function void param_task(void)
+
+/******************************************************************************
+ * Function: uint16_t param_getErrors(void)
+ * Description: Saves given up since param_ini(): a cell of the EEPROM that
+ * does not keep its byte (worn out).
+ * Input: void
+ * Output: count.
+ ******************************************************************************/
+uint16_t param_getErrors(void)
+{
+    return save_errors;
+}
+// end of function uint16_t param_getErrors(void)
+
+/******************************************************************************
+ * Function: uint8_t param_command(const uint8_t *command, uint8_t length,
+ *                                 uint8_t *reply)
+ * Description: Runs a command received by UART or CAN (see param.h) and
+ * fills the reply with the value of the parameter after it.
+ * Example: n = param_command(frame, 6, out);  // Sends out[0..n-1].
+ * Input: command, its length and buffer of PARAM_REPLY_LENGTH bytes.
+ * Output: length of the reply.
+ ******************************************************************************/
+uint8_t param_command(const uint8_t *command, uint8_t length, uint8_t *reply)
+{
+    uint8_t id = (length > 1) ? command[1] : 0;
+    uint8_t status = PARAM_OK;
+    int32_t value;
+
+    switch((length > 0) ? command[0] : 0)
+    {
+        case PARAM_CMD_GET:
+            if(id >= PARAM_N) status = PARAM_ERROR_ID;
+            break;
+        case PARAM_CMD_SET:
+            if(length < PARAM_CMD_LENGTH)
+            {
+                status = PARAM_ERROR_OP;
+                break;
+            }
+            value = (int32_t)((uint32_t)command[2] | ((uint32_t)command[3] << 8)
+                    | ((uint32_t)command[4] << 16) | ((uint32_t)command[5] << 24));
+            status = param_set(id, value);
+            break;
+        case PARAM_CMD_SAVE:
+            if(!param_save()) status = PARAM_ERROR_BUSY;
+            break;
+        case PARAM_CMD_DEFAULTS:
+            param_defaults();
+            break;
+        default:
+            status = PARAM_ERROR_OP;
+            break;
+    }
+
+    value = param_get(id);
+    reply[0] = status;
+    reply[1] = id;
+    reply[2] = (uint8_t)value;
+    reply[3] = (uint8_t)(value >> 8);
+    reply[4] = (uint8_t)(value >> 16);
+    reply[5] = (uint8_t)(value >> 24);
+    reply[6] = (id < PARAM_N) ? param_info[id].type : 0xFF;
+    return PARAM_REPLY_LENGTH;
+}
+// end of function uint8_t param_command(...)
@@ -0,0 +1,124 @@
+/* ****************************************************************************
+ * Project: Control Functions             File param.h                   October/2026
+ * ****************************************************************************
+ * File description: Parameters that can be changed at run time, without a new
+ *     build: defaults in program memory, changes kept in the data EEPROM.
+ *     The parameters of a program are listed once in its param_list.h:
+ *         #define PARAM_VERSION   1   // Changed when the list changes.
+ *         #define PARAM_LIST(P) \
+ *             P(NTC_BETA, PARAM_U16, 3600, 1000, 10000, ntc_update) \
+ *             P(NTC_SAMPLES, PARAM_U8, 10, 1, 64, 0)
+ *     P(name, type, default, min, max, changed): the list gives the index
+ *     PARAM_name (enum, so param_get(PARAM_NTC_BETA) is one array access),
+ *     the table of defaults and limits (const, in program memory) and the
+ *     function called after a change of the value (0: none), where the
+ *     values that depend on it are computed again.
+ *     Values are integers (PARAM_U8 ... PARAM_I32) kept as int32_t; a
+ *     quantity with decimals is given in a smaller unit (mV, 0.1 %).
+ *
+ *     Two EEPROM blocks of PARAM_EE_SIZE bytes from PARAM_EE_START, written
+ *     in turn (as the slots of eelog.c):
+ *         | PARAM_VERSION | PARAM_N | seq | value 0 (4 bytes, LSB first) ... | CRC-16 |
+ *     CRC-16/CCITT-FALSE of the bytes before it; seq grows by one at each
+ *     save. A block is valid with version, count and CRC right; param_ini()
+ *     takes the valid one of larger seq, compared as (int8_t)(a - b) > 0, and
+ *     each value only inside its limits; with no valid block, the defaults.
+ *     param_save() copies the values to a RAM image for the other block and
+ *     param_task(), called in the main loop, writes one byte each time the
+ *     EEPROM is idle (bytes already equal are skipped), so no write waits
+ *     4 ms. A power loss in the middle leaves that block with a wrong CRC:
+ *     the values of the save before, still whole in the other block.
+ *     A byte that does not take after PARAM_TRIES writes gives the save up,
+ *     counted by param_getErrors().
+ *
+ *     param_command() takes a command of up to 6 bytes and gives a reply of
+ *     7 bytes (both fit a CAN data field or a UART frame), for the changes
+ *     made from a PC while the program runs (ECTsensor.X: TLM_PARAM records
+ *     of telemetry.c):
+ *         command  | op | id | value (4 bytes, LSB first) |
+ *         reply    | status | id | value (4 bytes) | type |
+ *     op: PARAM_CMD_GET, PARAM_CMD_SET, PARAM_CMD_SAVE, PARAM_CMD_DEFAULTS.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet, Section 7.0 Data EEPROM Memory.
+ * ****************************************************************************
+ * Date          | Author                | Description
+ * ****** ***|******* *******|***************************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | One source in common/, the list from the param.h of the project
+ * 10/19/2026| Antonio Castilho  | Two blocks written in turn with seq, param_getErrors()
+ ******************************************************************************/
+
+#ifndef PARAM_H
+#define	PARAM_H
+
+#include <xc.h>
+#include <stdint.h>
+
+// Types.
+#define PARAM_U8        0
+#define PARAM_U16       1
+#define PARAM_U32       2   // Up to 0x7FFFFFFF.
+#define PARAM_I8        3
+#define PARAM_I16       4
+#define PARAM_I32       5
+
+// PARAM_VERSION and PARAM_LIST: from the param_list.h of the project, included by
+// its param.h before this file.
+#ifndef PARAM_LIST
+    #error "param.h of the project includes its param_list.h before ../common/param.h"
+#endif
+
+#define PARAM_ENUM(name, type, def, min, max, changed) PARAM_##name,
+enum { PARAM_LIST(PARAM_ENUM) PARAM_N };
+
+#ifndef PARAM_EE_START
+    #define PARAM_EE_START  0x80    // After the log of eelog.c.
+#endif
+#ifndef PARAM_EE_BUSY
+    #define PARAM_EE_BUSY() 0       // Other writer of the EEPROM with a write in progress.
+#endif
+#define PARAM_EE_SIZE   (3 + 4 * PARAM_N + 2)   // One block; two from PARAM_EE_START.
+typedef char param_ee_check[(PARAM_EE_START + 2 * PARAM_EE_SIZE <= 256) ? 1 : -1];
+
+// Status of param_set() and of the replies.
+#define PARAM_OK            0
+#define PARAM_ERROR_ID      1
+#define PARAM_ERROR_RANGE   2
+#define PARAM_ERROR_BUSY    3
+#define PARAM_ERROR_OP      4
+
+// Commands of param_command().
+#define PARAM_CMD_GET       'G'
+#define PARAM_CMD_SET       'S'
+#define PARAM_CMD_SAVE      'W' // Values to the EEPROM.
+#define PARAM_CMD_DEFAULTS  'D' // Defaults, not saved.
+#define PARAM_CMD_LENGTH    6
+#define PARAM_REPLY_LENGTH  7
+
+typedef struct
+{
+    uint8_t type;
+    int32_t def;
+    int32_t min;
+    int32_t max;
+    void (*changed)(void);
+} param_info_t;
+
+void param_ini(void);
+int32_t param_get(uint8_t id);
+uint8_t param_set(uint8_t id, int32_t value);
+void param_defaults(void);
+uint8_t param_save(void);
+uint8_t param_isSaving(void);
+void param_task(void);
+uint16_t param_getErrors(void);
+uint8_t param_command(const uint8_t *command, uint8_t length, uint8_t *reply);
+
+#endif	/* PARAM_H */
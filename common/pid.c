@@ -0,0 +1,122 @@
+/* ****************************************************************************
+ * Project: Basic control functions       File pid.c              October/2026
+ * ****************************************************************************
+ * Description: PID controller in Q15 fixed point. See pid.h.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * * Astrom, K. J.; Hagglund, T. PID Controllers: Theory, Design and Tuning.
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | int32 derivative difference (16-bit int on XC8);
+ *           |                   | one source in common/ for PWM.X and Bench.X
+ ******************************************************************************/
+
+#include "pid.h"
+
+#define GAIN_SHIFT      (15 - PID_SCALE)
+
+/******************************************************************************
+ * Function: static int16_t pid_sat(int32_t value)
+ * Description: Limits a value to the Q15 range.
+ ******************************************************************************/
+static int16_t pid_sat(int32_t value)
+{
+    if(value > 32767) return 32767;
+    if(value < -32768) return -32768;
+    return (int16_t)value;
+}
+// end of function static int16_t pid_sat(int32_t value)
+
+/******************************************************************************
+ * Function: void pid_ini(pid_ctrl_t *pid, int16_t kp, int16_t ki, int16_t kd,
+ *                        int16_t alpha, int16_t out_min, int16_t out_max)
+ * Description: Sets gains, derivative filter and output limits, and clears the
+ * state.
+ * Example: pid_ini(&pid, PID_GAIN(1.5), PID_GAIN(0.02), PID_GAIN(0.5),
+ *                  PID_Q15(0.2), 0, PID_Q15(1.0));
+ * Input: controller, gains, alpha and output limits.
+ * Output: void
+ ******************************************************************************/
+void pid_ini(pid_ctrl_t *pid, int16_t kp, int16_t ki, int16_t kd, int16_t alpha,
+             int16_t out_min, int16_t out_max)
+{
+    pid->kp = kp;
+    pid->ki = ki;
+    pid->kd = kd;
+    pid->alpha = alpha;
+    pid->out_min = out_min;
+    pid->out_max = out_max;
+    pid_reset(pid, 0, out_min);
+}
+// end of function void pid_ini(...)
+
+/******************************************************************************
+ * Function: void pid_reset(pid_ctrl_t *pid, int16_t pv, int16_t out)
+ * Description: Clears the state for a bumpless start: the integral starts at
+ * the present output and the derivative sees no step.
+ * Input: controller, present measurement and output.
+ * Output: void
+ ******************************************************************************/
+void pid_reset(pid_ctrl_t *pid, int16_t pv, int16_t out)
+{
+    pid->integral = (int32_t)out << GAIN_SHIFT;
+    pid->derivative = 0;
+    pid->pv_previous = pv;
+}
+// end of function void pid_reset(pid_ctrl_t *pid, int16_t pv, int16_t out)
+
+/******************************************************************************
+ * Function: int16_t pid_run(pid_ctrl_t *pid, int16_t setpoint, int16_t pv)
+ * Description: One sample of the controller:
+ *      out = kp * e + sum(ki * e) + filter(kd * (pv[n-1] - pv[n]))
+ * Input: controller, set point and measurement (Q15).
+ * Output: control output (Q15), inside out_min and out_max.
+ ******************************************************************************/
+int16_t pid_run(pid_ctrl_t *pid, int16_t setpoint, int16_t pv)
+{
+    int16_t error = pid_sat((int32_t)setpoint - pv);
+    int32_t max = (int32_t)pid->out_max << GAIN_SHIFT;
+    int32_t min = (int32_t)pid->out_min << GAIN_SHIFT;
+    int32_t integral;
+    int32_t out;
+    int16_t d;
+
+    // Derivative on the measurement, first order filter.
+    d = pid_sat(((int32_t)pid->kd * pid_sat((int32_t)pid->pv_previous - pv)) >> GAIN_SHIFT);
+    pid->derivative += (int16_t)((((int32_t)d - (int32_t)pid->derivative) * pid->alpha) >> 15);
+    pid->pv_previous = pv;
+
+    // Integral kept with GAIN_SHIFT more bits: small errors are not lost.
+    integral = pid->integral + (int32_t)pid->ki * error;
+    if(integral > max) integral = max;
+    if(integral < min) integral = min;
+
+    out = (((int32_t)pid->kp * error) >> GAIN_SHIFT) + (integral >> GAIN_SHIFT) + pid->derivative;
+
+    if(out > pid->out_max)
+    {
+        out = pid->out_max;
+        if(error < 0) pid->integral = integral; // Only integrate back from the limit.
+    }
+    else if(out < pid->out_min)
+    {
+        out = pid->out_min;
+        if(error > 0) pid->integral = integral;
+    }
+    else
+    {
+        pid->integral = integral;
+    }
+    return (int16_t)out;
+}
+// end of function int16_t pid_run(pid_ctrl_t *pid, int16_t setpoint, int16_t pv)
@@ -0,0 +1,61 @@
+/* ****************************************************************************
+ * Project: Basic control functions       File pid.h              October/2026
+ * ****************************************************************************
+ * Description: PID controller in Q15 fixed point, for the interrupt.
+ *   Signals are Q15: -32768 to 32767 is -1.0 to 1.0 (ADC 0 - 1023 << 5).
+ *   Gains are Q15 times 2^PID_SCALE: kp = 32767 is a gain of 16 with
+ *   PID_SCALE 4. ki and kd are per sample: ki = Ki * Ts, kd = Kd / Ts.
+ *     - Anti-windup: the integral stops when the output is saturated and the
+ *       error would push it further, and it is kept inside the output limits.
+ *     - Derivative on the measurement (no kick when the set point changes),
+ *       low-pass filtered: d += alpha * (d_new - d), alpha = Ts / (Tf + Ts).
+ *   Only 16 x 16 multiplications and shifts; no division.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * * Astrom, K. J.; Hagglund, T. PID Controllers: Theory, Design and Tuning.
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | One source in common/ for PWM.X and Bench.X
+ ******************************************************************************/
+
+#ifndef PID_H
+#define	PID_H
+
+#include <stdint.h>
+
+#ifndef PID_SCALE
+    #define PID_SCALE       4   // Gains up to 2^PID_SCALE.
+#endif
+
+#define PID_Q15(x)          ((int16_t)((x) * 32767.0 + 0.5))            // 0.25 -> 8192
+#define PID_GAIN(x)         ((int16_t)((x) * (32768 >> PID_SCALE) + 0.5)) // 2.0 -> 4096
+
+typedef struct
+{
+    int16_t kp;             // Gains, Q15 x 2^PID_SCALE.
+    int16_t ki;
+    int16_t kd;
+    int16_t alpha;          // Derivative filter, Q15.
+    int16_t out_min;        // Output limits, Q15.
+    int16_t out_max;
+    int32_t integral;       // Integral term, Q15 << (15 - PID_SCALE).
+    int16_t derivative;     // Filtered derivative term, Q15.
+    int16_t pv_previous;    // Last measurement.
+} pid_ctrl_t;
+
+void pid_ini(pid_ctrl_t *pid, int16_t kp, int16_t ki, int16_t kd, int16_t alpha,
+             int16_t out_min, int16_t out_max);
+void pid_reset(pid_ctrl_t *pid, int16_t pv, int16_t out);
+int16_t pid_run(pid_ctrl_t *pid, int16_t setpoint, int16_t pv);
+
+#endif	/* PID_H */
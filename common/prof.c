@@ -0,0 +1,233 @@
+/* Program: Profiler     File: prof.c
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ *                     gcc on a PC for the host build (clock_gettime()).
+ * Description:
+ *      Probe table and reports of the profiler. See prof.h.
+ *      Shared by the projects: each one has a prof.c that includes its timebase.h and lcd.h
+ *      and then this file, so timebase_now() and the display are the ones of the project.
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 10/19/2026 | Antonio Castilho  | Created                                                                    | 00.00.01
+ * 10/19/2026 | Antonio Castilho  | One source in common/ for every project                       | 00.00.02
+ *________________________________________________________________________________________
+ */
+
+#include "prof.h"
+
+#if PROF_ENABLE
+
+#if defined(__XC8)
+    #include <xc.h>         // timebase.h and lcd.h: from the prof.c of the project.
+#else
+    #include <stdio.h>
+    #include <time.h>
+#endif
+
+uint32_t prof_begin[PROF_MAX];       // PROF_ENTER() time of each probe.
+static prof_entry_t prof_table[PROF_MAX];
+static uint32_t prof_overhead;       // Time of an empty probe.
+
+/****************************************************************************************
+ * uint32_t prof_clock(void);
+ * PIC: TIMER3 time base, in instruction cycles. PC: monotonic clock, in nanoseconds.
+ * Only the difference of two readings is used, so the wrap does not matter.
+ ****************************************************************************************/
+uint32_t prof_clock(void)
+{
+#if defined(__XC8)
+    return timebase_now();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)ts.tv_sec * 1000000000UL + (uint32_t)ts.tv_nsec;
+#endif
+}
+// end of uint32_t prof_clock(void)
+
+/****************************************************************************************
+ * void prof_reset(void);
+ * Clears the table.
+ ****************************************************************************************/
+void prof_reset(void)
+{
+    for(uint8_t i = 0; i < PROF_MAX; i++)
+    {
+        prof_table[i].count = 0;
+        prof_table[i].min = 0xFFFFFFFF;
+        prof_table[i].max = 0;
+        prof_table[i].total = 0;
+    }
+}
+// end of void prof_reset(void)
+
+/****************************************************************************************
+ * void prof_ini(void);
+ * Clears the table and measures the cost of an empty probe. On the PIC, timebase_ini()
+ * must have been called and the high priority interrupt enabled.
+ ****************************************************************************************/
+void prof_ini(void)
+{
+    uint32_t t;
+
+    prof_overhead = 0xFFFFFFFF;
+    for(uint8_t i = 0; i < 8; i++)
+    {
+        PROF_ENTER(0);
+        t = prof_clock() - prof_begin[0];
+        if(t < prof_overhead) prof_overhead = t;
+    }
+    prof_reset();
+}
+// end of void prof_ini(void)
+
+/****************************************************************************************
+ * void prof_add(uint8_t id, uint32_t time);
+ * Adds one run to the probe id. Called by PROF_EXIT().
+ ****************************************************************************************/
+void prof_add(uint8_t id, uint32_t time)
+{
+    prof_entry_t *p;
+
+    if(id >= PROF_MAX) return;
+    p = &prof_table[id];
+
+    time = (time > prof_overhead) ? time - prof_overhead : 0;
+    p->count++;
+    if(time < p->min) p->min = time;
+    if(time > p->max) p->max = time;
+    p->total = (p->total > 0xFFFFFFFF - time) ? 0xFFFFFFFF : p->total + time;
+}
+// end of void prof_add(uint8_t id, uint32_t time)
+
+/****************************************************************************************
+ * uint8_t prof_get(uint8_t id, prof_entry_t *entry);
+ * Copies the results of the probe id. Returns 0 if the probe has not run yet.
+ ****************************************************************************************/
+uint8_t prof_get(uint8_t id, prof_entry_t *entry)
+{
+    if(id >= PROF_MAX) return 0;
+    *entry = prof_table[id];
+    return (uint8_t)(entry->count != 0);
+}
+// end of uint8_t prof_get(uint8_t id, prof_entry_t *entry)
+
+/****************************************************************************************
+ * static uint8_t prof_utoa(uint8_t *str, uint32_t value);
+ * Writes value in decimal, returns the number of characters (no '\0').
+ ****************************************************************************************/
+static uint8_t prof_utoa(uint8_t *str, uint32_t value)
+{
+    uint8_t digit[10];
+    uint8_t n = 0;
+    uint8_t i = 0;
+
+    do
+    {
+        digit[n++] = (uint8_t)('0' + value % 10);
+        value /= 10;
+    } while(value);
+
+    while(n) str[i++] = digit[--n];
+    return i;
+}
+// end of static uint8_t prof_utoa(uint8_t *str, uint32_t value)
+
+/****************************************************************************************
+ * static uint8_t prof_line(uint8_t *str, uint8_t id);
+ * One line of the report: "id count min max avg". Returns its length.
+ ****************************************************************************************/
+static uint8_t prof_line(uint8_t *str, uint8_t id)
+{
+    const prof_entry_t *p = &prof_table[id];
+    uint8_t n = 0;
+
+    n += prof_utoa(&str[n], id);
+    str[n++] = ' ';
+    n += prof_utoa(&str[n], p->count);
+    str[n++] = ' ';
+    n += prof_utoa(&str[n], p->count ? p->min : 0);
+    str[n++] = ' ';
+    n += prof_utoa(&str[n], p->max);
+    str[n++] = ' ';
+    n += prof_utoa(&str[n], p->count ? p->total / p->count : 0);
+    return n;
+}
+// end of static uint8_t prof_line(uint8_t *str, uint8_t id)
+
+/****************************************************************************************
+ * void prof_dump(void (*putch)(char));
+ * Sends the table, one line per probe that has run, through putch() (UART, stdout, ...):
+ *      "prof id count min max avg cy"    (header, unit "cy" or "ns")
+ *      "2 150 1210 1388 1245"
+ ****************************************************************************************/
+void prof_dump(void (*putch)(char))
+{
+    const char *head = "prof id count min max avg " PROF_UNIT "\r\n";
+    uint8_t str[56];
+    uint8_t n;
+
+    while(*head) putch(*head++);
+    for(uint8_t id = 0; id < PROF_MAX; id++)
+    {
+        if(prof_table[id].count == 0) continue;
+        n = prof_line(str, id);
+        for(uint8_t i = 0; i < n; i++) putch((char)str[i]);
+        putch('\r');
+        putch('\n');
+    }
+}
+// end of void prof_dump(void (*putch)(char))
+
+/****************************************************************************************
+ * void prof_lcdShow(uint8_t id);
+ * Shows the probe id on the display:
+ *      row 1: "P2 n150 a1245"  (id, runs, average)
+ *      row 2: "1210-1388cy"    (minimum - maximum)
+ * On the PC the two rows go to stdout.
+ ****************************************************************************************/
+void prof_lcdShow(uint8_t id)
+{
+    const prof_entry_t *p;
+    uint8_t row1[28];  // Up to 27 characters, cut to the 16 columns.
+    uint8_t row2[28];
+    uint8_t n = 0;
+    uint8_t m = 0;
+
+    if(id >= PROF_MAX) return;
+    p = &prof_table[id];
+
+    row1[n++] = 'P';
+    n += prof_utoa(&row1[n], id);
+    row1[n++] = ' ';
+    row1[n++] = 'n';
+    n += prof_utoa(&row1[n], p->count);
+    row1[n++] = ' ';
+    row1[n++] = 'a';
+    n += prof_utoa(&row1[n], p->count ? p->total / p->count : 0);
+
+    m += prof_utoa(&row2[m], p->count ? p->min : 0);
+    row2[m++] = '-';
+    m += prof_utoa(&row2[m], p->max);
+    row2[m++] = PROF_UNIT[0];
+    row2[m++] = PROF_UNIT[1];
+
+    if(n > 16) n = 16;
+    if(m > 16) m = 16;
+    while(n < 16) row1[n++] = ' '; // Clears the rest of the row.
+    while(m < 16) row2[m++] = ' ';
+    row1[16] = 0;
+    row2[16] = 0;
+
+#if defined(__XC8)
+    lcd_prtStr(1, 0, row1);
+    lcd_prtStr(2, 0, row2);
+#else
+    printf("%s\n%s\n", (char *)row1, (char *)row2);
+#endif
+}
+// end of void prof_lcdShow(uint8_t id)
+
+#endif /* PROF_ENABLE */
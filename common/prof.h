@@ -0,0 +1,87 @@
+/* Program: Profiler     File: prof.h
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ * Description:
+ *      Cycle profiler for the hot paths. Each probe (0 to PROF_MAX - 1) measures the code between
+ *      PROF_ENTER(id) and PROF_EXIT(id) and keeps the number of runs and the minimum, maximum
+ *      and total time in a static table.
+ *
+ *      On the PIC the clock is the time base (timebase.c): one tick per instruction cycle, so the
+ *      results are in cycles. Built with gcc on a PC (no __XC8) the clock is clock_gettime() and
+ *      the results are in nanoseconds; the same probes can then be compared with the target.
+ *      The cost of an empty probe is measured by prof_ini() and taken out of every result.
+ *
+ *      With PROF_ENABLE = 0 (default) the macros are empty and prof.c compiles to nothing.
+ *      Example:
+ *              #define PROF_ENABLE 1   // or -DPROF_ENABLE=1 in the project properties.
+ *              #define PROF_NTC    0
+ *              PROF_ENTER(PROF_NTC);
+ *              temp = ntc_get(pinNTC);
+ *              PROF_EXIT(PROF_NTC);
+ *      A probe is not reentrant: do not use the same id in the main loop and in an interrupt.
+ *      Shared by the projects: their prof.h includes this file.
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 10/19/2026 | Antonio Castilho  | Created                                                                    | 00.00.01
+ * 10/19/2026 | Antonio Castilho  | One source in common/ for every project                       | 00.00.02
+ *________________________________________________________________________________________
+ */
+#ifndef PROF_H
+#define	PROF_H
+
+#include <stdint.h>
+
+#ifndef PROF_ENABLE
+    #define PROF_ENABLE     0       // 1 = probes compiled in.
+#endif
+
+#ifndef PROF_MAX
+    #define PROF_MAX        8       // Number of probes, id 0 to PROF_MAX - 1.
+#endif
+
+#if defined(__XC8)
+    #define PROF_UNIT       "cy"    // Instruction cycles.
+#else
+    #define PROF_UNIT       "ns"
+#endif
+
+typedef struct
+{
+    uint32_t count; // Runs of the probe.
+    uint32_t min;
+    uint32_t max;
+    uint32_t total; // Saturates at 0xFFFFFFFF.
+} prof_entry_t;
+
+#if PROF_ENABLE
+
+extern uint32_t prof_begin[PROF_MAX];
+
+#define PROF_INI()              prof_ini()
+#define PROF_ENTER(id)          (prof_begin[(id)] = prof_clock())
+#define PROF_EXIT(id)           prof_add((id), prof_clock() - prof_begin[(id)])
+#define PROF_RESET()            prof_reset()
+#define PROF_DUMP(putch)        prof_dump(putch)
+#define PROF_LCD(id)            prof_lcdShow(id)
+
+void prof_ini(void);
+void prof_reset(void);
+uint32_t prof_clock(void);
+void prof_add(uint8_t id, uint32_t time);
+uint8_t prof_get(uint8_t id, prof_entry_t *entry);
+void prof_dump(void (*putch)(char));
+void prof_lcdShow(uint8_t id);
+
+#else
+
+#define PROF_INI()              ((void)0)
+#define PROF_ENTER(id)          ((void)0)
+#define PROF_EXIT(id)           ((void)0)
+#define PROF_RESET()            ((void)0)
+#define PROF_DUMP(putch)        ((void)0)
+#define PROF_LCD(id)            ((void)0)
+
+#endif /* PROF_ENABLE */
+
+#endif	/* PROF_H */
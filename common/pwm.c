@@ -0,0 +1,553 @@
+/* ****************************************************************************
+ * Project: Basic control functions       File pwm.c                 March/2022
+ * ****************************************************************************
+ * Description: PIC 18F4550 CCP module configuration to obtain PWM signal. 
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * * Program Archive for the Advanced Topics Course in Microcontroller 
+ *   Programming, Technology Colleges In Automotive Electronics, 
+ *   FATEC Santo Andr. Professor Wesley Medeiros Torres.
+ *   <http://www.fatecsantoandre.edu.br/>.
+ * * MicroChip Developer Help sample program files. 
+ *   <https://microchipdeveloper.com/>.
+ * * HD44780U dot-matrix liquid crystal display controller Datasheet
+ *   <https://www.digchip.com/datasheets/parts/datasheet/740/HD44780U-pdf.php>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 03/23/2022| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Runtime frequency and duty, integer math
+ * 10/19/2026| Antonio Castilho  | CCP2 (RC1), duties updated together
+ * 10/19/2026| Antonio Castilho  | ECCP1 half/full-bridge, dead band, shutdown
+ * 10/19/2026| Antonio Castilho  | Control tick and Q15 duty for the PID loop
+ * 10/19/2026| Antonio Castilho  | New period with the tick: postscaler 1:1 meanwhile
+ * 10/19/2026| Antonio Castilho  | Direction change waits the period, TMR2IF kept;
+ *           |                   | pwm_bridge_ini() keeps the tick interrupt
+ * 10/19/2026| Antonio Castilho  | One source in common/ for PWM.X, StepperMotor.X and Bench.X
+ ******************************************************************************/
+
+#include <xc.h>
+#include "pwm.h"
+
+// Updates waiting for the end of a period (pwm_update).
+#define UPDATE_DUTY         0x01 // CCPRxL:DCxB, latched by the hardware at the next period.
+#define UPDATE_PERIOD       0x02 // PR2 and prescaler, after the duty has been written.
+#define UPDATE_PERIOD_NOW   0x04 // PR2 and prescaler, in the next interrupt.
+#define UPDATE_DIRECTION    0x08 // Full-bridge direction: PWM1 duty 0 for one period,
+#define UPDATE_DIRECTION_NOW 0x10 // then P1M and the duty again.
+
+static const uint8_t prescale[3] = {1, 4, 16}; // T2CKPS = 0, 1, 2.
+
+static uint16_t pwm_duty[2] = {DUTY_CYCLE, DUTY_CYCLE2}; // 0.1 %.
+static uint8_t pwm_period = 1;          // PR2 + 1, 1 to 256.
+static uint8_t pwm_ckps;                // Prescaler of pwm_period.
+
+// Values for the interrupt.
+static volatile uint8_t next_pr2;
+static volatile uint8_t next_ckps;
+static volatile uint16_t next_duty[2];  // 10 bits, CCPRxL:DCxB.
+static volatile uint8_t next_p1m;
+static volatile uint8_t pwm_update;
+static uint8_t pwm_tick;                // 1: TMR2 interrupt always on (pwm_setTick()).
+static uint8_t pwm_postscale;           // Periods per tick, 1 to 16.
+static uint8_t pwm_held;                // Periods to the next tick, postscaler held at 1:1.
+
+/******************************************************************************
+ * Function: static uint16_t pwm_dutyCount(uint16_t duty)
+ * Description: Converts the duty cycle to the 10-bit value of CCPRxL:DCxB for
+ * the period in pwm_period. 4 counts per TMR2 step (Tosc resolution). Pg 149.
+ * Input: duty cycle, 0.1 % (0 - 1000).
+ * Output: 10-bit value.
+ ******************************************************************************/
+static uint16_t pwm_dutyCount(uint16_t duty)
+{
+    uint16_t steps = (uint16_t)(4 * (pwm_period ? pwm_period : 256));
+    uint32_t count = ((uint32_t)duty * steps + PWM_DUTY_MAX / 2) / PWM_DUTY_MAX;
+
+    return (count > 1023) ? 1023 : (uint16_t)count;
+}
+// end of function static uint16_t pwm_dutyCount(uint16_t duty)
+
+/******************************************************************************
+ * Function: static void pwm_request(uint8_t update)
+ * Description: Hands the new values to the TIMER2 interrupt. TMR2IF is
+ * cleared so the first interrupt is the end of a period, not an old flag.
+ * The high priority interrupts are masked: the values are also written by
+ * pwm_setDutyQ15() in the control loop interrupt.
+ * Input: UPDATE_DUTY and/or UPDATE_PERIOD.
+ * Output: void
+ ******************************************************************************/
+static void pwm_request(uint8_t update)
+{
+    uint8_t gieh = INTCONbits.GIEH;
+
+    INTCONbits.GIEH = 0; // The interrupts do not run while the values change.
+    next_duty[0] = pwm_dutyCount(pwm_duty[0]); // Both channels at once.
+    next_duty[1] = pwm_dutyCount(pwm_duty[1]);
+    if(update & UPDATE_PERIOD)
+    {
+        next_pr2 = (uint8_t)(pwm_period - 1);
+        next_ckps = pwm_ckps;
+        pwm_update &= (uint8_t)~UPDATE_PERIOD_NOW;
+    }
+    pwm_update |= update;
+    if(!pwm_tick) PIR1bits.TMR2IF = 0; // With the tick on, an old flag is a real period end.
+    PIE1bits.TMR2IE = 1;
+    INTCONbits.GIEH = gieh;
+}
+// end of function static void pwm_request(uint8_t update)
+
+/******************************************************************************
+ * Function: void pwm_ini(void)
+ * Description: Starts TIMER2, CCP1 in PWM mode on RC2 and CCP2 on RC1, with
+ * PWM1_FREQUENCY, DUTY_CYCLE and DUTY_CYCLE2. The TIMER2 interrupt is high priority: the program must
+ * call pwm_isr() in isr_high and enable the interrupts (IPEN, GIEH).
+ * The oscillator must be set by the program (OSCCON, fuse_bits.h).
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+void pwm_ini(void)
+{
+    TRISCbits.RC2 = 0;// Configure pin RC2 as output for PWM 1.
+    TRISCbits.RC1 = 0;// Configure pin RC1 as output for PWM 2.
+    T2CON = 0x00; // Timer 2 off, postscale 1:1, interrupt at every period. Pg 137.
+    TMR2 = 0;
+    pwm_update = 0;
+    pwm_tick = 0;
+    pwm_postscale = 1;
+    pwm_held = 0;
+    IPR1bits.TMR2IP = 1;
+    PIE1bits.TMR2IE = 0;
+
+    pwm_setFrequency(PWM1_FREQUENCY / 10);
+    // Nothing is running yet: the values go straight to the registers.
+    pwm_update = 0;
+    PR2 = next_pr2;
+    T2CONbits.T2CKPS = next_ckps;
+    CCPR1L = (uint8_t)(next_duty[0] >> 2);
+    CCP1CONbits.DC1B = next_duty[0] & 0x03;
+    CCP1CON = (CCP1CON & 0x30) | 0x0C; // PWM mode: P1A, P1C active-high; P1B, P1D active-high. Pg 151.
+    CCPR2L = (uint8_t)(next_duty[1] >> 2);
+    CCP2CON = (uint8_t)(((next_duty[1] & 0x03) << 4) | 0x0C); // DC2B, PWM mode. Pg 141.
+    PIE1bits.TMR2IE = 0;
+    T2CONbits.TMR2ON = 1;  // Turn on Timer 2.
+}
+// end of function void pwm_ini(void)
+
+/******************************************************************************
+ * Function: uint8_t pwm_setFrequency(uint32_t frequency)
+ * Description: Sets the PWM frequency. The smallest prescaler that gives
+ * PR2 <= 255 is used, which is the one with the best duty resolution.
+ *      PWM period = (PR2 + 1) * 4 * Tosc * prescale. Pg 149.
+ * The duty cycle in % is kept.
+ * Example: pwm_setFrequency(20000); // 20 kHz.
+ * Input: frequency in Hz, PWM_FREQUENCY_MIN to PWM_FREQUENCY_MAX.
+ * Output: 1 if set, 0 if out of range (nothing changes).
+ ******************************************************************************/
+uint8_t pwm_setFrequency(uint32_t frequency)
+{
+    uint32_t divider;
+    uint32_t period;
+
+    if(frequency == 0) return 0;
+
+    for(uint8_t i = 0; i < 3; i++)
+    {
+        divider = 4UL * prescale[i] * frequency;
+        period = (_XTAL_FREQ + divider / 2) / divider; // PR2 + 1, rounded.
+        if(period >= 2 && period <= 256)
+        {
+            pwm_period = (uint8_t)period; // 256 is kept as 0.
+            pwm_ckps = i;
+            pwm_request(UPDATE_DUTY | UPDATE_PERIOD);
+            return 1;
+        }
+        if(period < 2) break; // Too high, a larger prescaler does not help.
+    }
+    return 0;
+}
+// end of function uint8_t pwm_setFrequency(uint32_t frequency)
+
+/******************************************************************************
+ * Function: void pwm_setDuty(uint16_t duty)
+ * Description: Sets the duty cycle of one channel, applied at the end of the
+ * current period.
+ * Example: pwm_setDuty(PWM1, 250); // 25,0 %
+ * Input: channel (PWM1, PWM2) and duty cycle in 0.1 % (0 - 1000).
+ * Output: void
+ ******************************************************************************/
+void pwm_setDuty(uint8_t ch, uint16_t duty)
+{
+    if(ch != PWM1 && ch != PWM2) return;
+    pwm_duty[ch - 1] = (duty > PWM_DUTY_MAX) ? PWM_DUTY_MAX : duty;
+    pwm_request(UPDATE_DUTY);
+}
+// end of function void pwm_setDuty(uint8_t ch, uint16_t duty)
+
+/******************************************************************************
+ * Function: void pwm_setDuties(uint16_t duty1, uint16_t duty2)
+ * Description: Sets the duty cycles of both channels. They are written in the
+ * same interrupt, so the two outputs change on the same period.
+ * Example: pwm_setDuties(300, 700);
+ * Input: duty cycles of PWM1 and PWM2 in 0.1 % (0 - 1000).
+ * Output: void
+ ******************************************************************************/
+void pwm_setDuties(uint16_t duty1, uint16_t duty2)
+{
+    pwm_duty[0] = (duty1 > PWM_DUTY_MAX) ? PWM_DUTY_MAX : duty1;
+    pwm_duty[1] = (duty2 > PWM_DUTY_MAX) ? PWM_DUTY_MAX : duty2;
+    pwm_request(UPDATE_DUTY);
+}
+// end of function void pwm_setDuties(uint16_t duty1, uint16_t duty2)
+
+/******************************************************************************
+ * Function: void pwm_setDutyQ15(uint8_t ch, int16_t duty)
+ * Description: Fast duty update for a control loop, to be called in the high
+ * priority interrupt (no division, no interrupt masking). Applied at the next
+ * TIMER2 interrupt.
+ * Example: pwm_setDutyQ15(PWM1, 16384); // 50 %
+ * Input: channel (PWM1, PWM2) and duty cycle in Q15, 0 (0 %) to 32767 (100 %).
+ *        Negative values give 0 %.
+ * Output: void
+ ******************************************************************************/
+void pwm_setDutyQ15(uint8_t ch, int16_t duty)
+{
+    uint8_t i = (uint8_t)(ch - 1);
+    uint16_t count;
+
+    if(i > 1) return;
+    if(duty < 0) duty = 0;
+
+    count = (uint16_t)(((uint32_t)duty * pwm_getSteps() + 16384) >> 15);
+    next_duty[i] = (count > 1023) ? 1023 : count;
+    pwm_duty[i] = (uint16_t)(((uint32_t)duty * PWM_DUTY_MAX + 16384) >> 15);
+    pwm_update |= UPDATE_DUTY;
+    PIE1bits.TMR2IE = 1;
+}
+// end of function void pwm_setDutyQ15(uint8_t ch, int16_t duty)
+
+/******************************************************************************
+ * Function: void pwm_setTick(uint8_t postscale)
+ * Description: Keeps the TIMER2 interrupt on at every "postscale" periods, as
+ * a fixed rate tick for a control loop: pwm_isr() returns 1 at each tick.
+ * PWM updates are then applied at the tick, not at the next period. A new
+ * frequency needs two periods in a row (duty, then PR2): the postscaler is
+ * held at 1:1 from the tick that writes the duty to the next tick, which
+ * pwm_isr() counts, so the ticks keep their rate.
+ * Example: pwm_setFrequency(20000); pwm_setTick(10); // 2 kHz tick.
+ * Input: 1 to 16 periods; 0 turns the tick off.
+ * Output: void
+ ******************************************************************************/
+void pwm_setTick(uint8_t postscale)
+{
+    PIE1bits.TMR2IE = 0;
+    if(postscale > 16) postscale = 16;
+    pwm_tick = postscale ? 1 : 0;
+    pwm_postscale = postscale ? postscale : 1;
+    pwm_held = 0;
+    if(pwm_postscale > 1 && (pwm_update & UPDATE_PERIOD_NOW))
+    {
+        pwm_held = pwm_postscale; // PR2 is written in the next period.
+        T2CONbits.TOUTPS = 0;
+    }
+    else
+    {
+        T2CONbits.TOUTPS = (uint8_t)(pwm_postscale - 1);
+    }
+    PIR1bits.TMR2IF = 0;
+    if(pwm_tick || pwm_update) PIE1bits.TMR2IE = 1;
+}
+// end of function void pwm_setTick(uint8_t postscale)
+
+/******************************************************************************
+ * Function: uint32_t pwm_getFrequency(void)
+ * Description: Frequency really obtained with PR2 and the prescaler.
+ * Output: frequency in Hz.
+ ******************************************************************************/
+uint32_t pwm_getFrequency(void)
+{
+    uint16_t period = pwm_period ? pwm_period : 256;
+
+    return _XTAL_FREQ / (4UL * prescale[pwm_ckps] * period);
+}
+// end of function uint32_t pwm_getFrequency(void)
+
+/******************************************************************************
+ * Function: uint16_t pwm_getSteps(void)
+ * Description: Duty resolution at the current frequency.
+ * Output: number of duty steps in one period, 4 * (PR2 + 1).
+ ******************************************************************************/
+uint16_t pwm_getSteps(void)
+{
+    return (uint16_t)(4 * (pwm_period ? pwm_period : 256));
+}
+// end of function uint16_t pwm_getSteps(void)
+
+/******************************************************************************
+ * Function: uint8_t pwm_isr(void)
+ * Description: TIMER2 interrupt, at the end of each period (TMR2 = PR2) while
+ * there is an update waiting, or at each tick (pwm_setTick()). Call it in
+ * isr_high.
+ *   - The duties (CCPR1L:DC1B, CCPR2L:DC2B) are written first; the hardware
+ *     copies them to CCPRxH at the end of this period, both at once.
+ *   - PR2 and the prescaler are written in the next interrupt, so the new
+ *     period starts together with the new duty. With a tick postscaler the
+ *     "next interrupt" would be a tick later: the postscaler is set to 1:1
+ *     when the duty is written (the T2CON write clears its count, Pg 137) and
+ *     back at the following tick, counted here in pwm_held.
+ *   - A full-bridge direction change takes two interrupts: PWM1 duty 0, then
+ *     P1M together with the duty again (latched one period later, so the
+ *     outputs switch during a period with duty 0).
+ * The interrupt is disabled when there is nothing left to do and no tick.
+ * Input: void
+ * Output: 1 at a tick (or at each interrupt without the tick), 0 if not.
+ ******************************************************************************/
+uint8_t pwm_isr(void)
+{
+    uint8_t held;
+    uint8_t tick = 1;
+
+    if(PIE1bits.TMR2IE && PIR1bits.TMR2IF)
+    {
+        PIR1bits.TMR2IF = 0;
+
+        held = pwm_held;
+        if(held)
+        {
+            tick = (uint8_t)(--pwm_held == 0); // Postscaler at 1:1: the tick is counted here.
+        }
+        else if(pwm_postscale > 1 && (pwm_update & UPDATE_PERIOD))
+        {
+            T2CONbits.TOUTPS = 0; // Duty now, PR2 in the next period.
+            pwm_held = pwm_postscale;
+        }
+
+        if(pwm_update & UPDATE_PERIOD_NOW)
+        {
+            PR2 = next_pr2;
+            T2CONbits.T2CKPS = next_ckps;
+            pwm_update &= (uint8_t)~UPDATE_PERIOD_NOW;
+        }
+        if(pwm_update & UPDATE_DIRECTION_NOW)
+        {
+            // Duty 0 has just been latched: the modulated output stays off.
+            CCP1CONbits.P1M = next_p1m;
+            pwm_update = (uint8_t)((pwm_update & ~UPDATE_DIRECTION_NOW) | UPDATE_DUTY);
+        }
+        if(pwm_update & UPDATE_DIRECTION)
+        {
+            CCPR1L = 0; // Duty 0 from the end of this period.
+            CCP1CONbits.DC1B = 0;
+            pwm_update = (uint8_t)((pwm_update & ~UPDATE_DIRECTION) | UPDATE_DIRECTION_NOW);
+        }
+        else if(pwm_update & UPDATE_DUTY)
+        {
+            CCPR1L = (uint8_t)(next_duty[0] >> 2);
+            CCP1CONbits.DC1B = next_duty[0] & 0x03;
+            CCPR2L = (uint8_t)(next_duty[1] >> 2);
+            CCP2CONbits.DC2B = next_duty[1] & 0x03;
+            pwm_update &= (uint8_t)~UPDATE_DUTY;
+            if(pwm_update & UPDATE_PERIOD)
+            {
+                pwm_update = (uint8_t)((pwm_update & ~UPDATE_PERIOD) | UPDATE_PERIOD_NOW);
+            }
+        }
+        if(held && tick)
+        {
+            if(pwm_update & (UPDATE_PERIOD | UPDATE_PERIOD_NOW))
+                pwm_held = pwm_postscale; // Another new period: one more tick at 1:1.
+            else
+                T2CONbits.TOUTPS = (uint8_t)(pwm_postscale - 1);
+        }
+        if(pwm_update == 0 && !pwm_tick) PIE1bits.TMR2IE = 0;
+        return tick;
+    }
+    return 0;
+}
+// end of function uint8_t pwm_isr(void)
+
+/******************************************************************************
+ * Function: uint8_t pwm_bridge_ini(uint8_t mode)
+ * Description: Sets the ECCP1 output configuration of PWM1, after pwm_ini().
+ * All outputs active-high (CCP1M = 1100). The duty of PWM1 is the bridge duty.
+ * In PWM_BRIDGE_HALF the dead band of pwm_bridge_setDeadband() delays the
+ * rising edge of each output; the full-bridge modes have no dead band.
+ * Example: pwm_bridge_ini(PWM_BRIDGE_HALF); pwm_bridge_setDeadband(500);
+ * Input: PWM_BRIDGE_SINGLE, _HALF, _FORWARD or _REVERSE.
+ * Output: 1 if set, 0 if mode is not valid.
+ ******************************************************************************/
+uint8_t pwm_bridge_ini(uint8_t mode)
+{
+    if(mode > PWM_BRIDGE_REVERSE) return 0;
+
+    PIE1bits.TMR2IE = 0;
+    pwm_update &= (uint8_t)~(UPDATE_DIRECTION | UPDATE_DIRECTION_NOW);
+    if(pwm_update || pwm_tick) PIE1bits.TMR2IE = 1;
+
+    TRISCbits.RC2 = 0; // P1A
+    if(mode != PWM_BRIDGE_SINGLE) TRISDbits.RD5 = 0; // P1B
+    if(mode == PWM_BRIDGE_FORWARD || mode == PWM_BRIDGE_REVERSE)
+    {
+        TRISDbits.RD6 = 0; // P1C
+        TRISDbits.RD7 = 0; // P1D
+    }
+    next_p1m = mode;
+    CCP1CON = (uint8_t)((mode << 6) | (CCP1CON & 0x30) | 0x0C);
+    return 1;
+}
+// end of function uint8_t pwm_bridge_ini(uint8_t mode)
+
+/******************************************************************************
+ * Function: static void pwm_waitPeriod(void)
+ * Description: Waits for the end of the TIMER2 period (TMR2 goes from PR2 back
+ * to 0), without touching TMR2IF. Gives up after 4096 readings, longer than
+ * the longest period (256 * 16 cycles), if a very short period is never seen.
+ * Input: void
+ * Output: void
+ ******************************************************************************/
+static void pwm_waitPeriod(void)
+{
+    uint8_t t = TMR2;
+    uint8_t last;
+    uint16_t n = 4096;
+
+    do
+    {
+        last = t;
+        t = TMR2;
+    } while(t >= last && --n);
+}
+// end of function static void pwm_waitPeriod(void)
+
+/******************************************************************************
+ * Function: void pwm_bridge_setDirection(uint8_t mode)
+ * Description: Changes the full-bridge direction without shoot-through: the
+ * interrupt holds the PWM1 duty at 0 for one period before switching P1M, so
+ * the two legs never conduct together. Pg 154.
+ * The request is made at the start of a period, so the first interrupt writes
+ * the duty 0 for the next one. TMR2IF is not cleared: with pwm_setTick() it is
+ * a tick of the control loop.
+ * Input: PWM_BRIDGE_FORWARD or PWM_BRIDGE_REVERSE.
+ * Output: void
+ ******************************************************************************/
+void pwm_bridge_setDirection(uint8_t mode)
+{
+    if(mode != PWM_BRIDGE_FORWARD && mode != PWM_BRIDGE_REVERSE) return;
+    if(CCP1CONbits.P1M == mode && !(pwm_update & (UPDATE_DIRECTION | UPDATE_DIRECTION_NOW))) return;
+
+    PIE1bits.TMR2IE = 0;
+    next_p1m = mode;
+    if(!(pwm_update & UPDATE_DIRECTION_NOW))
+    {
+        pwm_waitPeriod();
+        pwm_update |= UPDATE_DIRECTION;
+    }
+    PIE1bits.TMR2IE = 1;
+}
+// end of function void pwm_bridge_setDirection(uint8_t mode)
+
+/******************************************************************************
+ * Function: uint16_t pwm_bridge_setDeadband(uint16_t ns)
+ * Description: Half-bridge dead band, ECCP1DEL<6:0> in Tcy (4 * Tosc) steps,
+ * rounded up so the delay is never shorter than asked. Pg 153.
+ * Example: pwm_bridge_setDeadband(500); // 0,5 us: 1 Tcy at 8 MHz.
+ * Input: dead band in ns.
+ * Output: dead band really set, in ns (limited to 127 Tcy).
+ ******************************************************************************/
+uint16_t pwm_bridge_setDeadband(uint16_t ns)
+{
+    uint32_t tcy = ((uint32_t)ns * (_XTAL_FREQ / 4000UL) + 999999UL) / 1000000UL;
+
+    if(tcy > 127) tcy = 127;
+    ECCP1DEL = (uint8_t)((ECCP1DEL & 0x80) | tcy);
+    return (uint16_t)((tcy * 1000000UL) / (_XTAL_FREQ / 4000UL));
+}
+// end of function uint16_t pwm_bridge_setDeadband(uint16_t ns)
+
+/******************************************************************************
+ * Function: void pwm_bridge_setShutdown(uint8_t source, uint8_t state_ac,
+ *                                        uint8_t state_bd, uint8_t restart)
+ * Description: Auto-shutdown: on the fault the hardware puts the ECCP1 pins in
+ * the chosen state at once, without the program. With restart = 1 the PWM
+ * starts again at the next period after the fault is gone (PRSEN); with 0 it
+ * stays off until pwm_bridge_restart(). Pg 155.
+ * Example: pwm_bridge_setShutdown(PWM_FAULT_FLT0, PWM_SHUTDOWN_LOW,
+ *                                 PWM_SHUTDOWN_LOW, 0); // Driver enable on RB0.
+ * Input: PWM_FAULT_x, PWM_SHUTDOWN_x for P1A/P1C and P1B/P1D, restart.
+ * Output: void
+ ******************************************************************************/
+void pwm_bridge_setShutdown(uint8_t source, uint8_t state_ac, uint8_t state_bd, uint8_t restart)
+{
+    if(source & PWM_FAULT_FLT0) TRISBbits.RB0 = 1; // FLT0 input.
+    ECCP1AS = (uint8_t)((source & 0x70) | ((state_ac & 0x03) << 2) | (state_bd & 0x03));
+    ECCP1DELbits.PRSEN = restart ? 1 : 0;
+}
+// end of function void pwm_bridge_setShutdown(...)
+
+/******************************************************************************
+ * Function: uint8_t pwm_bridge_isShutdown(void)
+ * Output: 1 while the outputs are shut down (ECCPASE).
+ ******************************************************************************/
+uint8_t pwm_bridge_isShutdown(void)
+{
+    return ECCP1ASbits.ECCPASE;
+}
+// end of function uint8_t pwm_bridge_isShutdown(void)
+
+/******************************************************************************
+ * Function: void pwm_bridge_restart(void)
+ * Description: Restarts the PWM after a shutdown without auto-restart. It
+ * stays off if the fault is still present. Pg 156.
+ ******************************************************************************/
+void pwm_bridge_restart(void)
+{
+    ECCP1ASbits.ECCPASE = 0;
+}
+// end of function void pwm_bridge_restart(void)
+
+/******************************************************************************
+ * Function: void pwm1_ini(void)
+ * Description: Initializes the CCP module's pwm with PWM1_FREQUENCY and
+ * DUTY_CYCLE. Kept for the programs written for the first version; the
+ * oscillator is no longer changed here.
+ * Input: void
+ * Output: void
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 03/23/2022| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Calls pwm_ini(), OSCCON moved to main()
+ ******************************************************************************/
+void pwm1_ini(void)
+{
+    pwm_ini();
+}
+// end of function void pwm1_ini(void)
+/******************************************************************************/
+/******************************************************************************
+ * Function: void pwm1_setDutyPot(uint16_t ccpr1_aux)
+ * Description: This function configures the Duty Cycle from a variable 
+ * that can be dynamically modified by a potentiometer, for example.
+ * The value is scaled to the current period and applied at its end.
+ * Input: uint16_t ccpr1_aux (value 0 - 1023)
+ * Output: void
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 03/23/2022| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Through pwm_setDuty()
+ ******************************************************************************/
+
+void pwm1_setDutyPot(uint16_t ccpr1_aux)
+{
+    pwm_setDuty(PWM1, (uint16_t)(((uint32_t)ccpr1_aux * PWM_DUTY_MAX + 511) / 1023));
+}
+/******************************************************************************/
@@ -0,0 +1,121 @@
+/* ****************************************************************************
+ * Project: Basic control functions       File pwm.h                 March/2022
+ * ****************************************************************************
+ * Description: PIC 18F4550 CCP module configuration to obtain PWM signal. 
+ *   Frequency and duty cycle can be changed at any time with integer math.
+ *   The TIMER2 prescaler is chosen for the largest PR2, that is, the best duty
+ *   resolution (4 * (PR2 + 1) steps). New values are written by the TIMER2
+ *   interrupt just after the end of a period, so no period is cut or
+ *   stretched. The oscillator is not touched: _XTAL_FREQ must match it.
+ *   Two channels share TIMER2: PWM1 = CCP1 (RC2) and PWM2 = CCP2 (RC1, fuse
+ *   CCP2MX = ON). Their duties are written in the same interrupt and start
+ *   on the same period; pwm_setDuties() changes both in one call.
+ *   PWM1 can also drive a half-bridge (P1A RC2, P1B RD5) with dead band or a
+ *   full-bridge (P1A RC2, P1B RD5, P1C RD6, P1D RD7) with forward/reverse
+ *   steering, and shut the outputs down in hardware on a fault (pwm_bridge_*).
+ *   The bridge pins are the LCD data pins RD5:RD7 of the FATEC board: the
+ *   display can not be used together with the bridge modes.
+ * ****************************************************************************
+ * Program environment for validation: MPLAB X IDE v6.0, XC8 v2.36, C std C90,
+ * PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * * Program Archive for the Advanced Topics Course in Microcontroller 
+ *   Programming, Technology Colleges In Automotive Electronics, 
+ *   FATEC Santo Andr. Professor Wesley Medeiros Torres.
+ *   <http://www.fatecsantoandre.edu.br/>.
+ * * MicroChip Developer Help sample program files. 
+ *   <https://microchipdeveloper.com/>.
+ * * HD44780U dot-matrix liquid crystal display controller Datasheet
+ *   <https://www.digchip.com/datasheets/parts/datasheet/740/HD44780U-pdf.php>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 03/23/2022| Antonio Castilho  | Function has been created
+ * 10/19/2026| Antonio Castilho  | Runtime frequency and duty, integer math
+ * 10/19/2026| Antonio Castilho  | CCP2 (RC1), duties updated together
+ * 10/19/2026| Antonio Castilho  | ECCP1 half/full-bridge, dead band, shutdown
+ * 10/19/2026| Antonio Castilho  | Control tick and Q15 duty for the PID loop
+ * 10/19/2026| Antonio Castilho  | One source in common/ for PWM.X, StepperMotor.X and Bench.X
+ ******************************************************************************/
+ 
+#ifndef PWM_H
+#define	PWM_H
+
+#include <xc.h>
+#include <stdlib.h>
+// _XTAL_FREQ: from the pwm.h of the project, which includes this file.
+
+#define PWM1_FREQUENCY       10000 // 1000,0 Hz
+#define DUTY_CYCLE             500 // 50,0 %
+
+#ifndef _XTAL_FREQ
+    #define	_XTAL_FREQ   8000000  // Standard, Internal Oscillator 8 MHz,
+    // OSCCON Oscillator control register Pg. 34.
+#endif
+#ifndef DUTY_CYCLE
+    #define	DUTY_CYCLE    500  // Default for Duty Cycle PWM1 = 50.0%.
+#endif
+#ifndef DUTY_CYCLE2
+    #define	DUTY_CYCLE2   500  // Default for Duty Cycle PWM2 = 50.0%.
+#endif
+#ifndef PWM1_FREQUENCY
+    #define	PWM1_FREQUENCY  10000 // Default for PWM1 Frequency = 1000.0 Hz.
+#endif
+
+// Frequency range, in Hz: PR2 from 255 with prescale 16 to 1 with prescale 1.
+#define PWM_FREQUENCY_MIN   ((_XTAL_FREQ + 16383UL) / (4UL * 16 * 256))
+#define PWM_FREQUENCY_MAX   (_XTAL_FREQ / (4UL * 2))
+
+#define PWM_DUTY_MAX        1000 // 100,0 %
+
+#define PWM1                1    // CCP1, RC2.
+#define PWM2                2    // CCP2, RC1.
+
+// ECCP1 output configuration, CCP1CON<7:6> (P1M). Pg 149.
+#define PWM_BRIDGE_SINGLE   0x00 // P1A modulated; P1B, P1C, P1D port pins.
+#define PWM_BRIDGE_FORWARD  0x01 // Full-bridge: P1D modulated, P1A active.
+#define PWM_BRIDGE_HALF     0x02 // Half-bridge: P1A, P1B modulated with dead band.
+#define PWM_BRIDGE_REVERSE  0x03 // Full-bridge: P1B modulated, P1C active.
+
+// Auto-shutdown source, ECCP1AS<6:4> (ECCPAS). Pg 156.
+#define PWM_FAULT_NONE      0x00
+#define PWM_FAULT_CMP1      0x10 // Comparator 1 output.
+#define PWM_FAULT_CMP2      0x20 // Comparator 2 output.
+#define PWM_FAULT_CMP12     0x30 // Comparator 1 or 2.
+#define PWM_FAULT_FLT0      0x40 // FLT0 (RB0/INT0) low.
+#define PWM_FAULT_FLT0_CMP1 0x50
+#define PWM_FAULT_FLT0_CMP2 0x60
+#define PWM_FAULT_ALL       0x70
+
+// Pin state during shutdown, for P1A/P1C (PSSAC) and P1B/P1D (PSSBD).
+#define PWM_SHUTDOWN_LOW    0x00 // Drive 0.
+#define PWM_SHUTDOWN_HIGH   0x01 // Drive 1.
+#define PWM_SHUTDOWN_HIZ    0x02 // Tri-state.
+
+// Function prototypes
+void pwm_ini(void);
+uint8_t pwm_setFrequency(uint32_t frequency);
+void pwm_setDuty(uint8_t ch, uint16_t duty);
+void pwm_setDuties(uint16_t duty1, uint16_t duty2);
+uint32_t pwm_getFrequency(void);
+uint8_t pwm_bridge_ini(uint8_t mode);
+void pwm_bridge_setDirection(uint8_t mode);
+uint16_t pwm_bridge_setDeadband(uint16_t ns);
+void pwm_bridge_setShutdown(uint8_t source, uint8_t state_ac, uint8_t state_bd, uint8_t restart);
+uint8_t pwm_bridge_isShutdown(void);
+void pwm_bridge_restart(void);
+uint16_t pwm_getSteps(void);
+void pwm_setDutyQ15(uint8_t ch, int16_t duty);
+void pwm_setTick(uint8_t postscale);
+uint8_t pwm_isr(void);
+
+void pwm1_ini(void);
+void pwm1_setDutyPot(uint16_t ccpr1_aux);
+
+#endif	/* PWM_H */
@@ -0,0 +1,263 @@
+/* ****************************************************************************
+ * Project: Control Functions                         File telemetry.c                              October/2026
+ * ****************************************************************************
+ * File description: COBS framed telemetry records with CRC-16. See telemetry.h.
+ *
+ * ****************************************************************************
+ * Program environment for validation:
+ *   MPLAB X IDE v6.0, XC8 v2.36, C std C90;
+ *   PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal;
+ *   Can Bus Module MCP2515 x TJA1050.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ *   Cheshire, S.; Baker, M. Consistent Overhead Byte Stuffing. IEEE/ACM
+ *   Transactions on Networking, 1999.
+ * ****************************************************************************
+ * Date           | Author                | Description
+ * **********|************* *|***************************************************
+ * 10/19/2026 | Antonio Castilho  | Function has been created
+ * 10/19/2026 | Antonio Castilho  | One source in common/ for CANet.X, ECTsensor.X and PWM.X
+ * 10/19/2026 | Antonio Castilho  | TLM_PARAM, telemetry_receive()
+ ******************************************************************************/
+
+#include <xc.h>
+#include "telemetry.h"
+#include "uart.h" // Already included by the telemetry.h of the project.
+
+// type + seq + payload + crc, COBS adds 1 code byte (records < 254 bytes), plus the 0x00.
+#define RECORD_MAX      (2 + TLM_PAYLOAD_MAX + 2)
+#define FRAME_MAX       (RECORD_MAX + 2)
+
+// CRC-16/CCITT (polynomial 0x1021) of each value of a nibble.
+static const uint16_t crc_table[16] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+static uint8_t tlm_seq;
+
+#if UART_RX_SIZE
+static uint8_t rx_frame[FRAME_MAX - 1]; // Bytes received since the last 0x00.
+static uint8_t rx_length;
+static uint8_t rx_over;                 // Frame longer than rx_frame.
+
+uint16_t telemetry_rxErrors;
+#endif
+
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Function: uint16_t telemetry_crc(uint16_t crc, uint8_t data)
+ * Description: Adds one byte to a CRC-16/CCITT-FALSE, one nibble at a time
+ *              (16 word table instead of 256). Start with crc = 0xFFFF.
+ *              "123456789" gives 0x29B1.
+ * Input: CRC so far and the new byte.
+ * Output: new CRC.
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+uint16_t telemetry_crc(uint16_t crc, uint8_t data)
+{
+    crc = (uint16_t)((crc << 4) ^ crc_table[(uint8_t)(crc >> 12) ^ (data >> 4)]);
+    crc = (uint16_t)((crc << 4) ^ crc_table[(uint8_t)(crc >> 12) ^ (data & 0x0F)]);
+    return crc;
+
+} // end uint16_t telemetry_crc(uint16_t crc, uint8_t data)
+
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Function: void telemetry_ini(void)
+ * Description: Starts the EUSART and the record counter.
+ * Input: void
+ * Output: void
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+void telemetry_ini(void)
+{
+    uart_ini();
+    tlm_seq = 0;
+#if UART_RX_SIZE
+    rx_length = 0;
+    rx_over = 0;
+    telemetry_rxErrors = 0;
+#endif
+
+} // end void telemetry_ini(void)
+
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Function: uint8_t telemetry_send(uint8_t type, const uint8_t *payload,
+ *                                  uint8_t length)
+ * Description: Builds the record, encodes it with COBS while computing the CRC
+ *              and queues the whole frame in the EUSART buffer. Does not wait:
+ *              if there is no room the record is lost (its seq is skipped).
+ *              COBS: each zero is replaced by the distance to the next zero,
+ *              the first byte (code) is the distance to the first zero.
+ * Input: record type, payload and its length (up to TLM_PAYLOAD_MAX).
+ * Output: 1 if queued, 0 if not.
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+uint8_t telemetry_send(uint8_t type, const uint8_t *payload, uint8_t length)
+{
+    uint8_t record[RECORD_MAX];
+    uint8_t frame[FRAME_MAX];
+    uint16_t crc = 0xFFFF;
+    uint8_t code = 0; // Position of the current code byte in frame.
+    uint8_t n = 1;    // Next position in frame.
+    uint8_t i;
+
+    if(length > TLM_PAYLOAD_MAX) return 0;
+
+    record[0] = type;
+    record[1] = tlm_seq++;
+    for(i = 0; i < length; i++) record[i + 2] = payload[i];
+    length = (uint8_t)(length + 2);
+    for(i = 0; i < length; i++) crc = telemetry_crc(crc, record[i]);
+    record[length++] = (uint8_t)crc;
+    record[length++] = (uint8_t)(crc >> 8);
+
+    for(i = 0; i < length; i++)
+    {
+        if(record[i] == 0)
+        {
+            frame[code] = (uint8_t)(n - code);
+            code = n++;
+        }
+        else
+        {
+            frame[n++] = record[i];
+        }
+    }
+    frame[code] = (uint8_t)(n - code);
+    frame[n++] = 0x00; // End of frame.
+
+    return uart_writeBuf(frame, n);
+
+} // end uint8_t telemetry_send(...)
+
+#if UART_RX_SIZE
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Function: uint8_t telemetry_receive(uint8_t *type, uint8_t *payload,
+ *                                     uint8_t *length)
+ * Description: Takes the bytes received by uart.c up to the end of a frame
+ *              (0x00), decodes it (COBS, in place) and checks its CRC. Does not
+ *              wait: the bytes of a frame not yet complete are kept for the
+ *              next call. The seq of a received record is not checked.
+ * Example: if(telemetry_receive(&type, payload, &n) && type == TLM_PARAM) ...
+ * Input: where to put the type, the payload (TLM_PAYLOAD_MAX bytes) and its
+ *        length.
+ * Output: 1 with a valid record, 0 if none (the bad ones are counted in
+ *         telemetry_rxErrors).
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+uint8_t telemetry_receive(uint8_t *type, uint8_t *payload, uint8_t *length)
+{
+    uint16_t crc;
+    uint8_t byte;
+    uint8_t i; // Next code byte in rx_frame.
+    uint8_t n; // Decoded bytes, in rx_frame too (n <= i).
+    uint8_t code;
+
+    while(uart_read(&byte))
+    {
+        if(byte != 0x00)
+        {
+            if(rx_length < sizeof(rx_frame)) rx_frame[rx_length++] = byte;
+            else rx_over = 1;
+            continue;
+        }
+
+        i = 0;
+        n = 0;
+        while(i < rx_length) // COBS: a code is 1 + the bytes up to the next zero.
+        {
+            code = rx_frame[i++];
+            if(i + code - 1 > rx_length) break;
+            while(--code) rx_frame[n++] = rx_frame[i++];
+            if(i < rx_length) rx_frame[n++] = 0;
+        }
+        if(rx_over || i != rx_length || n < 4)
+        {
+            if(rx_length || rx_over) telemetry_rxErrors++; // 0x00 alone: not a record.
+            rx_length = 0;
+            rx_over = 0;
+            continue;
+        }
+        rx_length = 0;
+
+        n = (uint8_t)(n - 2);
+        crc = 0xFFFF;
+        for(i = 0; i < n; i++) crc = telemetry_crc(crc, rx_frame[i]);
+        if(crc != (uint16_t)(rx_frame[n] | ((uint16_t)rx_frame[n + 1] << 8)))
+        {
+            telemetry_rxErrors++;
+            continue;
+        }
+        *type = rx_frame[0];
+        *length = (uint8_t)(n - 2);
+        for(i = 2; i < n; i++) *payload++ = rx_frame[i];
+        return 1;
+    }
+    return 0;
+
+} // end uint8_t telemetry_receive(...)
+#endif
+
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Functions: telemetry_adc(), telemetry_ntc(), telemetry_pwm(), telemetry_can()
+ * Description: Payloads of the records, see telemetry.h.
+ * Output: 1 if queued, 0 if not.
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+uint8_t telemetry_adc(uint8_t ch, uint16_t value)
+{
+    uint8_t payload[3];
+
+    payload[0] = ch;
+    payload[1] = (uint8_t)value;
+    payload[2] = (uint8_t)(value >> 8);
+    return telemetry_send(TLM_ADC, payload, sizeof(payload));
+}
+
+uint8_t telemetry_ntc(uint8_t ch, uint16_t temperature)
+{
+    uint8_t payload[3];
+
+    payload[0] = ch;
+    payload[1] = (uint8_t)temperature;
+    payload[2] = (uint8_t)(temperature >> 8);
+    return telemetry_send(TLM_NTC, payload, sizeof(payload));
+}
+
+uint8_t telemetry_pwm(uint8_t ch, uint32_t frequency, uint16_t duty)
+{
+    uint8_t payload[7];
+
+    payload[0] = ch;
+    payload[1] = (uint8_t)frequency;
+    payload[2] = (uint8_t)(frequency >> 8);
+    payload[3] = (uint8_t)(frequency >> 16);
+    payload[4] = (uint8_t)(frequency >> 24);
+    payload[5] = (uint8_t)duty;
+    payload[6] = (uint8_t)(duty >> 8);
+    return telemetry_send(TLM_PWM, payload, sizeof(payload));
+}
+
+uint8_t telemetry_can(uint8_t tec, uint8_t rec, uint8_t eflg, uint16_t rx, uint16_t tx)
+{
+    uint8_t payload[7];
+
+    payload[0] = tec;
+    payload[1] = rec;
+    payload[2] = eflg;
+    payload[3] = (uint8_t)rx;
+    payload[4] = (uint8_t)(rx >> 8);
+    payload[5] = (uint8_t)tx;
+    payload[6] = (uint8_t)(tx >> 8);
+    return telemetry_send(TLM_CAN, payload, sizeof(payload));
+}
+// end of the payload functions
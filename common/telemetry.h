@@ -0,0 +1,74 @@
+/* ****************************************************************************
+ * Project: Control Functions                         File telemetry.h                              October/2026
+ * ****************************************************************************
+ * File description: Binary telemetry records over the EUSART (uart.c).
+ *
+ *     Record:  | type | seq | payload (0 to TLM_PAYLOAD_MAX) | crc low | crc high |
+ *         type    - TLM_ADC, TLM_NTC, ...
+ *         seq     - record counter, a gap shows records lost;
+ *         payload - little endian;
+ *         crc     - CRC-16/CCITT-FALSE (0x1021, start 0xFFFF) of type, seq and payload.
+ *     The record is COBS encoded (no 0x00 inside) and ends with 0x00, so the
+ *     receiver finds the next record after any error.
+ *
+ *     Payloads:
+ *         TLM_ADC  ch (1), value (2)                   - ADC result, 0 to 1023;
+ *         TLM_NTC  ch (1), temperature (2)             - 'C x 100;
+ *         TLM_PWM  ch (1), frequency (4), duty (2)     - Hz, 0.1 %;
+ *         TLM_CAN  tec (1), rec (1), eflg (1), rx (2), tx (2) - MCP2515 counters;
+ *         TLM_PARAM reply of param_command() (7), see param.h.
+ *     tools/telemetry_decode.py turns the stream into CSV.
+ *
+ *     With the receiver of uart.c (UART_RX_SIZE), telemetry_receive() takes
+ *     records of the same format sent by the PC: a TLM_PARAM record carries a
+ *     command of param_command(), answered by a TLM_PARAM record. A record
+ *     with a wrong CRC, too long or cut is dropped and counted.
+ * ****************************************************************************
+ * Program environment for validation:
+ *   MPLAB X IDE v6.0, XC8 v2.36, C std C90;
+ *   PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal;
+ *   Can Bus Module MCP2515 x TJA1050.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ *   Cheshire, S.; Baker, M. Consistent Overhead Byte Stuffing. IEEE/ACM
+ *   Transactions on Networking, 1999.
+ * ****************************************************************************
+ * Date           | Author                | Description
+ * **********|************* *|***************************************************
+ * 10/19/2026 | Antonio Castilho  | Function has been created
+ * 10/19/2026 | Antonio Castilho  | One source in common/ for CANet.X, ECTsensor.X and PWM.X
+ * 10/19/2026 | Antonio Castilho  | TLM_PARAM, telemetry_receive()
+ ******************************************************************************/
+#ifndef TELEMETRY_H
+#define	TELEMETRY_H
+
+#include <xc.h> // include processor files - each processor file is guarded.
+// _XTAL_FREQ: from the telemetry.h of the project, which includes this file.
+
+#define TLM_PAYLOAD_MAX     16
+
+// Record types.
+#define TLM_ADC     0x01
+#define TLM_NTC     0x02
+#define TLM_PWM     0x03
+#define TLM_CAN     0x04
+#define TLM_PARAM   0x05
+
+// function prototypes
+void telemetry_ini(void);
+uint8_t telemetry_send(uint8_t type, const uint8_t *payload, uint8_t length);
+uint8_t telemetry_adc(uint8_t ch, uint16_t value);
+uint8_t telemetry_ntc(uint8_t ch, uint16_t temperature);
+uint8_t telemetry_pwm(uint8_t ch, uint32_t frequency, uint16_t duty);
+uint8_t telemetry_can(uint8_t tec, uint8_t rec, uint8_t eflg, uint16_t rx, uint16_t tx);
+uint16_t telemetry_crc(uint16_t crc, uint8_t data);
+#if UART_RX_SIZE
+uint8_t telemetry_receive(uint8_t *type, uint8_t *payload, uint8_t *length);
+
+extern uint16_t telemetry_rxErrors; // Records received and dropped.
+#endif
+
+#endif	/* TELEMETRY_H */
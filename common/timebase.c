@@ -0,0 +1,195 @@
+/* Program: Time Base     File: timebase.c
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ * Description:
+ *      32-bit time base on TIMER3 and CCP capture time stamps. See timebase.h.
+ *
+ *      Reading a counter made of a hardware part (TMR3) and a software part (timebase_high) has
+ *      two races: the interrupt can change timebase_high between the reads of its two bytes, and
+ *      the timer can overflow when the interrupt cannot run (interrupts disabled, or inside a
+ *      high priority interrupt). The first is solved by reading again when timebase_high has
+ *      changed; the second by looking at TMR3IF: if it is pending and TMR3 is in the lower half,
+ *      the overflow happened before the TMR3 read and is added here.
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 10/19/2026 | Antonio Castilho  | Created                                                                    | 00.00.01
+ * 10/19/2026 | Antonio Castilho  | One source in common/ for TIMER.X, ADC.X and ECTsensor.X                    | 00.00.02
+ *________________________________________________________________________________________
+ */
+
+#include <xc.h>
+#include "timebase.h"
+
+static volatile uint16_t timebase_high; // TIMER3 overflows, upper 16 bits of the tick counter.
+
+static volatile uint32_t capture_stamp[2]; // Last time stamp of CCP1 and CCP2.
+static volatile uint8_t capture_new[2];     // A time stamp not yet read.
+
+/****************************************************************************************
+ * void timebase_ini(void);
+ * TIMER3 free running at Fcy, 16-bit read/write, overflow interrupt in high priority.
+ * RCONbits.IPEN and INTCONbits.GIEH must be set by the program (timer_interrupts_ini()).
+ ****************************************************************************************/
+void timebase_ini(void)
+{
+    T3CONbits.TMR3ON = 0; // turn off timer3 to start setup.
+    T3CONbits.RD16 = 1;     // 1 = Enables register read/write of Timer3 in one 16-bit operation
+    T3CONbits.T3CCP2 = 1; // 1x = Timer3 is the capture/compare clock source for both CCP modules
+    T3CONbits.T3CCP1 = 0;
+    T3CONbits.T3CKPS1 = 0; // Prescale value 1:1.
+    T3CONbits.T3CKPS0 = 0;
+    T3CONbits.TMR3CS = 0;  // 0 = Internal clock (FOSC/4); timer mode.
+
+    TMR3H = 0;
+    TMR3L = 0;
+    timebase_high = 0;
+    capture_new[0] = 0;
+    capture_new[1] = 0;
+
+    IPR2bits.TMR3IP = 1;   // High priority.
+    PIR2bits.TMR3IF = 0;
+    PIE2bits.TMR3IE = 1;
+    T3CONbits.TMR3ON = 1; // 1 = Enables Timer3
+}
+// end of void timebase_ini(void)
+
+/****************************************************************************************
+ * uint32_t timebase_now(void);
+ * Returns the 32-bit tick counter. Safe in the main loop, in interrupts and with
+ * interrupts disabled.
+ ****************************************************************************************/
+uint32_t timebase_now(void)
+{
+    uint16_t high;
+    uint16_t low;
+    uint8_t pending;
+
+    do
+    {
+        high = timebase_high;
+        low = TMR3L;                    // Reading TMR3L latches TMR3H.
+        low |= (uint16_t)TMR3H << 8;
+        pending = PIR2bits.TMR3IF;
+    } while(high != timebase_high);
+
+    if(pending && !(low & 0x8000)) high++; // Overflow not yet counted by the interrupt.
+
+    return ((uint32_t)high << 16) | low;
+}
+// end of uint32_t timebase_now(void)
+
+/****************************************************************************************
+ * uint32_t now_us(void);
+ * Returns the time since timebase_ini(), in microseconds. Only for display and logs: it
+ * wraps together with the tick counter, use elapsed() for intervals.
+ ****************************************************************************************/
+uint32_t now_us(void)
+{
+    return ticks_to_us(timebase_now());
+}
+// end of uint32_t now_us(void)
+
+/****************************************************************************************
+ * uint32_t elapsed(uint32_t since);
+ * Returns the ticks since the time stamp "since" (timebase_now() or a capture).
+ * Example: t0 = timebase_now(); adc_read(0); us = ticks_to_us(elapsed(t0));
+ ****************************************************************************************/
+uint32_t elapsed(uint32_t since)
+{
+    return timebase_now() - since;
+}
+// end of uint32_t elapsed(uint32_t since)
+
+/****************************************************************************************
+ * static void timebase_capture(uint8_t i, uint16_t captured);
+ * Extends a 16-bit capture of TMR3 to 32 bits. Runs in the interrupt, before the overflow
+ * of the same interrupt is counted.
+ ****************************************************************************************/
+static void timebase_capture(uint8_t i, uint16_t captured)
+{
+    uint16_t high = timebase_high;
+
+    if(PIR2bits.TMR3IF && !(captured & 0x8000)) high++;
+    capture_stamp[i] = ((uint32_t)high << 16) | captured;
+    capture_new[i] = 1;
+}
+// end of static void timebase_capture(uint8_t i, uint16_t captured)
+
+/****************************************************************************************
+ * void timebase_isr(void);
+ * TIMER3 overflow and CCP captures. Call it in the high priority interrupt.
+ ****************************************************************************************/
+void timebase_isr(void)
+{
+    if(PIE1bits.CCP1IE && PIR1bits.CCP1IF)
+    {
+        PIR1bits.CCP1IF = 0;
+        timebase_capture(0, (uint16_t)(CCPR1L | ((uint16_t)CCPR1H << 8)));
+    }
+
+    if(PIE2bits.CCP2IE && PIR2bits.CCP2IF)
+    {
+        PIR2bits.CCP2IF = 0;
+        timebase_capture(1, (uint16_t)(CCPR2L | ((uint16_t)CCPR2H << 8)));
+    }
+
+    if(PIE2bits.TMR3IE && PIR2bits.TMR3IF)
+    {
+        PIR2bits.TMR3IF = 0;
+        timebase_high++;
+    }
+}
+// end of void timebase_isr(void)
+
+/****************************************************************************************
+ * void timebase_captureIni(uint8_t ccp, uint8_t edge);
+ * Sets CCP1 (pin RC2) or CCP2 (pin RC1, CCP2MX = ON) in capture mode, high priority interrupt.
+ * Example: timebase_captureIni(2, TIMEBASE_FALLING); // Button on RC1, pressed = 0.
+ ****************************************************************************************/
+void timebase_captureIni(uint8_t ccp, uint8_t edge)
+{
+    if(ccp == 1)
+    {
+        TRISCbits.TRISC2 = 1;    // Capture input.
+        CCP1CON = edge & 0x0F;    // Pg 143.
+        capture_new[0] = 0;
+        IPR1bits.CCP1IP = 1;
+        PIR1bits.CCP1IF = 0;
+        PIE1bits.CCP1IE = 1;
+    }
+    else if(ccp == 2)
+    {
+        TRISCbits.TRISC1 = 1;
+        CCP2CON = edge & 0x0F;
+        capture_new[1] = 0;
+        IPR2bits.CCP2IP = 1;
+        PIR2bits.CCP2IF = 0;
+        PIE2bits.CCP2IE = 1;
+    }
+}
+// end of void timebase_captureIni(uint8_t ccp, uint8_t edge)
+
+/****************************************************************************************
+ * uint8_t timebase_captureGet(uint8_t ccp, uint32_t *stamp);
+ * Returns 1 and the time stamp of the last edge if there is a new capture in CCP1 or CCP2,
+ * otherwise returns 0.
+ ****************************************************************************************/
+uint8_t timebase_captureGet(uint8_t ccp, uint32_t *stamp)
+{
+    uint8_t i = (uint8_t)(ccp - 1);
+    uint8_t fresh;
+    uint8_t gieh;
+
+    if(i > 1) return 0;
+
+    gieh = INTCONbits.GIEH;
+    INTCONbits.GIEH = 0; // The 32-bit stamp is written by the interrupt.
+    fresh = capture_new[i];
+    *stamp = capture_stamp[i];
+    capture_new[i] = 0;
+    INTCONbits.GIEH = gieh;
+
+    return fresh;
+}
+// end of uint8_t timebase_captureGet(uint8_t ccp, uint32_t *stamp)
@@ -0,0 +1,53 @@
+/* Program: Time Base     File: timebase.h
+ * Environment: MPLAB X IDE v6.00; XC8 v2.36; Std C C90; PIC18F4550 on FATEC board;
+ * Description:
+ *      Free-running monotonic clock: TIMER3 counts every instruction cycle (Fcy = _XTAL_FREQ / 4,
+ *      prescale 1:1) and its overflow interrupt counts the upper 16 bits, making a 32-bit tick
+ *      counter. One tick = 1 / Fcy; 0.5 us with the 8 MHz internal oscillator.
+ *
+ *      TIMER3 is also set as the clock of the CCP modules (T3CCP2 = 1), so an edge on the CCP1
+ *      (RC2) or CCP2 (RC1) pins is captured in hardware and time stamped with tick resolution.
+ *
+ *      The 32-bit counter wraps after 2^32 ticks (35 minutes at 8 MHz). elapsed() works across
+ *      the wrap, so intervals must always be measured with ticks, not with now_us().
+ *
+ *      timebase_isr() must be called in the high priority interrupt.
+ *  MIT License  (see: LICENSE em github)   <https://github.com/AntonioCastilho>
+ * Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ * _______________________________________________________________________________________
+ * Date:          | Author:               | Description:                                                             | Version:
+ * 10/19/2026 | Antonio Castilho  | Created                                                                    | 00.00.01
+ * 10/19/2026 | Antonio Castilho  | One source in common/ for TIMER.X, ADC.X and ECTsensor.X                    | 00.00.02
+ *________________________________________________________________________________________
+ */
+#ifndef TIMEBASE_H
+#define	TIMEBASE_H
+
+#include <xc.h>
+#include <stdint.h>
+
+// _XTAL_FREQ: from the timebase.h of the project, which includes this file.
+#ifndef _XTAL_FREQ
+    #define _XTAL_FREQ 8000000 // Assume an internal 8 MHz oscillator,
+#endif                                        // see fuse_bits.h and config.h
+
+#define TIMEBASE_TICKS_PER_US   (_XTAL_FREQ / 4000000UL)
+#define ticks_to_us(ticks)      ((uint32_t)(ticks) / TIMEBASE_TICKS_PER_US)
+#define us_to_ticks(us)         ((uint32_t)(us) * TIMEBASE_TICKS_PER_US)
+
+// Capture edge, CCPxCON<3:0>. Pg 143.
+#define TIMEBASE_FALLING        0x04 // Every falling edge.
+#define TIMEBASE_RISING         0x05 // Every rising edge.
+#define TIMEBASE_RISING_4TH     0x06 // Every 4th rising edge.
+#define TIMEBASE_RISING_16TH    0x07 // Every 16th rising edge.
+
+void timebase_ini(void);
+uint32_t timebase_now(void);
+uint32_t now_us(void);
+uint32_t elapsed(uint32_t since);
+void timebase_isr(void);
+
+void timebase_captureIni(uint8_t ccp, uint8_t edge);
+uint8_t timebase_captureGet(uint8_t ccp, uint32_t *stamp);
+
+#endif	/* TIMEBASE_H */
@@ -0,0 +1,283 @@
+/* ****************************************************************************
+ * Project: Control Functions                                File uart.c                                    October/2026
+ * ****************************************************************************
+ * File description: EUSART transmitter with interrupt driven ring buffer, and
+ *                         the receiver with UART_RX_SIZE. See uart.h.
+ *                         The main loop only writes tx_head and the interrupt only
+ *                         writes tx_tail; both are 8-bit, so no lock is needed.
+ *                         The receiver the other way round: the interrupt writes
+ *                         rx_head, uart_read() writes rx_tail.
+ *
+ * ****************************************************************************
+ * Program environment for validation:
+ *   MPLAB X IDE v6.0, XC8 v2.36, C std C90;
+ *   PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal;
+ *   Can Bus Module MCP2515 x TJA1050.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ *   Microchip PIC18F4550 Datasheet.
+ * ****************************************************************************
+ * Date           | Author                | Description
+ * **********|************* *|***************************************************
+ * 10/19/2026 | Antonio Castilho  | Function has been created
+ * 10/19/2026 | Antonio Castilho  | uart_writeRom(), texts of program memory with TBLRD*+
+ * 10/19/2026 | Antonio Castilho  | uart_writeRom(): const __rom char, count bounded by the room
+ * 10/19/2026 | Antonio Castilho  | One source in common/ for CANet.X, ECTsensor.X and PWM.X
+ * 10/19/2026 | Antonio Castilho  | Receiver with UART_RX_SIZE, uart_read()
+ ******************************************************************************/
+
+#include <xc.h>
+#include "uart.h"
+
+#define TX_MASK     (UART_TX_SIZE - 1)
+#define RX_MASK     (UART_RX_SIZE - 1)
+
+static uint8_t tx_buffer[UART_TX_SIZE];
+static volatile uint8_t tx_head; // Next free position, written by the main loop.
+static volatile uint8_t tx_tail; // Next byte to send, written by the interrupt.
+
+volatile uint16_t uart_drops;
+
+#if UART_RX_SIZE
+static uint8_t rx_buffer[UART_RX_SIZE];
+static volatile uint8_t rx_head; // Next free position, written by the interrupt.
+static volatile uint8_t rx_tail; // Next byte to read, written by uart_read().
+
+volatile uint16_t uart_rxDrops;
+#endif
+
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Function: void uart_ini(void)
+ * Description: Asynchronous 8N1 transmitter at UART_BAUD, TX interrupt in low
+ *              priority; with UART_RX_SIZE also the receiver on RC7, RX
+ *              interrupt in low priority. RCONbits.IPEN and INTCONbits.GIEL
+ *              must be set by the program.
+ * Input: void
+ * Output: void
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+void uart_ini(void)
+{
+    TRISCbits.TRISC6 = 0; // TX.
+
+    TXSTA = 0x24;    // 0b00100100 TXEN = 1, SYNC = 0, BRGH = 1. Pg 242.
+    BAUDCON = 0x08;  // 0b00001000 BRG16 = 1. Pg 244.
+    SPBRGH = (uint8_t)(UART_SPBRG >> 8);
+    SPBRG = (uint8_t)UART_SPBRG;
+#if UART_RX_SIZE
+    TRISCbits.TRISC7 = 1; // RX.
+    RCSTA = 0x90;    // 0b10010000 SPEN = 1, CREN = 1. Pg 243.
+    rx_head = 0;
+    rx_tail = 0;
+    uart_rxDrops = 0;
+    IPR1bits.RCIP = 0;
+    PIE1bits.RCIE = 1;
+#else
+    RCSTA = 0x80;    // 0b10000000 SPEN = 1, CREN = 0: transmitter only. Pg 243.
+#endif
+
+    tx_head = 0;
+    tx_tail = 0;
+    uart_drops = 0;
+
+    IPR1bits.TXIP = 0;
+    PIE1bits.TXIE = 0; // Enabled while there are bytes in the buffer.
+
+} // end void uart_ini(void)
+
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Function: uint8_t uart_free(void)
+ * Description: Free bytes in the ring buffer.
+ * Input: void
+ * Output: number of bytes that uart_write() accepts now.
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+uint8_t uart_free(void)
+{
+    return (uint8_t)(TX_MASK - ((tx_head - tx_tail) & TX_MASK));
+
+} // end uint8_t uart_free(void)
+
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Function: uint8_t uart_write(uint8_t data_to_send)
+ * Description: Puts one byte in the ring buffer, without waiting.
+ * Input: byte to send.
+ * Output: 1 if queued, 0 if the buffer is full (the byte is dropped).
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+uint8_t uart_write(uint8_t data_to_send)
+{
+    return uart_writeBuf(&data_to_send, 1);
+
+} // end uint8_t uart_write(uint8_t data_to_send)
+
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Function: uint8_t uart_writeBuf(const uint8_t *data, uint8_t length)
+ * Description: Puts length bytes in the ring buffer, all or none, so a frame is
+ *              never cut in the middle. Does not wait.
+ * Input: bytes to send and their number.
+ * Output: 1 if queued, 0 if there is no room (nothing is queued).
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+uint8_t uart_writeBuf(const uint8_t *data, uint8_t length)
+{
+    uint8_t head = tx_head;
+
+    if(length > uart_free())
+    {
+        uart_drops += length;
+        return 0;
+    }
+
+    while(length--)
+    {
+        tx_buffer[head] = *data++;
+        head = (uint8_t)((head + 1) & TX_MASK);
+    }
+    tx_head = head;          // Bytes visible to the interrupt only now.
+    PIE1bits.TXIE = 1;  // TXIF is set while TXREG is empty. Pg 238.
+    return 1;
+
+} // end uint8_t uart_writeBuf(const uint8_t *data, uint8_t length)
+
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Function: uint8_t uart_writeRom(const __rom char *str)
+ * Description: Puts a string of program memory (ended by 0) in the ring
+ *              buffer, all or none, like uart_writeBuf(). TBLRD*+ reads the
+ *              flash twice, to count and to copy, so the text is not copied to
+ *              RAM first. uart_isr() does not use TBLPTR. Does not wait.
+ *              The count stops at the free room: a longer string is not read
+ *              to its end and the 8-bit count never wraps.
+ * Input: string of program memory (__rom, see lcd.h), up to UART_TX_SIZE - 1
+ *        characters.
+ * Output: 1 if queued, 0 if there is no room (nothing is queued).
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+uint8_t uart_writeRom(const __rom char *str)
+{
+    uint8_t head = tx_head;
+    uint8_t room = uart_free();
+    uint8_t length = 0;
+    uint8_t c;
+
+#if defined(__XC8)
+    TBLPTRU = 0; // 32 KB of program memory. Section 6.2.
+    TBLPTRH = (uint8_t)((uint16_t)str >> 8);
+    TBLPTRL = (uint8_t)((uint16_t)str);
+    while(1)
+    {
+        asm("TBLRD*+");
+        c = TABLAT;
+        if(!c || length == room) break; // length <= room < 256.
+        length++;
+    }
+#else
+    while((c = (uint8_t)str[length]) != 0 && length != room) length++; // gcc on a PC: plain pointer.
+#endif
+
+    if(c) // More characters than the room: the ones counted and the next are dropped.
+    {
+        uart_drops += (uint16_t)length + 1;
+        return 0;
+    }
+
+#if defined(__XC8)
+    TBLPTRH = (uint8_t)((uint16_t)str >> 8);
+    TBLPTRL = (uint8_t)((uint16_t)str);
+#endif
+    while(length--)
+    {
+#if defined(__XC8)
+        asm("TBLRD*+");
+        c = TABLAT;
+#else
+        c = (uint8_t)*str++;
+#endif
+        tx_buffer[head] = c;
+        head = (uint8_t)((head + 1) & TX_MASK);
+    }
+    tx_head = head;
+    PIE1bits.TXIE = 1;
+    return 1;
+
+} // end uint8_t uart_writeRom(const __rom char *str)
+
+#if UART_RX_SIZE
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Function: uint8_t uart_read(uint8_t *data_received)
+ * Description: Takes the oldest byte received, without waiting.
+ * Input: where to put the byte.
+ * Output: 1 if a byte was taken, 0 if none was received.
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+uint8_t uart_read(uint8_t *data_received)
+{
+    if(rx_tail == rx_head) return 0;
+    *data_received = rx_buffer[rx_tail];
+    rx_tail = (uint8_t)((rx_tail + 1) & RX_MASK);
+    return 1;
+
+} // end uint8_t uart_read(uint8_t *data_received)
+#endif
+
+/*-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * Function: void uart_isr(void)
+ * Description: Moves one byte to TXREG each time it is empty and, with the
+ *              receiver, the bytes of RCREG to the receiver ring (a byte
+ *              without room is counted in uart_rxDrops). An overrun (OERR)
+ *              stops the receiver until CREN is cleared. Call it in the low
+ *              priority interrupt.
+ * Input: void
+ * Output: void
+ * Created in: 10/19/2026 by Antonio Aparecido Ariza Castilho
+ */
+
+void uart_isr(void)
+{
+    if(PIE1bits.TXIE && PIR1bits.TXIF) // TXIF is cleared by the write to TXREG.
+    {
+        if(tx_tail != tx_head)
+        {
+            TXREG = tx_buffer[tx_tail];
+            tx_tail = (uint8_t)((tx_tail + 1) & TX_MASK);
+        }
+        else
+        {
+            PIE1bits.TXIE = 0; // Buffer empty.
+        }
+    }
+
+#if UART_RX_SIZE
+    if(RCSTAbits.OERR) // Pg 250.
+    {
+        RCSTAbits.CREN = 0;
+        RCSTAbits.CREN = 1;
+        uart_rxDrops++;
+    }
+    while(PIR1bits.RCIF) // Two bytes in the FIFO at most; RCIF is cleared by the read.
+    {
+        uint8_t byte = RCREG;
+        uint8_t head = (uint8_t)((rx_head + 1) & RX_MASK);
+
+        if(head == rx_tail)
+        {
+            uart_rxDrops++;
+        }
+        else
+        {
+            rx_buffer[rx_head] = byte;
+            rx_head = head;
+        }
+    }
+#endif
+
+} // end void uart_isr(void)
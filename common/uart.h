@@ -0,0 +1,82 @@
+/* ****************************************************************************
+ * Project: Control Functions                                File uart.h                                    October/2026
+ * ****************************************************************************
+ * File description: EUSART transmitter on RC6 (TX) with an interrupt driven
+ *                         ring buffer. uart_write() only copies to the buffer and
+ *                         never waits; the low priority interrupt (uart_isr())
+ *                         moves the bytes to TXREG.
+ *                         The receiver is built only with UART_RX_SIZE set by the
+ *                         uart.h of the project (RC7 is SDO of the SPI on CANet.X):
+ *                         uart_isr() moves RCREG to a second ring and uart_read()
+ *                         takes the bytes from it.
+ *                         UART_BAUD: 115200 by default; the uart.h of a project at
+ *                         8 MHz sets 57600 (115200 is 2.1 % off there, see below).
+ *                         The pages (pg) indicated are references to the pages of the PIC18F4550
+ *                         datasheet (in pdf file).
+ *
+ * ****************************************************************************
+ * Program environment for validation:
+ *   MPLAB X IDE v6.0, XC8 v2.36, C std C90;
+ *   PIC18F4550 mounted on FATEC development board (FATEC board) - 20 MHz crystal;
+ *   Can Bus Module MCP2515 x TJA1050.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ *   Microchip PIC18F4550 Datasheet.
+ * ****************************************************************************
+ * Date           | Author                | Description
+ * **********|************* *|***************************************************
+ * 10/19/2026 | Antonio Castilho  | Function has been created
+ * 10/19/2026 | Antonio Castilho  | uart_writeRom()
+ * 10/19/2026 | Antonio Castilho  | uart_writeRom(): const __rom char, count bounded by the room
+ * 10/19/2026 | Antonio Castilho  | One source in common/ for CANet.X, ECTsensor.X and PWM.X
+ * 10/19/2026 | Antonio Castilho  | Receiver with UART_RX_SIZE, uart_read()
+ ******************************************************************************/
+#ifndef UART_H
+#define	UART_H
+
+#include <xc.h> // include processor files - each processor file is guarded.
+// _XTAL_FREQ and UART_BAUD: from the uart.h of the project, which includes this file.
+
+#ifndef UART_BAUD
+    #define UART_BAUD          115200UL // bit/s. 48 MHz: up to 3 Mbit/s, see UART_SPBRG.
+#endif
+
+#ifndef UART_TX_SIZE
+    #define UART_TX_SIZE     64 // Ring buffer, power of 2, up to 128.
+#endif
+
+#ifndef UART_RX_SIZE
+    #define UART_RX_SIZE     0  // Receiver ring, power of 2, up to 128; 0: no receiver.
+#endif
+
+// 16-bit generator, BRGH = 1: baud = Fosc / (4 * (SPBRG + 1)). Pg 247.
+#define UART_SPBRG          ((_XTAL_FREQ + 2 * UART_BAUD) / (4 * UART_BAUD) - 1)
+#define UART_BAUD_REAL   (_XTAL_FREQ / (4 * (UART_SPBRG + 1)))
+#define UART_BAUD_ERROR ((UART_BAUD_REAL > UART_BAUD) ? \
+                                         (UART_BAUD_REAL - UART_BAUD) : (UART_BAUD - UART_BAUD_REAL))
+
+// The build fails if the baud rate can not be made within 2 %.
+typedef char uart_baud_check[(UART_BAUD_ERROR * 50 <= UART_BAUD && UART_SPBRG <= 0xFFFF) ? 1 : -1];
+typedef char uart_size_check[((UART_TX_SIZE & (UART_TX_SIZE - 1)) == 0 && UART_TX_SIZE <= 128) ? 1 : -1];
+typedef char uart_rx_check[((UART_RX_SIZE & (UART_RX_SIZE - 1)) == 0 && UART_RX_SIZE <= 128) ? 1 : -1];
+
+// function prototypes
+void uart_ini(void);
+uint8_t uart_write(uint8_t data_to_send);
+uint8_t uart_writeBuf(const uint8_t *data, uint8_t length);
+uint8_t uart_writeRom(const __rom char *str);
+uint8_t uart_free(void);
+void uart_isr(void);
+#if UART_RX_SIZE
+uint8_t uart_read(uint8_t *data_received);
+#endif
+
+extern volatile uint16_t uart_drops; // Bytes refused because the buffer was full.
+#if UART_RX_SIZE
+extern volatile uint16_t uart_rxDrops; // Bytes received with the ring full or lost by overrun.
+#endif
+
+#endif	/* UART_H */
@@ -0,0 +1,224 @@
+#!/usr/bin/env python3
+"""Runs the Bench.X cycle benchmark in gpsim (no GUI) and checks it against a baseline.
+
+The firmware (Bench.X/bench.c) measures each routine with a TIMER1 stopwatch and
+writes the smallest and largest count to bench_table at BENCH_TABLE_ADDR; bench_state
+becomes BENCH_DONE at the end. Addresses and routine names are read from bench.h.
+This script:
+    1. runs the .hex (or .cod) in gpsim for at most --cycles instruction cycles;
+    2. reads bench_state and bench_table from the simulated RAM;
+    3. takes the program and data memory used from the XC8 .map (--map, needed:
+       the size and the RAM are part of the baseline);
+    4. prints the result as JSON and compares it with the baseline: a metric above
+       the baseline by more than --tolerance % fails the run (exit code 1), and so
+       does a baseline or a routine missing on either side (record it with
+       --update-baseline).
+
+--host runs instead the host build of Bench.X on the register model
+(tools/bench/bench_host.c, built by make -C tools/host), which prints the same
+bytes as gpsim. Its counts are not instruction cycles: the model counts one per
+SFR access and the cycles of the delays, nothing for the C code (pid_run() is 0).
+They are kept as 'model_counts' in their own section of the baseline, to catch
+changes of the register traffic and of the waits; make -C tools/host test runs
+it. The cycles and the sizes are the 'gpsim' section, recorded from an XC8 build.
+
+Examples:
+    bench_gpsim.py Bench.X/dist/default/production/Bench.X.production.hex \\
+        --map Bench.X/dist/default/production/Bench.X.production.map
+    bench_gpsim.py ... --update-baseline      (after a change that is accepted)
+    bench_gpsim.py --log gpsim.log ...        (parse a saved gpsim session)
+    bench_gpsim.py --host tools/host/build/bench_host
+Needs gpsim 0.31 or newer with the p18f4550 processor.
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(os.path.dirname(HERE))
+BENCH_H = os.path.join(ROOT, 'Bench.X', 'bench.h')
+BASELINE = os.path.join(HERE, 'baseline.json')
+ENTRY_SIZE = 8  # bench_entry_t: uint32_t min, max.
+
+
+def read_bench_h(path):
+    """Returns the addresses, the done marker and the routine names (by id) of bench.h."""
+    text = open(path, encoding='latin-1').read()
+
+    def define(name):
+        m = re.search(r'#define\s+%s\s+(0x[0-9A-Fa-f]+|\d+)' % name, text)
+        if not m:
+            sys.exit('%s: %s not found' % (path, name))
+        return int(m.group(1), 0)
+
+    routines = {}
+    for m in re.finditer(r'#define\s+BENCH_\w+\s+(\d+)\s*//\s*bench:\s*(\w+)', text):
+        routines[int(m.group(1))] = m.group(2)
+    return {
+        'table': define('BENCH_TABLE_ADDR'),
+        'state': define('BENCH_STATE_ADDR'),
+        'done': define('BENCH_DONE'),
+        'routines': [routines[i] for i in sorted(routines)],
+    }
+
+
+def gpsim_script(firmware, cycles, addresses):
+    """gpsim commands: load, run up to the cycle break, examine each byte, quit."""
+    lines = ['processor p18f4550', 'load %s' % firmware, 'break c %d' % cycles, 'run']
+    lines += ['x 0x%03X' % a for a in addresses]
+    lines.append('quit')
+    return '\n'.join(lines) + '\n'
+
+
+def run_gpsim(gpsim, firmware, cycles, addresses):
+    with tempfile.NamedTemporaryFile('w', suffix='.stc', delete=False) as f:
+        f.write(gpsim_script(os.path.abspath(firmware), cycles, addresses))
+        script = f.name
+    try:
+        out = subprocess.run([gpsim, '-i', '-c', script], stdout=subprocess.PIPE,
+                             stderr=subprocess.STDOUT, universal_newlines=True, timeout=600)
+    finally:
+        os.unlink(script)
+    return out.stdout
+
+
+def parse_bytes(log, count):
+    """Values of the last count 'x' answers of the log (lines ending in '= value')."""
+    values = [int(m.group(1), 0) for m in
+              re.finditer(r'=\s*(0x[0-9A-Fa-f]+|\d+)\s*$', log, re.MULTILINE)]
+    if len(values) < count:
+        sys.exit('gpsim: %d of %d RAM bytes read; log:\n%s' % (len(values), count, log))
+    return [v & 0xFF for v in values[-count:]]
+
+
+def parse_map(path):
+    """Program and data memory used, in bytes, from the XC8 memory summary."""
+    text = open(path, encoding='latin-1').read()
+    result = {}
+    for key, label in (('program_bytes', 'Program space'), ('data_bytes', 'Data space')):
+        m = re.search(r'%s\s+used\s+[0-9A-Fa-f]+h\s+\(\s*(\d+)\)' % label, text)
+        if not m:
+            sys.exit('%s: "%s used" not found' % (path, label))
+        result[key] = int(m.group(1))
+    return result
+
+
+def compare(result, baseline, tolerance, counts):
+    """Names of the metrics above the baseline by more than tolerance %, or missing
+    in the baseline or in the result. counts: key of the routine counts."""
+    failures = []
+    pairs = []
+    for name, entry in sorted(result[counts].items()):
+        for key in ('min', 'max'):
+            pairs.append(('%s.%s' % (name, key), entry[key],
+                          baseline.get(counts, {}).get(name, {}).get(key)))
+    for key in ('program_bytes', 'data_bytes'):
+        if key in result or key in baseline:
+            pairs.append((key, result.get(key), baseline.get(key)))
+    for name in sorted(set(baseline.get(counts, {})) - set(result[counts])):
+        print('%-24s %10s  not measured (in the baseline)' % (name, '-'), file=sys.stderr)
+        failures.append(name)
+    for name, value, base in pairs:
+        if value is None:
+            print('%-24s %10s  FAIL not measured (in the baseline)' % (name, '-'), file=sys.stderr)
+            failures.append(name)
+            continue
+        if base is None:
+            print('%-24s %10d  FAIL no baseline' % (name, value), file=sys.stderr)
+            failures.append(name)
+            continue
+        change = 100.0 * (value - base) / base if base else (0.0 if value == base else 100.0)
+        mark = 'FAIL' if change > tolerance else ''
+        print('%-24s %10d  %10d  %+6.1f %% %s' % (name, value, base, change, mark), file=sys.stderr)
+        if mark:
+            failures.append(name)
+    return failures
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('firmware', nargs='?', help='Bench.X .hex or .cod built by XC8')
+    ap.add_argument('--host', metavar='PROGRAM',
+                    help='host build of Bench.X (tools/host build/bench_host) instead of gpsim')
+    ap.add_argument('--map', help='XC8 .map of the same build (program and data size),'
+                    ' needed with gpsim')
+    ap.add_argument('--log', help='saved gpsim output to parse instead of running gpsim')
+    ap.add_argument('--gpsim', default='gpsim')
+    ap.add_argument('--cycles', type=int, default=20000000, help='cycle limit of the run')
+    ap.add_argument('--baseline', default=BASELINE)
+    ap.add_argument('--tolerance', type=float, default=1.0, help='% above the baseline allowed')
+    ap.add_argument('--update-baseline', action='store_true')
+    ap.add_argument('--json', help='also write the result to this file')
+    args = ap.parse_args()
+
+    bench = read_bench_h(BENCH_H)
+    n = len(bench['routines'])
+    addresses = [bench['state'], bench['state'] + 1]
+    addresses += range(bench['table'], bench['table'] + n * ENTRY_SIZE)
+
+    if args.host:
+        out = subprocess.run([args.host], stdout=subprocess.PIPE, universal_newlines=True,
+                             timeout=600)
+        if out.returncode:
+            sys.exit('%s: exit code %d' % (args.host, out.returncode))
+        log = out.stdout
+    elif args.log:
+        log = open(args.log).read()
+    elif args.firmware:
+        log = run_gpsim(args.gpsim, args.firmware, args.cycles, addresses)
+    else:
+        ap.error('firmware, --log or --host needed')
+    if not args.host and not args.map:
+        ap.error('--map needed: the program and data bytes are part of the gpsim baseline')
+    section = 'host' if args.host else 'gpsim'
+    counts = 'model_counts' if args.host else 'cycles'
+    ram = parse_bytes(log, len(addresses))
+
+    state = ram[0] | ram[1] << 8
+    if state != bench['done']:
+        sys.exit('bench_state = 0x%04X, not BENCH_DONE: the run did not end in %d cycles'
+                 % (state, args.cycles))
+
+    result = {counts: {}}
+    for i, name in enumerate(bench['routines']):
+        e = ram[2 + i * ENTRY_SIZE:2 + (i + 1) * ENTRY_SIZE]
+        result[counts][name] = {
+            'min': e[0] | e[1] << 8 | e[2] << 16 | e[3] << 24,
+            'max': e[4] | e[5] << 8 | e[6] << 16 | e[7] << 24,
+        }
+    if not args.host:
+        result.update(parse_map(args.map))
+
+    text = json.dumps(result, indent=2, sort_keys=True)
+    print(text)
+    if args.json:
+        open(args.json, 'w').write(text + '\n')
+
+    baselines = json.load(open(args.baseline)) if os.path.exists(args.baseline) else {}
+    if args.update_baseline:
+        baselines[section] = result
+        open(args.baseline, 'w').write(json.dumps(baselines, indent=2, sort_keys=True) + '\n')
+        print('baseline written: %s [%s]' % (args.baseline, section), file=sys.stderr)
+        return 0
+
+    if section not in baselines:
+        print('%s: no %s baseline, record one with --update-baseline'
+              % (args.baseline, section), file=sys.stderr)
+        return 1
+    failures = compare(result, baselines[section], args.tolerance, counts)
+    if failures:
+        print('regression: %s' % ', '.join(failures), file=sys.stderr)
+        return 1
+    print('bench %s: %d routines within %.1f %% of the baseline (%s)'
+          % (section, len(result[counts]), args.tolerance, counts.replace('_', ' ')),
+          file=sys.stderr)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,74 @@
+/* ****************************************************************************
+ * Project: Control Functions        File bench_host.c (host build) October/2026
+ * ****************************************************************************
+ * File description: Bench.X on the register model of tools/host: runs the
+ *                   main() of bench.c (built as bench_main()) and prints
+ *                   bench_state and bench_table as gpsim answers "x addr",
+ *                   one "0xADDR = 0xVV" line per byte, for bench_gpsim.py
+ *                   --host. The counts are model cycles: one per SFR access
+ *                   plus the delays; the C code costs nothing on the host, so
+ *                   they follow the register traffic and the waits of each
+ *                   routine, not the XC8 code (that is the gpsim run).
+ *                   Without the interrupt dispatch the stopwatch keeps one
+ *                   TIMER1 overflow only (watch_stop()): a count of 2^17
+ *                   cycles or more makes the run fail.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <xc.h>
+#include "bench.h"
+
+extern volatile bench_entry_t bench_table[BENCH_N];
+extern volatile uint16_t bench_state;
+void bench_main(void);
+
+// NTC at mid scale, about 25 C on the FATEC board divider.
+static uint16_t adc_value(uint8_t channel)
+{
+    (void)channel;
+    return 512;
+}
+
+static void print_byte(uint16_t address, uint8_t value)
+{
+    printf("0x%03X = 0x%02x\n", (unsigned)address, (unsigned)value);
+}
+
+int main(void)
+{
+    uint8_t id, i;
+    uint16_t address = BENCH_TABLE_ADDR;
+    uint32_t word;
+
+    host_reset();
+    host_adc_hook = adc_value;
+    bench_main();
+
+    print_byte(BENCH_STATE_ADDR, (uint8_t)bench_state);
+    print_byte(BENCH_STATE_ADDR + 1, (uint8_t)(bench_state >> 8));
+    for(id = 0; id < BENCH_N; id++)
+    {
+        if(bench_table[id].max >= 0x20000UL)
+        {
+            fprintf(stderr, "bench id %u: %lu cycles, more than one TIMER1 overflow\n",
+                    (unsigned)id, (unsigned long)bench_table[id].max);
+            return 1;
+        }
+        for(word = bench_table[id].min, i = 0; i < 8; i++, word >>= 8)
+        {
+            if(i == 4) word = bench_table[id].max;
+            print_byte(address++, (uint8_t)word);
+        }
+    }
+    return 0;
+}
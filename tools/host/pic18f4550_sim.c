@@ -0,0 +1,512 @@
+/* ****************************************************************************
+ * Project: Control Functions             File pic18f4550_sim.c      October/2026
+ * ****************************************************************************
+ * File description: Peripheral models behind the host <xc.h>. The SFRs live
+ *                   in a byte array indexed by their data memory address; on
+ *                   every access the models first react to the previous
+ *                   access (a write to SSPBUF starts a transfer, setting
+ *                   ADCON0.GO runs a conversion, ...) and then time advances
+ *                   by one instruction cycle.
+ *
+ *                   Models: PORTA..E latches, Timer0..3, CCP1 compare,
+ *                   CCP1/CCP2 PWM duty latch,
+ *                   A/D converter, MSSP (SPI and I2C master), EUSART
+ *                   transmitter and receiver, data EEPROM and watchdog; the
+ *                   call of the high priority interrupt (host_isr_hook).
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ * 10/19/2026| Antonio Castilho  | PWM duty latch, T2CON write clears the scalers
+ * 10/19/2026| Antonio Castilho  | host_sleep_hook at the wake-up
+ * 10/19/2026| Antonio Castilho  | host_isr_hook: dispatch of the high priority interrupt
+ * 10/19/2026| Antonio Castilho  | EUSART receiver, host_uart_receive()
+ * 10/19/2026| Antonio Castilho  | TMR0 stops 2 Tcy after a write
+ ******************************************************************************/
+
+#include <string.h>
+#include <xc.h>
+
+#define SFR_BASE    0xF60
+#define SFR_SIZE    0xA0
+#define NO_ACCESS   0x0000
+
+#define R(a)        (sfr[(a) - SFR_BASE])
+#define R16(a)      ((uint16_t)(R(a) | (R((a) + 1) << 8)))
+
+uint16_t (*host_adc_hook)(uint8_t channel);
+uint8_t (*host_spi_hook)(uint8_t mosi);
+void (*host_uart_hook)(uint8_t byte);
+void (*host_port_hook)(uint8_t port, uint8_t value);
+uint8_t (*host_pin_hook)(uint8_t port);
+void (*host_sleep_hook)(uint32_t cycles);
+void (*host_isr_hook)(void);
+
+uint8_t host_eeprom[256];
+uint32_t host_eeprom_writes[256];
+
+static uint8_t sfr[SFR_SIZE];
+static uint16_t last_access;
+static uint8_t port_shadow[5];
+static uint8_t lat_shadow[5];
+static uint8_t ssp_full;
+static uint32_t cycles;
+static uint16_t tmr0_ps, tmr1_ps, tmr2_ps, tmr2_post, tmr3_ps;
+static uint8_t t2con_shadow;       // T2CON before the last access.
+static uint16_t tmr[4];            // Timer0, Timer1, -, Timer3 counters.
+static uint8_t tmr_placed[4];      // TMRxL value given to the last read.
+static uint8_t tmr_write[4];       // TMRxH then TMRxL: 16-bit write in progress.
+static uint8_t tmr0_hold;          // Tcy TMR0 does not count after a write.
+static uint16_t wdt_clears;
+static uint16_t sleeps;
+static uint8_t in_isr;
+static uint8_t rx_queue[256];      // Bytes of host_uart_receive() not yet in RCREG.
+static uint8_t rx_head, rx_tail;
+
+static const uint16_t port_addr[5] = {HOST_PORTA, HOST_PORTB, HOST_PORTC,
+                                      HOST_PORTD, HOST_PORTE};
+
+/******************************************************************************
+ * Function: static void set16(uint16_t addr, uint16_t value)
+ * Description: Writes a 16-bit timer or result register, low byte first.
+ ******************************************************************************/
+static void set16(uint16_t addr, uint16_t value)
+{
+    R(addr) = (uint8_t)value;
+    R(addr + 1) = (uint8_t)(value >> 8);
+}
+
+/******************************************************************************
+ * Function: static void timer16_update(uint8_t n, uint16_t low)
+ * Description: 16-bit timers (TMR0 in 16-bit mode, TMR1 and TMR3 with RD16):
+ *              reading TMRxL latches the high byte into TMRxH; writing TMRxH
+ *              goes to a buffer that is loaded together with TMRxL. A TMRxH
+ *              access followed by a TMRxL access is taken as a 16-bit write.
+ *              TMR0 does not count for 2 Tcy after a write. Pg 125.
+ ******************************************************************************/
+static void timer16_update(uint8_t n, uint16_t low)
+{
+    if(last_access == low)
+    {
+        if(tmr_write[n])
+        {
+            tmr[n] = (uint16_t)(R(low) | (R(low + 1) << 8));
+            tmr_write[n] = 0;
+            if(n == 0) tmr0_hold = 2;
+        }
+        else if(R(low) != tmr_placed[n])
+        {
+            tmr[n] = (uint16_t)((tmr[n] & 0xFF00) | R(low));
+            if(n == 0) tmr0_hold = 2;
+        }
+    }
+}
+
+static void timer16_access(uint8_t n, uint16_t low, uint16_t addr)
+{
+    if(addr == low)
+    {
+        if(last_access == low + 1)
+        {
+            tmr_write[n] = 1;
+        }
+        else
+        {
+            R(low) = tmr_placed[n] = (uint8_t)tmr[n];
+            R(low + 1) = (uint8_t)(tmr[n] >> 8);
+        }
+    }
+}
+
+/******************************************************************************
+ * Function: static void ports_update(void)
+ * Description: A write to PORTx lands in LATx; the pins are then the latch
+ *              for outputs and the pin hook for inputs.
+ ******************************************************************************/
+static void ports_update(void)
+{
+    for(uint8_t i = 0; i < 5; i++)
+    {
+        uint16_t port = port_addr[i];
+        uint16_t lat = port + (HOST_LATA - HOST_PORTA);
+        uint16_t tris = port + (HOST_TRISA - HOST_PORTA);
+
+        if(R(port) != port_shadow[i]) R(lat) = R(port);
+        if(R(lat) != lat_shadow[i])
+        {
+            lat_shadow[i] = R(lat);
+            if(host_port_hook) host_port_hook(i, R(lat));
+        }
+        uint8_t pins = host_pin_hook ? host_pin_hook(i) : 0xFF;
+        R(port) = (uint8_t)((R(lat) & ~R(tris)) | (pins & R(tris)));
+        port_shadow[i] = R(port);
+    }
+}
+
+/******************************************************************************
+ * Function: static void peripherals_update(void)
+ * Description: Reaction of the peripherals to the access that has just been
+ *              completed by the code under test.
+ ******************************************************************************/
+static void peripherals_update(void)
+{
+    ports_update();
+    timer16_update(0, HOST_TMR0L);
+    timer16_update(1, HOST_TMR1L);
+    timer16_update(3, HOST_TMR3L);
+
+    // A write to T2CON clears the prescaler and postscaler counters. Pg 137.
+    if(last_access == HOST_T2CON && R(HOST_T2CON) != t2con_shadow) tmr2_ps = tmr2_post = 0;
+    t2con_shadow = R(HOST_T2CON);
+
+    // A/D conversion completes at once. Pg 259.
+    if((R(HOST_ADCON0) & 0x03) == 0x03)
+    {
+        uint8_t ch = (uint8_t)((R(HOST_ADCON0) >> 2) & 0x0F);
+        uint16_t value = host_adc_hook ? (uint16_t)(host_adc_hook(ch) & 0x3FF) : 0;
+        if(!(R(HOST_ADCON2) & 0x80)) value = (uint16_t)(value << 6);
+        set16(HOST_ADRESL, value);
+        R(HOST_ADCON0) &= (uint8_t)~0x02;
+        R(HOST_PIR1) |= 0x40; // ADIF.
+    }
+
+    // MSSP. Pg 195.
+    if(R(HOST_SSPCON1) & 0x20)
+    {
+        uint8_t i2c = (uint8_t)((R(HOST_SSPCON1) & 0x0F) == 0x08);
+        if(i2c && (R(HOST_SSPCON2) & 0x1F))
+        {
+            R(HOST_SSPCON2) &= (uint8_t)~0x1F; // SEN, RSEN, PEN, RCEN, ACKEN.
+            R(HOST_PIR1) |= 0x08;
+        }
+        if(last_access == HOST_SSPBUF)
+        {
+            if(i2c)
+            {
+                if(host_spi_hook) host_spi_hook(R(HOST_SSPBUF));
+                R(HOST_SSPCON2) &= (uint8_t)~0x40; // ACKSTAT = ACK.
+                R(HOST_PIR1) |= 0x08;
+            }
+            else if(!ssp_full)
+            {
+                uint8_t mosi = R(HOST_SSPBUF);
+                R(HOST_SSPBUF) = host_spi_hook ? host_spi_hook(mosi) : 0xFF;
+                R(HOST_SSPSTAT) |= 0x01; // BF.
+                R(HOST_PIR1) |= 0x08;    // SSPIF.
+                ssp_full = 1;
+            }
+            else
+            {
+                R(HOST_SSPSTAT) &= (uint8_t)~0x01;
+                ssp_full = 0;
+            }
+        }
+    }
+
+    // EUSART transmitter, TXREG is write only. Pg 248.
+    if(R(HOST_TXSTA) & 0x20)
+    {
+        if(last_access == HOST_TXREG && host_uart_hook) host_uart_hook(R(HOST_TXREG));
+        R(HOST_TXSTA) |= 0x02; // TRMT.
+        R(HOST_PIR1) |= 0x10;  // TXIF.
+    }
+
+    // EUSART receiver, SPEN and CREN: a read of RCREG clears RCIF and the next
+    // byte of the queue arrives at once. Pg 250.
+    if((R(HOST_RCSTA) & 0x90) == 0x90)
+    {
+        if(last_access == HOST_RCREG) R(HOST_PIR1) &= (uint8_t)~0x20;
+        if(!(R(HOST_PIR1) & 0x20) && rx_tail != rx_head)
+        {
+            R(HOST_RCREG) = rx_queue[rx_tail++];
+            R(HOST_PIR1) |= 0x20;  // RCIF.
+        }
+    }
+
+    // Data EEPROM. Pg 83.
+    if(R(HOST_EECON1) & 0x01)
+    {
+        R(HOST_EEDATA) = host_eeprom[R(HOST_EEADR)];
+        R(HOST_EECON1) &= (uint8_t)~0x01;
+    }
+    if(R(HOST_EECON1) & 0x02)
+    {
+        if(R(HOST_EECON1) & 0x04)
+        {
+            host_eeprom[R(HOST_EEADR)] = R(HOST_EEDATA);
+            host_eeprom_writes[R(HOST_EEADR)]++;
+        }
+        R(HOST_EECON1) &= (uint8_t)~0x02;
+        R(HOST_PIR2) |= 0x10; // EEIF.
+    }
+}
+
+/******************************************************************************
+ * Function: static void tick(void)
+ * Description: One instruction cycle (Fosc/4) of the timers.
+ ******************************************************************************/
+static void tick(void)
+{
+    static const uint16_t t0ps[8] = {2, 4, 8, 16, 32, 64, 128, 256};
+    static const uint16_t t2ps[4] = {1, 4, 16, 16};
+    uint8_t con;
+
+    cycles++;
+
+    // Timer0. Pg 125.
+    con = R(HOST_T0CON);
+    if(tmr0_hold)
+    {
+        tmr0_hold--;
+    }
+    else if((con & 0x80) && !(con & 0x20))
+    {
+        uint16_t ps = (con & 0x08) ? 1 : t0ps[con & 0x07];
+        if(++tmr0_ps >= ps)
+        {
+            tmr0_ps = 0;
+            if(con & 0x40)
+            {
+                tmr[0] = (uint8_t)(tmr[0] + 1);
+                if(tmr[0] == 0) R(HOST_INTCON) |= 0x04;
+            }
+            else
+            {
+                tmr[0]++;
+                if(tmr[0] == 0) R(HOST_INTCON) |= 0x04; // TMR0IF.
+            }
+        }
+    }
+
+    // Timer1 and CCP1 compare. Pg 131 and 145.
+    con = R(HOST_T1CON);
+    if((con & 0x01) && !(con & 0x02))
+    {
+        if(++tmr1_ps >= (1u << ((con >> 4) & 0x03)))
+        {
+            tmr1_ps = 0;
+            uint16_t t = ++tmr[1];
+            if(t == 0) R(HOST_PIR1) |= 0x01; // TMR1IF.
+            if((R(HOST_CCP1CON) & 0x0F) >= 0x08 && (R(HOST_CCP1CON) & 0x0F) <= 0x0B
+                    && t == R16(HOST_CCPR1L) && !(R(HOST_T3CON) & 0x40))
+            {
+                R(HOST_PIR1) |= 0x04; // CCP1IF.
+                if((R(HOST_CCP1CON) & 0x0F) == 0x0B) tmr[1] = 0;
+            }
+        }
+    }
+
+    // Timer2. Pg 137.
+    con = R(HOST_T2CON);
+    if(con & 0x04)
+    {
+        if(++tmr2_ps >= t2ps[con & 0x03])
+        {
+            tmr2_ps = 0;
+            if(R(HOST_TMR2) == R(HOST_PR2))
+            {
+                R(HOST_TMR2) = 0;
+                // PWM: the duty is latched at the start of the period. Pg 149.
+                if((R(HOST_CCP1CON) & 0x0C) == 0x0C) R(HOST_CCPR1H) = R(HOST_CCPR1L);
+                if((R(HOST_CCP2CON) & 0x0C) == 0x0C) R(HOST_CCPR2H) = R(HOST_CCPR2L);
+                if(++tmr2_post > ((con >> 3) & 0x0F))
+                {
+                    tmr2_post = 0;
+                    R(HOST_PIR1) |= 0x02; // TMR2IF.
+                }
+            }
+            else
+            {
+                R(HOST_TMR2)++;
+            }
+        }
+    }
+
+    // Timer3. Pg 139.
+    con = R(HOST_T3CON);
+    if((con & 0x01) && !(con & 0x02))
+    {
+        if(++tmr3_ps >= (1u << ((con >> 4) & 0x03)))
+        {
+            tmr3_ps = 0;
+            if(++tmr[3] == 0) R(HOST_PIR2) |= 0x02; // TMR3IF.
+        }
+    }
+}
+
+/******************************************************************************
+ * Function: static uint8_t isr_high_pending(void)
+ * Description: An enabled flag of high priority with GIEH set (IPEN = 1), or
+ *              any enabled flag with GIE set (IPEN = 0, PEIE for the
+ *              peripherals). Sources: INTCON (TMR0, INT0, RB), PIR1, PIR2.
+ ******************************************************************************/
+static uint8_t isr_high_pending(void)
+{
+    uint8_t intcon = R(HOST_INTCON);
+    uint8_t ipen = (uint8_t)(R(HOST_RCON) & 0x80);
+    uint8_t core = (uint8_t)(intcon & (intcon >> 3) & 0x07);
+    uint8_t peripheral = (uint8_t)((R(HOST_PIR1) & R(HOST_PIE1) & (ipen ? R(HOST_IPR1) : 0xFF))
+                                   | (R(HOST_PIR2) & R(HOST_PIE2) & (ipen ? R(HOST_IPR2) : 0xFF)));
+
+    if(!(intcon & 0x80)) return 0;
+    if(ipen) core &= (uint8_t)((R(HOST_INTCON2) & 0x05) | 0x02);   // TMR0IP, RBIP; INT0 high.
+    else if(!(intcon & 0x40)) peripheral = 0;                       // PEIE.
+    return (uint8_t)(core || peripheral);
+}
+
+volatile uint8_t *host_sfr(uint16_t addr)
+{
+    peripherals_update();
+    if(host_isr_hook && !in_isr && isr_high_pending())
+    {
+        in_isr = 1;                     // Vector 0x08: GIEH cleared, RETFIE sets it.
+        last_access = NO_ACCESS;
+        R(HOST_INTCON) &= (uint8_t)~0x80;
+        host_isr_hook();
+        peripherals_update();
+        R(HOST_INTCON) |= 0x80;
+        in_isr = 0;
+    }
+    tick();
+    timer16_access(0, HOST_TMR0L, addr);
+    timer16_access(1, HOST_TMR1L, addr);
+    timer16_access(3, HOST_TMR3L, addr);
+    last_access = addr;
+    if(addr < SFR_BASE || addr >= SFR_BASE + SFR_SIZE) addr = HOST_STATUS;
+    return &sfr[addr - SFR_BASE];
+}
+
+void host_reset(void)
+{
+    memset(sfr, 0, sizeof(sfr));
+    R(HOST_TRISA) = 0x7F;
+    R(HOST_TRISB) = 0xFF;
+    R(HOST_TRISC) = 0xF7;
+    R(HOST_TRISD) = 0xFF;
+    R(HOST_TRISE) = 0x07;
+    R(HOST_T0CON) = 0xFF;
+    R(HOST_PR2) = 0xFF;
+    R(HOST_TXSTA) = 0x02;
+    R(HOST_OSCCON) = 0x40;
+    R(HOST_RCON) = 0x1C;
+    memset(port_shadow, 0, sizeof(port_shadow));
+    memset(lat_shadow, 0, sizeof(lat_shadow));
+    memset(host_eeprom, 0xFF, sizeof(host_eeprom));
+    memset(host_eeprom_writes, 0, sizeof(host_eeprom_writes));
+    last_access = NO_ACCESS;
+    ssp_full = 0;
+    rx_head = rx_tail = 0;
+    cycles = 0;
+    tmr0_ps = tmr1_ps = tmr2_ps = tmr2_post = tmr3_ps = 0;
+    t2con_shadow = 0;
+    memset(tmr, 0, sizeof(tmr));
+    memset(tmr_write, 0, sizeof(tmr_write));
+    tmr0_hold = 0;
+    wdt_clears = 0;
+    sleeps = 0;
+}
+
+void host_uart_receive(uint8_t byte)
+{
+    rx_queue[rx_head++] = byte;
+}
+
+void host_cycles(uint32_t n)
+{
+    peripherals_update();
+    last_access = NO_ACCESS;
+    while(n--) tick();
+}
+
+uint32_t host_cycle_count(void)
+{
+    return cycles;
+}
+
+void host_clrwdt(void)
+{
+    wdt_clears++;
+}
+
+/******************************************************************************
+ * Function: void host_sleep(void)
+ * Description: SLEEP/IDLE: time runs until an enabled interrupt flag is set.
+ ******************************************************************************/
+void host_sleep(void)
+{
+    uint32_t start = cycles;
+
+    sleeps++;
+    for(uint32_t guard = 0; guard < 100000000UL; guard++)
+    {
+        host_cycles(1);
+        if((R(HOST_INTCON) & (R(HOST_INTCON) << 3) & 0x38)
+                || (R(HOST_INTCON3) & (R(HOST_INTCON3) >> 3) & 0x03)
+                || (R(HOST_PIR1) & R(HOST_PIE1))
+                || (R(HOST_PIR2) & R(HOST_PIE2))) break;
+    }
+    if(host_sleep_hook) host_sleep_hook(cycles - start);
+}
+
+uint16_t host_wdt_clears(void)
+{
+    return wdt_clears;
+}
+
+uint16_t host_sleep_count(void)
+{
+    return sleeps;
+}
+
+/******************************************************************************
+ * Functions: itoa(), utoa(), ltoa(), ultoa()
+ * Description: XC8 <stdlib.h> conversions, buffer first: itoa(buf, val, base).
+ *              Base 2 to 16, '-' only in base 10 as in XC8.
+ ******************************************************************************/
+char *ultoa(char *buf, unsigned long val, int base)
+{
+    char tmp[33];
+    uint8_t n = 0;
+    uint8_t i = 0;
+
+    do
+    {
+        tmp[n++] = "0123456789ABCDEF"[val % (unsigned)base];
+        val /= (unsigned)base;
+    } while(val);
+    while(n) buf[i++] = tmp[--n];
+    buf[i] = 0;
+    return buf;
+}
+
+char *ltoa(char *buf, long val, int base)
+{
+    if(val < 0 && base == 10)
+    {
+        buf[0] = '-';
+        ultoa(buf + 1, 0UL - (unsigned long)val, base);
+        return buf;
+    }
+    return ultoa(buf, (unsigned long)val, base);
+}
+
+char *utoa(char *buf, unsigned val, int base)
+{
+    return ultoa(buf, val, base);
+}
+
+char *itoa(char *buf, int val, int base)
+{
+    if(base != 10) return ultoa(buf, (unsigned)val, base);
+    return ltoa(buf, val, base);
+}
+// end of the conversions
@@ -0,0 +1,100 @@
+/* ****************************************************************************
+ * Project: Control Functions           File boot_time.c (host test) October/2026
+ * ****************************************************************************
+ * File description: Boot of ADC.X on the register model, 8 MHz: main() of
+ *                   main.c (built as adc_main()) runs from reset with its
+ *                   TIMER3 interrupt served by the model (host_isr_hook).
+ *                   The display is played back from the changes of LATD
+ *                   (characters: RS = 1 at the falling edge of E). Times from
+ *                   reset, in model cycles (Tcy = 0.5 us):
+ *                     - first reading of the A/D (GO of channel 0): within
+ *                       1 ms, before the display is started (before
+ *                       lcd_iniStart() and lcd_splash() it was after the 6 s
+ *                       of the two welcome screens, see README);
+ *                     - first character of the splash and the 32 characters
+ *                       of the first welcome screen: within 100 ms;
+ *                     - boot_us of main.c agrees with the model;
+ *                     - a reading every second while the splash is shown.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#include <setjmp.h>
+#include <xc.h>
+#include "main.h"
+#include "check.h"
+
+#undef main             // boot_time_DEFS: -Dmain=adc_main, for main.c of ADC.X.
+
+#define PORT_D      3
+#define TCY_PER_MS  (_XTAL_FREQ / 4000UL)
+#define SPLASH_CHARS    32          // Two rows of 16.
+#define READINGS    4               // Run until this reading, about 3 s.
+
+void adc_main(void);
+void isr_high(void);
+extern uint32_t boot_us;
+
+static jmp_buf stop;
+static uint32_t reading_at[READINGS];
+static uint8_t readings;
+static uint32_t char_at[SPLASH_CHARS];
+static uint16_t chars;
+static uint8_t last;
+
+static uint16_t reading(uint8_t channel)
+{
+    (void)channel;
+    if(readings < READINGS) reading_at[readings] = host_cycle_count();
+    if(++readings > READINGS) longjmp(stop, 1);
+    return 512;
+}
+
+static void traced(uint8_t port, uint8_t value)
+{
+    if(port != PORT_D) return;
+    if((last & ~value & LCD_E_MASK) && (value & LCD_MASK(LCD_PIN_RS)))
+    {
+        if(chars < 2 * SPLASH_CHARS && (chars & 1) == 0) char_at[chars / 2] = host_cycle_count();
+        chars++;                    // Two nibbles a character.
+    }
+    last = value;
+}
+
+static double ms(uint32_t cycles)
+{
+    return cycles / (double)TCY_PER_MS;
+}
+
+int main(void)
+{
+    uint8_t i;
+
+    host_reset();
+    host_adc_hook = reading;
+    host_port_hook = traced;
+    host_isr_hook = isr_high;
+    if(!setjmp(stop)) adc_main();
+
+    printf("  first reading %.3f ms, splash from %.1f ms to %.1f ms (32 characters),"
+           " boot_us %lu\n", ms(reading_at[0]), ms(char_at[0]), ms(char_at[SPLASH_CHARS - 1]),
+           (unsigned long)boot_us);
+    CHECK(reading_at[0] < TCY_PER_MS);
+    CHECK(reading_at[0] < char_at[0]);
+    CHECK(chars >= 2 * SPLASH_CHARS);
+    CHECK(char_at[SPLASH_CHARS - 1] < 100 * TCY_PER_MS);
+    CHECK(boot_us > 0 && boot_us * (TCY_PER_MS / 1000) <= reading_at[0] + 100);
+    for(i = 1; i < READINGS; i++)                   // SAMPLE_TICKS, 1 s.
+        CHECK(reading_at[i] - reading_at[i - 1] >= 1000 * TCY_PER_MS
+              && reading_at[i] - reading_at[i - 1] < 1001 * TCY_PER_MS);
+
+    return check_end("boot_time");
+}
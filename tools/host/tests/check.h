@@ -0,0 +1,41 @@
+/* ****************************************************************************
+ * Project: Control Functions             File check.h (host tests)  October/2026
+ * ****************************************************************************
+ * File description: Checks of the host tests. CHECK() prints the failed
+ *                   condition with its line; check_end() prints PASS or FAIL
+ *                   and is the exit code of main(), so "make test" stops at
+ *                   the first test that fails.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#ifndef HOST_CHECK_H
+#define	HOST_CHECK_H
+
+#include <stdio.h>
+
+static int check_fails;
+
+#define CHECK(cond)     do { if(!(cond)) { check_fails++; \
+                            printf("  %s:%d: %s\n", __FILE__, __LINE__, #cond); } } while(0)
+
+// CHECK() with the two values, for numbers.
+#define CHECK_EQ(got, want) do { long long g_ = (long long)(got), w_ = (long long)(want); \
+                            if(g_ != w_) { check_fails++; printf("  %s:%d: %s = %lld, want %lld\n", \
+                            __FILE__, __LINE__, #got, g_, w_); } } while(0)
+
+static int check_end(const char *name)
+{
+    printf("%s: %s\n", name, check_fails ? "FAIL" : "PASS");
+    return check_fails ? 1 : 0;
+}
+
+#endif	/* HOST_CHECK_H */
@@ -0,0 +1,307 @@
+/* ****************************************************************************
+ * Project: Control Functions       File debounce_keys.c (host test) October/2026
+ * ****************************************************************************
+ * File description: Vertical counter debounce of debounce.c (Bouncing.X),
+ *                   built with 4 inputs on PORTB and the 3 buttons on PORTE.
+ *                     - bounce: a button that bounces for a few ticks gives
+ *                       one PRESS 4 equal samples after it settles, and one
+ *                       RELEASE; pulses of 3 ticks are ignored, of 4 taken;
+ *                     - a button held at debounce_ini() gives no PRESS;
+ *                     - LONG after DEBOUNCE_LONG_MS, REPEAT every
+ *                       DEBOUNCE_REPEAT_MS, counted from the last press;
+ *                     - queue full: the events that do not fit are lost and
+ *                       counted, the ones before them kept in order;
+ *                     - random inputs on all the keys against a counter per
+ *                       key (the plain algorithm): the same events in the
+ *                       same order, and the same drops of the queue;
+ *                     - the TIMER0 tick of debounce_isr() is DEBOUNCE_TICK_MS
+ *                       on the register model, without drift.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <xc.h>
+#include "debounce.h"
+#include "check.h"
+
+#define KEYS        16
+#define LONG_TICKS  (DEBOUNCE_LONG_MS / DEBOUNCE_TICK_MS)
+#define REPEAT_TICKS (DEBOUNCE_REPEAT_MS / DEBOUNCE_TICK_MS)
+
+static uint8_t pins_b = 0xFF, pins_e = 0xFF;    // 0 = pressed.
+
+static uint8_t pins(uint8_t port)
+{
+    if(port == 1) return pins_b;
+    if(port == 4) return pins_e;
+    return 0xFF;
+}
+
+// Counter per key, as written in the papers before the vertical form.
+static uint8_t ref_state[KEYS], ref_count[KEYS];
+static uint16_t ref_hold;
+static uint8_t ref_queue[256];
+static uint16_t ref_n, ref_drops;
+
+static int key_used(uint8_t key)
+{
+    return (key < 8) ? (DEBOUNCE_PORTB_MASK >> key) & 1 : (DEBOUNCE_PORTE_MASK >> (key - 8)) & 1;
+}
+
+static uint8_t key_pressed(uint8_t key)
+{
+    return (uint8_t)!(((key < 8) ? pins_b >> key : pins_e >> (key - 8)) & 1);
+}
+
+static void ref_post(uint8_t event)
+{
+    if(ref_n >= DEBOUNCE_QUEUE - 1) ref_drops++;    // Drained at each tick.
+    else ref_queue[ref_n++] = event;
+}
+
+static void ref_ini(void)
+{
+    uint8_t k;
+
+    for(k = 0; k < KEYS; k++)
+    {
+        ref_state[k] = key_used(k) ? key_pressed(k) : 0;
+        ref_count[k] = 0;
+    }
+    ref_hold = 0;
+}
+
+// One tick: events in the order of debounce_tick(), PORTB then PORTE.
+static void ref_tick(void)
+{
+    uint8_t k, first, type, changed[KEYS], any_press = 0, held = 0;
+
+    ref_n = 0;
+    for(k = 0; k < KEYS; k++)
+    {
+        changed[k] = 0;
+        if(!key_used(k)) continue;
+        if(key_pressed(k) == ref_state[k]) ref_count[k] = 0;
+        else if(++ref_count[k] == 4)
+        {
+            ref_state[k] ^= 1;
+            ref_count[k] = 0;
+            changed[k] = 1;
+            any_press |= ref_state[k];
+        }
+        held |= ref_state[k];
+    }
+    for(first = 0; first < KEYS; first += 8)
+    {
+        for(k = first; k < first + 8; k++)
+            if(changed[k] && ref_state[k]) ref_post((uint8_t)(DEBOUNCE_PRESS | k));
+        for(k = first; k < first + 8; k++)
+            if(changed[k] && !ref_state[k]) ref_post((uint8_t)(DEBOUNCE_RELEASE | k));
+    }
+    if(any_press || !held)
+    {
+        ref_hold = 0;
+        return;
+    }
+    if(++ref_hold == LONG_TICKS) type = DEBOUNCE_LONG;
+    else if(ref_hold == LONG_TICKS + REPEAT_TICKS) type = DEBOUNCE_REPEAT;
+    else return;
+    if(type == DEBOUNCE_REPEAT) ref_hold = LONG_TICKS;
+    for(k = 8; k < KEYS; k++) if(ref_state[k]) ref_post((uint8_t)(type | k));    // PORTE first.
+    for(k = 0; k < 8; k++) if(ref_state[k]) ref_post((uint8_t)(type | k));
+}
+
+/* Ticks with the pins as they are: the events of the driver, drained at each
+ * tick as the main loop does, into got[] (n returned). */
+static uint16_t ticks(uint16_t n, uint8_t *got, uint16_t room)
+{
+    uint16_t count = 0;
+    uint8_t e;
+
+    while(n--)
+    {
+        debounce_tick();
+        while((e = debounce_get()) != DEBOUNCE_NONE)
+        {
+            if(count < room) got[count] = e;
+            count++;
+        }
+    }
+    return count;
+}
+
+static void press(uint8_t key, uint8_t down)
+{
+    uint8_t *p = (key < 8) ? &pins_b : &pins_e;
+    uint8_t bit = (uint8_t)(1 << (key & 7));
+
+    *p = down ? (uint8_t)(*p & ~bit) : (uint8_t)(*p | bit);
+}
+
+/* Bouncing edge: runs of 1 to 3 ticks at each level (never 4 equal samples
+ * away from the state), ending at the old level; then the new one. */
+static void bounce(uint8_t key, uint8_t down)
+{
+    uint8_t run, level = down, got[16];
+    int8_t i;
+
+    for(i = 0; i < 8; i++, level = (uint8_t)!level)
+    {
+        press(key, level);
+        for(run = (uint8_t)(rand() % 3 + 1); run; run--) CHECK_EQ(ticks(1, got, 16), 0);
+    }
+    press(key, down);
+}
+
+static void scenarios(void)
+{
+    uint8_t got[32];
+    uint16_t n, t;
+
+    // Held at the start: no PRESS, only its RELEASE.
+    pins_b = 0xFF;
+    pins_e = 0xFE;
+    debounce_ini();
+    CHECK(debounce_isPressed(KEY_BTN_1));
+    pins_e = 0xFF;
+    n = ticks(10, got, 32);
+    CHECK_EQ(n, 1);
+    CHECK_EQ(got[0], DEBOUNCE_RELEASE | KEY_BTN_1);
+
+    // Bouncing press and release: one event each, 4 ticks after settling.
+    for(t = 0; t < 20; t++)
+    {
+        bounce(KEY_BTN_2, 1);
+        CHECK_EQ(ticks(3, got, 32), 0);
+        n = ticks(1, got, 32);
+        CHECK_EQ(n, 1);
+        CHECK_EQ(got[0], DEBOUNCE_PRESS | KEY_BTN_2);
+        bounce(KEY_BTN_2, 0);
+        CHECK_EQ(ticks(3, got, 32), 0);
+        n = ticks(1, got, 32);
+        CHECK_EQ(n, 1);
+        CHECK_EQ(got[0], DEBOUNCE_RELEASE | KEY_BTN_2);
+    }
+
+    // Pulses: 3 ticks ignored, 4 taken.
+    press(DEBOUNCE_KEY_RB(2), 1);
+    CHECK_EQ(ticks(3, got, 32), 0);
+    press(DEBOUNCE_KEY_RB(2), 0);
+    CHECK_EQ(ticks(10, got, 32), 0);
+    press(DEBOUNCE_KEY_RB(2), 1);
+    n = ticks(4, got, 32);
+    press(DEBOUNCE_KEY_RB(2), 0);
+    n += ticks(10, got + 1, 31);
+    CHECK_EQ(n, 2);
+    CHECK_EQ(got[0], DEBOUNCE_PRESS | DEBOUNCE_KEY_RB(2));
+    CHECK_EQ(got[1], DEBOUNCE_RELEASE | DEBOUNCE_KEY_RB(2));
+
+    // Long press: LONG at LONG_TICKS after the PRESS, then REPEAT.
+    press(KEY_BTN_3, 1);
+    CHECK_EQ(ticks(4, got, 32), 1);
+    CHECK_EQ(ticks(LONG_TICKS - 1, got, 32), 0);
+    CHECK_EQ(ticks(1, got, 32), 1);
+    CHECK_EQ(got[0], DEBOUNCE_LONG | KEY_BTN_3);
+    for(t = 0; t < 3; t++)
+    {
+        CHECK_EQ(ticks(REPEAT_TICKS - 1, got, 32), 0);
+        CHECK_EQ(ticks(1, got, 32), 1);
+        CHECK_EQ(got[0], DEBOUNCE_REPEAT | KEY_BTN_3);
+    }
+    // A second button pressed restarts the count, LONG for both.
+    press(KEY_BTN_1, 1);
+    CHECK_EQ(ticks(4, got, 32), 1);
+    CHECK_EQ(ticks(LONG_TICKS, got, 32), 2);
+    CHECK_EQ(got[0], DEBOUNCE_LONG | KEY_BTN_1);
+    CHECK_EQ(got[1], DEBOUNCE_LONG | KEY_BTN_3);
+    pins_e = 0xFF;
+    CHECK_EQ(ticks(4, got, 32), 2);
+
+    /* Queue full: the 7 keys pressed together fill the 7 free slots of the
+     * queue; released without reading it, the 7 RELEASE are lost and counted. */
+    n = debounce_getDrops();
+    pins_b = 0xF0;
+    pins_e = 0xF8;
+    for(t = 0; t < 4; t++) debounce_tick();
+    pins_b = pins_e = 0xFF;
+    for(t = 0; t < 4; t++) debounce_tick();
+    CHECK_EQ(debounce_getDrops() - n, 7);
+    CHECK_EQ(ticks(1, got, 32), 7);
+    for(t = 0; t < 4; t++) CHECK_EQ(got[t], DEBOUNCE_PRESS | DEBOUNCE_KEY_RB(t));
+    for(t = 0; t < 3; t++) CHECK_EQ(got[4 + t], DEBOUNCE_PRESS | DEBOUNCE_KEY_RE(t));
+}
+
+// Random inputs against the counters per key, tick by tick.
+static void random_keys(uint32_t n)
+{
+    uint8_t got[32], hold[KEYS] = {0}, k;
+    uint16_t count, i, drops = 0, base = debounce_getDrops();
+    uint32_t t, events = 0, bad = 0;
+
+    ref_ini();
+    for(t = 0; t < n; t++)
+    {
+        for(k = 0; k < KEYS; k++)
+        {
+            if(!key_used(k)) continue;
+            if(hold[k]) { hold[k]--; continue; }
+            press(k, (uint8_t)!key_pressed(k));
+            // Glitches of 1 to 4 ticks and presses up to 3 s.
+            hold[k] = (uint8_t)((rand() & 3) ? rand() % 5 : rand() % 250);
+            if(!(rand() & 7)) hold[k] = 0;
+        }
+        ref_tick();
+        count = ticks(1, got, 32);
+        events += count;
+        if(count != ref_n) bad++;
+        for(i = 0; i < count && i < ref_n; i++) if(got[i] != ref_queue[i]) bad++;
+        drops = (uint16_t)(drops + ref_drops);
+        ref_drops = 0;
+    }
+    printf("  %lu random ticks: %lu events, %u lost with the queue full, %lu differences\n",
+           (unsigned long)n, (unsigned long)events, (unsigned)(drops), (unsigned long)bad);
+    CHECK_EQ(bad, 0);
+    CHECK_EQ((uint16_t)(debounce_getDrops() - base), drops);
+    for(k = 0; k < KEYS; k++) if(key_used(k)) CHECK_EQ(debounce_isPressed(k), ref_state[k]);
+}
+
+// TIMER0 tick on the model: debounce_isr() called at each TMR0IF.
+static void timer_tick(void)
+{
+    uint32_t start, end, n = 0;
+
+    host_reset();
+    pins_b = pins_e = 0xFF;
+    debounce_ini();
+    start = host_cycle_count();
+    end = start + 1000UL * DEBOUNCE_TICK_MS * (_XTAL_FREQ / 4000);  // 1000 ticks.
+    while(host_cycle_count() < end)
+    {
+        if(!INTCONbits.TMR0IF) continue;
+        debounce_isr();
+        n++;
+    }
+    CHECK(n >= 999 && n <= 1000);
+    printf("  TIMER0 tick: %u TMR0 counts of 1:32, %lu ticks in %lu ms\n",
+           (unsigned)DEBOUNCE_TMR0_COUNTS, (unsigned long)n,
+           (unsigned long)((end - start) / (_XTAL_FREQ / 4000)));
+}
+
+int main(void)
+{
+    host_pin_hook = pins;
+    srand(1);
+    scenarios();
+    random_keys(200000);
+    timer_tick();
+    return check_end("debounce_keys");
+}
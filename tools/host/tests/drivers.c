@@ -0,0 +1,89 @@
+/* ****************************************************************************
+ * Project: Control Functions             File drivers.c (host test) October/2026
+ * ****************************************************************************
+ * File description: Unit test of drivers on the register model: adc_read()
+ *                   (ADC.X) returns the conversion of the channel asked,
+ *                   spi_write() / spi_read() (CANet.X) exchange the bytes and
+ *                   uart_writeRom() (CANet.X) queues a text that fits, all or
+ *                   none, and refuses a longer one (300 characters: no wrap
+ *                   of the count).
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ * 10/19/2026| Antonio Castilho  | uart_writeRom(): length bounded by the room
+ ******************************************************************************/
+
+#include <xc.h>
+#include <string.h>
+#include "check.h"
+
+void adc_ini(void);
+uint16_t adc_read(uint8_t ch);
+void spi_initialize(void);
+void spi_write(uint8_t data_to_send);
+uint8_t spi_read(void);
+void uart_ini(void);
+uint8_t uart_free(void);
+uint8_t uart_writeRom(const char *str);
+extern volatile uint16_t uart_drops;
+
+static uint8_t adc_channel;
+static uint8_t spi_out[4];
+static uint8_t spi_n;
+
+static uint16_t adc_hook(uint8_t channel)
+{
+    adc_channel = channel;
+    return (uint16_t)(channel * 100 + 7);
+}
+
+static uint8_t spi_hook(uint8_t mosi)
+{
+    if(spi_n < sizeof(spi_out)) spi_out[spi_n++] = mosi;
+    return 0x42;
+}
+
+int main(void)
+{
+    static char text[301];
+    uint8_t room;
+
+    host_reset();
+    host_adc_hook = adc_hook;
+    host_spi_hook = spi_hook;
+
+    adc_ini();
+    CHECK_EQ(adc_read(0), 7);
+    CHECK_EQ(adc_channel, 0);
+    CHECK_EQ(adc_read(2), 207);
+    CHECK_EQ(adc_channel, 2);
+
+    spi_initialize();
+    spi_write(0xA5);
+    CHECK_EQ(spi_n, 1);
+    CHECK_EQ(spi_out[0], 0xA5);
+    CHECK_EQ(spi_read(), 0x42);
+
+    uart_ini();
+    memset(text, 'x', sizeof(text) - 1);
+    text[sizeof(text) - 1] = 0;
+    room = uart_free();
+    CHECK_EQ(uart_writeRom(text), 0);           // 300 characters.
+    CHECK_EQ(uart_free(), room);
+    CHECK_EQ(uart_drops, room + 1);
+    text[room + 1] = 0;
+    CHECK_EQ(uart_writeRom(text), 0);           // One more than the room.
+    CHECK_EQ(uart_free(), room);
+    text[room] = 0;
+    CHECK_EQ(uart_writeRom(text), 1);           // Exactly the room.
+    CHECK_EQ(uart_free(), 0);
+
+    return check_end("drivers");
+}
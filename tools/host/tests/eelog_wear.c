@@ -0,0 +1,224 @@
+/* ****************************************************************************
+ * Project: Control Functions          File eelog_wear.c (host test) October/2026
+ * ****************************************************************************
+ * File description: EEPROM record log of eelog.c (common) on the register
+ *                   model, which counts the writes of each EEPROM cell
+ *                   (host_eeprom_writes[]). EEIF is served as isr_low would,
+ *                   and a power loss is eelog_ini() again on the EEPROM as it
+ *                   was left (no host_reset()).
+ *                     - wear: records with power cycles in between go round
+ *                       all the slots, each slot the same number of records,
+ *                       no cell written more often than its slot, no write
+ *                       outside EELOG_START .. EELOG_START + EELOG_SIZE - 1;
+ *                     - eelog_readOld(): the last EELOG_SLOTS records;
+ *                     - torn record: a write cut after each byte (and with
+ *                       the byte being written left as garbage) gives at the
+ *                       next eelog_ini() the record before, or the new one
+ *                       when it was complete, never a mix; the log goes on
+ *                       from there;
+ *                     - worn cell: a byte that does not take is written
+ *                       EELOG_TRIES times, the record is given up and the one
+ *                       before is the newest at the next start;
+ *                     - wrap of seq at 65535 across power cycles.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#include <xc.h>
+#include "eelog.h"
+#include "check.h"
+
+#define ROUNDS      100     // Records per slot in the wear run.
+#define NO_CELL     0xFFFF
+
+static uint16_t worn = NO_CELL;     // Cell whose writes do not take.
+static uint8_t worn_old;
+static uint32_t worn_writes;
+
+static uint32_t writes(void)
+{
+    uint32_t n = 0;
+    uint16_t i;
+
+    for(i = 0; i < 256; i++) n += host_eeprom_writes[i];
+    return n;
+}
+
+// Fewest and most writes of a cell of the log; none outside it.
+static void spread(uint32_t *low, uint32_t *high)
+{
+    uint16_t cell;
+
+    *low = 0xFFFFFFFFUL;
+    *high = 0;
+    for(cell = 0; cell < 256; cell++)
+    {
+        if(cell < EELOG_START || cell >= EELOG_START + EELOG_SIZE)
+        {
+            CHECK_EQ(host_eeprom_writes[cell], 0);
+            continue;
+        }
+        if(host_eeprom_writes[cell] < *low) *low = host_eeprom_writes[cell];
+        if(host_eeprom_writes[cell] > *high) *high = host_eeprom_writes[cell];
+    }
+}
+
+// Serves EEIF until the record is done; the worn cell keeps its value.
+static void drain(void)
+{
+    uint16_t n = 0;
+
+    while(eelog_isBusy() && ++n < 100)
+    {
+        if(!PIR2bits.EEIF) continue;
+        if(worn != NO_CELL && host_eeprom[worn] != worn_old)
+        {
+            host_eeprom[worn] = worn_old;
+            worn_writes++;
+        }
+        eelog_isr();
+    }
+    CHECK(!eelog_isBusy());
+}
+
+static void record(uint32_t value)
+{
+    CHECK(eelog_write(&value, sizeof(value)));
+    CHECK(!eelog_write(&value, sizeof(value)));     // Busy with this one.
+    drain();
+}
+
+// Newest record after a power cycle.
+static uint16_t restart(uint32_t *value)
+{
+    *value = 0;
+    CHECK(eelog_ini());
+    CHECK(eelog_read(value, sizeof(*value)));
+    return eelog_getSeq();
+}
+
+int main(void)
+{
+    uint32_t value, n, k, before, low, high;
+    uint16_t seq, i, slot, check;
+    uint32_t check_writes;
+    uint8_t garbage, cut, torn = 0;
+    uint8_t per_slot_ok = 1;
+
+    host_reset();
+    RCONbits.IPEN = 1;
+    INTCONbits.GIEH = 1;
+    INTCONbits.GIEL = 1;
+
+    // Erased EEPROM: empty log.
+    CHECK_EQ(eelog_ini(), 0);
+    CHECK_EQ(eelog_getSeq(), 0xFFFF);
+    CHECK(!eelog_read(&value, sizeof(value)));
+    CHECK(!eelog_readOld(0, &value, sizeof(value)));
+
+    // Wear: a power cycle every 7 records, so the starts fall on every slot.
+    for(n = 0; n < ROUNDS * EELOG_SLOTS; n++)
+    {
+        record(n * 7);
+        if(n % 7 == 6)
+        {
+            CHECK_EQ(restart(&value), n);
+            CHECK_EQ(value, n * 7);
+        }
+    }
+    spread(&low, &high);
+    CHECK(high <= ROUNDS);
+    // seq low changes at every record of a slot (16 apart): one write each.
+    for(slot = 0; slot < EELOG_SLOTS; slot++)
+        if(host_eeprom_writes[EELOG_START + slot * EELOG_RECORD] != ROUNDS) per_slot_ok = 0;
+    CHECK(per_slot_ok);
+    printf("  %u records, %u slots: %u records per slot, %lu byte writes, %lu..%lu per cell\n",
+           (unsigned)(ROUNDS * EELOG_SLOTS), (unsigned)EELOG_SLOTS, (unsigned)ROUNDS,
+           (unsigned long)writes(), (unsigned long)low, (unsigned long)high);
+
+    // The last EELOG_SLOTS records.
+    seq = restart(&value);
+    for(i = 0; i < EELOG_SLOTS; i++)
+    {
+        CHECK(eelog_readOld((uint8_t)i, &value, sizeof(value)));
+        CHECK_EQ(value, (uint32_t)(seq - i) * 7);
+    }
+    CHECK(!eelog_readOld(EELOG_SLOTS, &value, sizeof(value)));
+
+    // Torn record: power lost after k bytes written, the byte k clean or garbage.
+    for(garbage = 0; garbage < 2; garbage++)
+    {
+        for(k = 1; k <= EELOG_RECORD; k++)
+        {
+            seq = restart(&value);
+            check = EELOG_START + ((seq + 1) % EELOG_SLOTS) * EELOG_RECORD + EELOG_RECORD - 1;
+            check_writes = host_eeprom_writes[check];
+            before = writes();
+            CHECK(eelog_write(&k, sizeof(k)));      // Starts the first byte.
+            while(eelog_isBusy() && writes() - before < k)
+                if(PIR2bits.EEIF) eelog_isr();
+            cut = eelog_isBusy();                   // Byte k written, not read back.
+            if(garbage && cut) host_eeprom[EEADR] ^= 0x5A;
+            if((garbage && cut) || (cut && host_eeprom_writes[check] == check_writes))
+            {
+                CHECK_EQ(restart(&value), seq);     // The record before.
+                CHECK_EQ(value, (uint32_t)seq * 7);
+                torn++;
+            }
+            else
+            {
+                CHECK_EQ(restart(&value), (uint16_t)(seq + 1));
+                CHECK_EQ(value, k);
+                record((uint32_t)(seq + 2) * 7);    // Back to the pattern.
+                CHECK_EQ(restart(&value), (uint16_t)(seq + 2));
+                continue;
+            }
+            record((uint32_t)(seq + 1) * 7);        // Over the torn slot.
+            CHECK_EQ(restart(&value), (uint16_t)(seq + 1));
+            CHECK(eelog_readOld(1, &value, sizeof(value)));
+            CHECK_EQ(value, (uint32_t)seq * 7);
+        }
+    }
+    printf("  %u power losses in a record: %u torn (the record before taken), %u complete\n",
+           (unsigned)(2 * EELOG_RECORD), (unsigned)torn, (unsigned)(2 * EELOG_RECORD - torn));
+    CHECK(torn > 0);
+
+    // Worn cell: seq low of the next slot, written again and again, then given up.
+    seq = restart(&value);
+    slot = (uint16_t)((((uint32_t)seq + 1) % EELOG_SLOTS));
+    worn = EELOG_START + slot * EELOG_RECORD;
+    worn_old = host_eeprom[worn];
+    worn_writes = 0;
+    record(0xDEAD);
+    CHECK_EQ(worn_writes, 3);           // EELOG_TRIES.
+    CHECK_EQ(eelog_getErrors(), 1);
+    worn = NO_CELL;
+    CHECK_EQ(restart(&value), seq);
+    CHECK_EQ(eelog_getErrors(), 0);
+    record((uint32_t)(seq + 1) * 7);
+    CHECK_EQ(restart(&value), (uint16_t)(seq + 1));
+
+    // Wrap of seq: power cycles around 65535.
+    for(n = (uint32_t)seq + 2; n < 65530UL; n++) record(n * 7);
+    for(; n < 65550UL; n++)
+    {
+        record(n * 7);
+        CHECK_EQ(restart(&value), (uint16_t)n);
+        CHECK_EQ(value, n * 7);
+    }
+    CHECK(eelog_readOld(EELOG_SLOTS - 1, &value, sizeof(value)));
+    CHECK_EQ(value, (n - EELOG_SLOTS) * 7);
+    spread(&low, &high);
+    printf("  seq wrap: newest %u after %lu records, %lu..%lu writes per cell\n",
+           (unsigned)eelog_getSeq(), (unsigned long)n, (unsigned long)low, (unsigned long)high);
+
+    return check_end("eelog_wear");
+}
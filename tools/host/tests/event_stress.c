@@ -0,0 +1,156 @@
+/* ****************************************************************************
+ * Project: Control Functions        File event_stress.c (host test) October/2026
+ * ****************************************************************************
+ * File description: Queue of event.c (common) with a real preemption: the
+ *                   producer is a SIGALRM handler (setitimer, every 50 us)
+ *                   that posts bursts of numbered events, as an interrupt
+ *                   would; the main loop takes them with event_get() and can
+ *                   be stopped anywhere, in the middle of event_get() too.
+ *                     - order: the numbers come out increasing, each once;
+ *                     - no loss below capacity: a post never fails while the
+ *                       queue has room (main loop keeping up, 4000 bursts);
+ *                     - overflow (main loop slower than the producer): the
+ *                       events lost are exactly the posts that returned 0,
+ *                       counted by event_drops(), and no other is missing.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ * 10/19/2026| Antonio Castilho  | Events of a signal after the last consume() taken,
+ *           |                   | event_drops() compared in 16 bits
+ ******************************************************************************/
+
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+#include <xc.h>
+#include "event.h"
+#include "check.h"
+
+#define SIZE        8
+#define CAPACITY    (SIZE - 1)
+#define MAX_EVENTS  200000UL
+
+EVENT_QUEUE(queue, SIZE);
+
+// Producer (handler) side.
+static volatile uint32_t posted;            // Numbers given, lost ones too.
+static volatile uint32_t interrupts;
+static volatile uint32_t failed_with_room;  // Post failed, queue not full.
+static volatile uint32_t rejected;          // Posts that returned 0.
+static volatile uint8_t burst_max = 3;
+static volatile uint8_t in_get;             // Main loop inside event_get().
+static volatile uint32_t get_preempted;
+static uint8_t lost[MAX_EVENTS];            // Numbers of the posts that returned 0.
+static uint32_t seed = 1;
+
+static void producer(int sig)
+{
+    uint8_t n, room;
+    uint32_t s;
+
+    (void)sig;
+    interrupts++;
+    if(in_get) get_preempted++;
+    seed = seed * 1103515245UL + 12345UL;
+    n = (uint8_t)(1 + (seed >> 16) % burst_max);
+    while(n-- && posted < MAX_EVENTS)
+    {
+        s = posted++;
+        room = (uint8_t)(event_count(&queue) < CAPACITY); // Stale only towards full.
+        if(event_post(&queue, (uint8_t)(EVENT_USER | (s >> 24)), (uint8_t)s, (uint16_t)(s >> 8)))
+            continue;
+        lost[s] = 1;
+        rejected++;
+        if(room) failed_with_room++;
+    }
+}
+
+static void timer_on(long us)
+{
+    struct itimerval t;
+
+    memset(&t, 0, sizeof(t));
+    t.it_interval.tv_usec = us;
+    t.it_value.tv_usec = us;
+    setitimer(ITIMER_REAL, &t, NULL);
+}
+
+/* Takes events until the handler has run n more times and the queue is empty.
+ * slow: busy time after each event, in loop passes (0: keeps up). */
+static void consume(uint32_t n, uint32_t slow, uint32_t *next, uint32_t *got, uint32_t *bad)
+{
+    uint32_t end = interrupts + n, s, i;
+    volatile uint32_t spin;
+    event_t e;
+    time_t limit = time(NULL) + 20;
+
+    while(interrupts < end || event_count(&queue))
+    {
+        if(time(NULL) > limit) break;
+        in_get = 1;
+        i = event_get(&queue, &e);
+        in_get = 0;
+        if(!i) continue;
+        s = ((uint32_t)(e.type & 0x7F) << 24) | ((uint32_t)e.data << 8) | e.arg;
+        // Numbers skipped must be the posts that failed, in order.
+        for(; *next < s; (*next)++) if(!lost[*next]) (*bad)++;
+        if(s != *next) (*bad)++;
+        *next = s + 1;
+        (*got)++;
+        for(spin = 0, i = slow; i; i--) spin++;
+    }
+}
+
+int main(void)
+{
+    struct sigaction sa;
+    uint32_t next = 0, got = 0, bad = 0, drops_before;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = producer;
+    sa.sa_flags = SA_RESTART;
+    sigaction(SIGALRM, &sa, NULL);
+
+    // Keeping up: bursts up to 3, the main loop empties the queue between them.
+    timer_on(50);
+    consume(4000, 0, &next, &got, &bad);
+    timer_on(0);
+    consume(0, 0, &next, &got, &bad);   // Posted by a signal before the timer stopped.
+    printf("  keeping up: %lu interrupts (%lu inside event_get()), %lu events, %lu lost\n",
+           (unsigned long)interrupts, (unsigned long)get_preempted, (unsigned long)got,
+           (unsigned long)rejected);
+    CHECK(interrupts >= 4000);
+    CHECK(get_preempted > 0);
+    CHECK_EQ(failed_with_room, 0);
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(got + rejected, posted);
+    CHECK_EQ(event_drops(&queue), (uint16_t)rejected);   // 16 bits: wraps as on the PIC.
+
+    // Overflow: bursts up to 12, longer than the queue, slow main loop.
+    drops_before = event_drops(&queue);
+    burst_max = 12;
+    timer_on(50);
+    consume(4000, 20000, &next, &got, &bad);
+    timer_on(0);
+    consume(0, 0, &next, &got, &bad);
+    for(; next < posted; next++) if(!lost[next]) bad++;   // Lost after the last one taken.
+    printf("  overflow: %lu interrupts, %lu events posted, %lu taken, %u lost (event_drops)\n",
+           (unsigned long)interrupts, (unsigned long)posted, (unsigned long)got,
+           (unsigned)(uint16_t)(event_drops(&queue) - drops_before));
+    CHECK(event_drops(&queue) - drops_before > 0);
+    CHECK_EQ(failed_with_room, 0);
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(got + rejected, posted);
+    CHECK_EQ(event_drops(&queue), (uint16_t)rejected);
+    CHECK_EQ(event_count(&queue), 0);
+
+    return check_end("event_stress");
+}
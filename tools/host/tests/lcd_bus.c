@@ -0,0 +1,191 @@
+/* ****************************************************************************
+ * Project: Control Functions             File lcd_bus.c (host test) October/2026
+ * ****************************************************************************
+ * File description: Bus of the display of lcd.c (common) on the register
+ *                   model: every change of LATD is traced (host_port_hook)
+ *                   and the display is played back from the trace, reading
+ *                   D4..D7 and RS at each falling edge of E with the pin map
+ *                   of lcd.h. The pins out of the map (RD3) are held high
+ *                   by the program, as another module of the board would.
+ *                     - one latch change per nibble for D4..D7 and RS
+ *                       together (a single masked write), then E up and E
+ *                       down: at most 6 changes a byte;
+ *                     - a change moves either E or the data lines, never
+ *                       both; data and RS stable while E is high; RW always
+ *                       0; no change of a pin out of the map (RD3 kept);
+ *                     - only the pins of the map made outputs (TRISD);
+ *                     - the display reads the start nibbles, the commands
+ *                       and every character code, D7 on RD7 (characters with
+ *                       bit 3 and bit 7 set);
+ *                     - clear (0x01) and home (0x02) wait the 1.52 ms of
+ *                       the display in lcd_com().
+ *                   lcd_bus_remap.c builds it again with a map whose data
+ *                   pins are not contiguous (one OR per bit).
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ * 10/19/2026| Antonio Castilho  | lcd.c of common/
+ * 10/19/2026| Antonio Castilho  | Wait of clear and home
+ ******************************************************************************/
+
+#include <string.h>
+#include <xc.h>
+#include "lcd.h"
+#include "check.h"
+
+#ifndef TEST_REMAP
+    #define TEST_NAME   "lcd_bus"
+#else
+    #define TEST_NAME   "lcd_bus_remap"
+#endif
+
+#define PORT_D      3
+#define RD_OTHER    ((uint8_t)~LCD_BUS_MASK)    // Pins that are not of the display.
+#define RD_HELD     RD_OTHER                    // Held high by the program.
+#define LINES       (LCD_DATA_MASK | LCD_MASK(LCD_PIN_RS) | LCD_MASK(LCD_PIN_RW))
+
+static uint8_t last;            // LATD before the change.
+static uint8_t seen;            // Bits of LATD that changed, any time.
+static uint16_t changes;        // Of LATD.
+static uint16_t line_changes;   // Of the data lines since the last falling edge of E.
+static uint16_t max_line_changes;
+static uint16_t both, while_e, rw_high;
+static uint8_t nibbles[256];    // Read by the display: bit 4 RS, bits 3:0 D7..D4.
+static uint16_t count;
+
+static uint8_t nibble_of(uint8_t lat)
+{
+    return (uint8_t)(((lat & LCD_MASK(LCD_PIN_D4)) ? 0x01 : 0)
+                     | ((lat & LCD_MASK(LCD_PIN_D5)) ? 0x02 : 0)
+                     | ((lat & LCD_MASK(LCD_PIN_D6)) ? 0x04 : 0)
+                     | ((lat & LCD_MASK(LCD_PIN_D7)) ? 0x08 : 0)
+                     | ((lat & LCD_MASK(LCD_PIN_RS)) ? 0x10 : 0));
+}
+
+static void traced(uint8_t port, uint8_t value)
+{
+    uint8_t diff;
+
+    if(port != PORT_D) return;
+    diff = (uint8_t)(value ^ last);
+    changes++;
+    seen |= diff;
+    if((diff & LCD_E_MASK) && (diff & LINES)) both++;
+    if((last & LCD_E_MASK) && (diff & LINES)) while_e++;
+    if(value & LCD_MASK(LCD_PIN_RW)) rw_high++;
+    if(diff & LINES) line_changes++;
+    if((diff & LCD_E_MASK) && !(value & LCD_E_MASK))  // Falling edge: the display reads.
+    {
+        if(count < sizeof(nibbles)) nibbles[count++] = nibble_of(value);
+        if(line_changes > max_line_changes) max_line_changes = line_changes;
+        line_changes = 0;
+    }
+    last = value;
+}
+
+// Bytes read by the display from nibble n on (RS in bit 8).
+static uint16_t byte_at(uint16_t n)
+{
+    return (uint16_t)(((nibbles[n] & 0x10) << 4) | ((nibbles[n] & 0x0F) << 4)
+                      | (nibbles[n + 1] & 0x0F));
+}
+
+// The model applies an access at the next one: the last write of LATD, now.
+static void settle(void)
+{
+    host_cycles(0);
+}
+
+static void restart(void)
+{
+    settle();
+    count = 0;
+    changes = 0;
+    max_line_changes = 0;
+}
+
+int main(void)
+{
+    static const uint8_t text[] = "H8\xDF" "x";     // Bit 3 of each nibble, bit 7.
+    uint16_t i, n, start, wanted;
+    uint32_t t0;
+
+    host_reset();
+    LATD = RD_HELD;
+    last = LATD;
+    host_port_hook = traced;
+
+    lcd_ini();
+    settle();
+    printf("  lcd_ini(): %u nibbles, %u changes of LATD\n", (unsigned)count, (unsigned)changes);
+    CHECK_EQ(TRISD & LCD_BUS_MASK, 0);
+    CHECK_EQ(TRISD & RD_OTHER, RD_OTHER);
+    CHECK_EQ(LATD & RD_OTHER, RD_HELD);
+    // HD44780 4-bit start: 3, 3, 3, 2 alone, then bytes (function set first).
+    CHECK(count >= 6 && (count - 4) % 2 == 0);
+    CHECK_EQ(nibbles[0], 0x03);
+    CHECK_EQ(nibbles[1], 0x03);
+    CHECK_EQ(nibbles[2], 0x03);
+    CHECK_EQ(nibbles[3], 0x02);
+    CHECK_EQ(byte_at(4) & 0x1F0, 0x020);    // Function set, 4 bits, RS = 0.
+
+    restart();
+    lcd_prtStr(2, 3, text);
+    settle();
+    n = (uint16_t)strlen((const char *)text);
+    CHECK_EQ(count, 2 * (n + 1));
+    CHECK_EQ(byte_at(0), 0x80 | 0x43);      // Set DDRAM address, row 2 column 3.
+    for(i = 0; i < n; i++) CHECK_EQ(byte_at((uint16_t)(2 + 2 * i)), 0x100 | text[i]);
+    CHECK(changes <= 6 * (n + 1));
+    printf("  lcd_prtStr(): %u bytes, %u changes of LATD (%.1f a byte)\n",
+           (unsigned)(n + 1), (unsigned)changes, changes / (double)(n + 1));
+
+    // Every character code: the nibbles on D4..D7 as sent.
+    for(start = 0; start < 256; start += 32)
+    {
+        restart();
+        lcd_goto(1, 0);
+        for(i = 0; i < 32 && start + i < 256; i++)
+        {
+            if(i % 16 == 0 && i) lcd_goto(2, 0);
+            lcd_prtChar((uint8_t)(start + i));
+        }
+        settle();
+        for(i = 0, n = 2; i < 32; i++, n += 2)
+        {
+            if(i % 16 == 0 && i) n += 2;
+            wanted = (uint16_t)(0x100 | (start + i));
+            if(byte_at(n) != wanted) CHECK_EQ(byte_at(n), wanted);
+        }
+    }
+
+    // Clear and home: 1.52 ms (HD44780U) before anything else is sent.
+    for(i = 0x01; i <= 0x02; i++)
+    {
+        settle();
+        t0 = host_cycle_count();
+        lcd_com((uint8_t)i);
+        settle();
+        CHECK(host_cycle_count() - t0 >= (uint32_t)(1520ULL * (_XTAL_FREQ / 4) / 1000000));
+    }
+
+    CHECK_EQ(both, 0);
+    CHECK_EQ(while_e, 0);
+    CHECK_EQ(rw_high, 0);
+    CHECK_EQ(max_line_changes, 1);          // One write of the lines per nibble.
+    CHECK_EQ(seen & RD_OTHER, 0);           // RD3 never touched.
+#ifndef TEST_REMAP
+    CHECK_EQ(LCD_MASK(LCD_PIN_D7), 0x80);   // D7 on RD7 (was RD4 in the board maps).
+    CHECK_EQ(LCD_DATA_MASK, 0xF0);
+#endif
+    CHECK_EQ(LATD & RD_OTHER, RD_HELD);
+
+    return check_end(TEST_NAME);
+}
@@ -0,0 +1,20 @@
+/* ****************************************************************************
+ * Project: Control Functions       File lcd_bus_remap.c (host test) October/2026
+ * ****************************************************************************
+ * File description: lcd_bus.c with another pin map (Makefile, lcd_bus_remap_DEFS):
+ *                   RS RD0, RW RD1, E RD2, D4 RD3, D5..D7 RD5..RD7, RD4 free.
+ *                   The data pins are not contiguous, so lcd.c puts each bit
+ *                   of the nibble by itself; still one write of the latch.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#include "lcd_bus.c"
@@ -0,0 +1,152 @@
+/* ****************************************************************************
+ * Project: Control Functions             File lcd_i2c.c (host test) October/2026
+ * ****************************************************************************
+ * File description: I2C backpack of lcd.c (common) on the register model,
+ *                   built with LCD_BUS = LCD_BUS_I2C. The bytes of the MSSP
+ *                   are traced (host_spi_hook): the address 0x4E after each
+ *                   START, then the outputs P0..P7 of the PCF8574, read as the
+ *                   display would (D4..D7 and RS at each falling edge of E).
+ *                     - lcd_ini() with the interrupts off, the queue sent by
+ *                       calls of lcd_isr() as isr_low would make: the start
+ *                       nibbles 3, 3, 3, 2 and the function set arrive;
+ *                     - with the SSP interrupt served by the model
+ *                       (host_isr_hook, SSPIP set here to be dispatched),
+ *                       every character code 0..255 written with the queue
+ *                       going round many times, full while the program
+ *                       writes (wait of lcd_i2cPut()): each one read by the
+ *                       display once and in order, none lost or doubled;
+ *                     - P3 (backlight) always 1, RW always 0, the address
+ *                       written to the backpack only.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#include <xc.h>
+#include "lcd.h"
+#include "check.h"
+
+#define ADDRESS     ((uint8_t)(LCD_I2C_ADDR << 1))  // Write: R/W = 0.
+
+static uint8_t last = LCD_BL_MASK;  // Outputs of the PCF8574.
+static uint16_t writes;             // Addresses sent: one per START.
+static uint32_t bytes;              // Outputs sent.
+static uint16_t bl_low, rw_high;
+static uint16_t nibbles[1200];      // Read by the display: bit 4 RS, bits 3:0 D7..D4.
+static uint16_t count;
+
+static uint8_t nibble_of(uint8_t out)
+{
+    return (uint8_t)(((out & LCD_MASK(LCD_PIN_D4)) ? 0x01 : 0)
+                     | ((out & LCD_MASK(LCD_PIN_D5)) ? 0x02 : 0)
+                     | ((out & LCD_MASK(LCD_PIN_D6)) ? 0x04 : 0)
+                     | ((out & LCD_MASK(LCD_PIN_D7)) ? 0x08 : 0)
+                     | ((out & LCD_MASK(LCD_PIN_RS)) ? 0x10 : 0));
+}
+
+// RW is never 1 in the outputs, so 0x4E is the address and nothing else.
+static uint8_t traced(uint8_t byte)
+{
+    if(byte == ADDRESS)
+    {
+        writes++;
+        return 0;
+    }
+    bytes++;
+    if(!(byte & LCD_BL_MASK)) bl_low++;
+    if(byte & LCD_MASK(LCD_PIN_RW)) rw_high++;
+    if((last & LCD_E_MASK) && !(byte & LCD_E_MASK) && count < sizeof(nibbles) / sizeof(nibbles[0]))
+        nibbles[count++] = nibble_of(byte);
+    last = byte;
+    return 0;
+}
+
+static uint16_t byte_at(uint16_t n)
+{
+    return (uint16_t)(((nibbles[n] & 0x10) << 4) | ((nibbles[n] & 0x0F) << 4)
+                      | (nibbles[n + 1] & 0x0F));
+}
+
+// The rest of the queue, sent by the interrupt while the program polls.
+static void drain(void)
+{
+    uint32_t before;
+
+    do
+    {
+        before = bytes + writes;
+        host_cycles(LCD_I2C_BYTE_US * (_XTAL_FREQ / 4000000UL));
+        (void)PORTB;
+        (void)PORTB;
+    } while(bytes + writes != before);
+}
+
+int main(void)
+{
+    uint16_t i, n, start;
+
+    host_reset();
+    host_spi_hook = traced;
+
+    // Interrupts off: the queue sent after lcd_ini(), as isr_low would.
+    lcd_ini();
+    while(PIR1bits.SSPIF) lcd_isr();
+    printf("  lcd_ini(): %lu bytes in %u writes, %u nibbles\n",
+           (unsigned long)bytes, (unsigned)writes, (unsigned)count);
+    CHECK(writes >= 1);
+    CHECK(count >= 6);
+    CHECK_EQ(nibbles[0], 0x03);
+    CHECK_EQ(nibbles[1], 0x03);
+    CHECK_EQ(nibbles[2], 0x03);
+    CHECK_EQ(nibbles[3], 0x02);
+    CHECK_EQ(byte_at(4) & 0x1F0, 0x020);    // Function set, 4 bits, RS = 0.
+
+    // SSP interrupt served by the model between the accesses of the program.
+    host_isr_hook = lcd_isr;
+    IPR1bits.SSPIP = 1;
+    RCONbits.IPEN = 1;
+    INTCONbits.GIEH = 1;
+    count = 0;
+    writes = 0;
+    for(start = 0; start < 256; start += 32)
+    {
+        lcd_goto(1, 0);
+        for(i = 0; i < 32; i++)
+        {
+            if(i == 16) lcd_goto(2, 0);
+            lcd_prtChar((uint8_t)(start + i));
+        }
+    }
+    drain();
+    printf("  256 characters: %u nibbles in %u writes, %lu bytes in all\n",
+           (unsigned)count, (unsigned)writes, (unsigned long)bytes);
+    CHECK_EQ(count, 2 * (256 + 16));        // 2 addresses and 32 characters each time.
+    for(start = 0, n = 0; start < 256; start += 32)
+    {
+        CHECK_EQ(byte_at(n), 0x80 | 0x00);  // Row 1.
+        n += 2;
+        for(i = 0; i < 32; i++, n += 2)
+        {
+            if(i == 16)
+            {
+                CHECK_EQ(byte_at(n), 0x80 | 0x40);  // Row 2.
+                n += 2;
+            }
+            if(byte_at(n) != (0x100 | (start + i))) CHECK_EQ(byte_at(n), 0x100 | (start + i));
+        }
+    }
+    CHECK(writes >= 1);
+    CHECK(bytes > 4 * LCD_I2C_QUEUE);       // The queue went round.
+    CHECK_EQ(PIE1bits.SSPIE, 1);
+    CHECK_EQ(bl_low, 0);
+    CHECK_EQ(rw_high, 0);
+
+    return check_end("lcd_i2c");
+}
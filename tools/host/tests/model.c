@@ -0,0 +1,173 @@
+/* ****************************************************************************
+ * Project: Control Functions             File model.c (host test)   October/2026
+ * ****************************************************************************
+ * File description: Unit test of the register model (pic18f4550_sim.c): the
+ *                   timers count instruction cycles with their prescalers,
+ *                   RD16 reads, TMR2 period and postscaler, A/D GO/DONE, MSSP
+ *                   in SPI, EUSART, data EEPROM, the port hooks and the
+ *                   dispatch of the high priority interrupt (host_isr_hook).
+ *                   The other tests rely on these behaviours.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ * 10/19/2026| Antonio Castilho  | host_isr_hook
+ ******************************************************************************/
+
+#include <xc.h>
+#include "check.h"
+
+static uint8_t latd;
+static uint8_t uart_last;
+
+static void port_hook(uint8_t port, uint8_t value) { if(port == 3) latd = value; }
+static uint8_t pin_hook(uint8_t port) { return (uint8_t)(port == 1 ? 0xA5 : 0xFF); }
+static uint16_t adc_hook(uint8_t channel) { return (uint16_t)(100 + channel); }
+static uint8_t spi_hook(uint8_t mosi) { return (uint8_t)~mosi; }
+static void uart_hook(uint8_t byte) { uart_last = byte; }
+
+static uint16_t isr_calls;
+static uint8_t isr_gieh;
+static void isr_high(void)
+{
+    isr_calls++;
+    isr_gieh = INTCONbits.GIEH;
+    PIR1bits.TMR1IF = 0;
+}
+
+int main(void)
+{
+    uint16_t t;
+
+    host_reset();
+
+    // Timer0, 16 bits, no prescaler: one count per cycle. Pg 125.
+    T0CON = 0x88;
+    host_cycles(1000);
+    t = TMR0L;
+    t = (uint16_t)(t | (TMR0H << 8));
+    CHECK(t >= 1000 && t <= 1003);
+
+    // Timer1 1:8, RD16: TMR1H is the high byte latched by the read of TMR1L. Pg 131.
+    T1CON = 0xB1;
+    host_cycles(8u * 0x1234);
+    t = TMR1L;
+    t = (uint16_t)(t | (TMR1H << 8));
+    CHECK(t >= 0x1234 && t <= 0x1236);
+
+    // 16-bit write: TMR1H then TMR1L. Overflow sets TMR1IF.
+    T1CON = 0x81;
+    TMR1H = 0xFF;
+    TMR1L = 0xF0;
+    PIR1bits.TMR1IF = 0;
+    host_cycles(32);
+    CHECK(PIR1bits.TMR1IF);
+
+    // Timer2: period PR2 + 1, postscaler 1:2. Pg 137.
+    PR2 = 99;
+    TMR2 = 0;
+    PIR1bits.TMR2IF = 0;
+    T2CON = 0x0C;
+    host_cycles(150);
+    CHECK(!PIR1bits.TMR2IF);
+    host_cycles(60);
+    CHECK(PIR1bits.TMR2IF);
+    T2CON = 0;
+
+    // A/D: GO clears at the next access with the value of the hook, right justified.
+    host_adc_hook = adc_hook;
+    ADCON2 = 0x80;
+    ADCON0 = (uint8_t)((3 << 2) | 0x01);
+    ADCON0bits.GO = 1;
+    while(ADCON0bits.GO_DONE);
+    CHECK_EQ((ADRESH << 8) | ADRESL, 103);
+
+    // MSSP in SPI master: the byte of the hook comes back in SSPBUF, BF and SSPIF.
+    host_spi_hook = spi_hook;
+    SSPCON1 = 0x20;
+    PIR1bits.SSPIF = 0;
+    SSPBUF = 0x3C;
+    while(!SSPSTATbits.BF);
+    CHECK(PIR1bits.SSPIF);
+    CHECK_EQ(SSPBUF, 0xC3);
+
+    // EUSART: TXREG goes to the hook.
+    host_uart_hook = uart_hook;
+    TXSTA = 0x24;
+    TXREG = 'A';
+    (void)PORTA;
+    CHECK_EQ(uart_last, 'A');
+
+    // Data EEPROM: WREN + WR writes the cell and counts it, RD reads it. Pg 83.
+    EEADR = 0x10;
+    EEDATA = 0x5A;
+    EECON1 = 0x04;
+    EECON1bits.WR = 1;
+    (void)PORTA;
+    CHECK_EQ(host_eeprom[0x10], 0x5A);
+    CHECK_EQ(host_eeprom_writes[0x10], 1);
+    CHECK(PIR2bits.EEIF);
+    host_eeprom[0x11] = 0x77;
+    EEADR = 0x11;
+    EECON1bits.RD = 1;
+    CHECK_EQ(EEDATA, 0x77);
+
+    // Ports: LATD changes reach the hook, PORTB inputs come from the pin hook.
+    host_port_hook = port_hook;
+    host_pin_hook = pin_hook;
+    TRISD = 0;
+    LATD = 0x81;
+    (void)PORTA;
+    CHECK_EQ(latd, 0x81);
+    TRISB = 0xFF;
+    (void)PORTA;
+    CHECK_EQ(PORTB, 0xA5);
+
+    // SLEEP returns when an enabled flag is set: Timer1 overflow.
+    PIE1bits.TMR1IE = 1;
+    PIR1bits.TMR1IF = 0;
+    TMR1H = 0xFF;
+    TMR1L = 0x00;
+    SLEEP();
+    CHECK(PIR1bits.TMR1IF);
+    CHECK_EQ(host_sleep_count(), 1);
+
+    // High priority interrupt: served before the next access, with GIEH = 0;
+    // not for a flag of low priority, nor with GIEH = 0.
+    host_isr_hook = isr_high;
+    RCONbits.IPEN = 1;
+    IPR1bits.TMR1IP = 1;
+    PIR1bits.TMR1IF = 0;                // Set by the SLEEP above.
+    INTCONbits.GIEH = 1;
+    (void)PORTA;
+    CHECK_EQ(isr_calls, 0);
+    PIR1bits.TMR1IF = 1;
+    (void)PORTA;
+    CHECK_EQ(isr_calls, 1);
+    CHECK_EQ(isr_gieh, 0);
+    CHECK_EQ(INTCONbits.GIEH, 1);
+    CHECK_EQ(PIR1bits.TMR1IF, 0);
+    IPR1bits.TMR1IP = 0;
+    PIR1bits.TMR1IF = 1;
+    (void)PORTA;
+    CHECK_EQ(isr_calls, 1);
+    INTCONbits.GIEH = 0;
+    IPR1bits.TMR1IP = 1;
+    (void)PORTA;
+    CHECK_EQ(isr_calls, 1);
+    INTCONbits.GIEH = 1;
+    (void)PORTA;
+    CHECK_EQ(isr_calls, 2);
+    host_isr_hook = NULL;
+
+    return check_end("model");
+}
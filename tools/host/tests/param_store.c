@@ -0,0 +1,250 @@
+/* ****************************************************************************
+ * Project: Control Functions          File param_store.c (host test) October/2026
+ * ****************************************************************************
+ * File description: Parameters of param.c (common), with the list of
+ *                   param_store/param.h, on the data EEPROM of the register
+ *                   model. A power loss is param_ini() again on the EEPROM as
+ *                   it was left (no host_reset()).
+ *                     - ranges: a value outside the limits or an unknown id
+ *                       refused, the value kept, no callback;
+ *                     - callbacks: one call per change, each function once
+ *                       at the start and after the defaults;
+ *                     - save and reload, the two blocks written in turn and
+ *                       nothing outside them, seq going round 255;
+ *                     - CRC: a wrong byte in the newest block gives the block
+ *                       before, in both blocks the defaults;
+ *                     - torn save: a save cut after each byte gives at the
+ *                       next param_ini() the values before or the new ones,
+ *                       never a mix;
+ *                     - worn cell: a byte that does not take gives the save
+ *                       up, counted by param_getErrors(), the values before
+ *                       are kept;
+ *                     - command frames of param_command() and their replies.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#include <string.h>
+#include <xc.h>
+#include "param.h"
+#include "check.h"
+
+#define NO_CELL     0xFFFF
+#define BLOCK1      (PARAM_EE_START + PARAM_EE_SIZE)
+
+static uint16_t changedA, changedB;
+static uint16_t worn = NO_CELL;     // Cell whose writes do not take.
+static uint8_t worn_old;
+
+void store_changedA(void) { changedA++; }
+void store_changedB(void) { changedB++; }
+
+// Calls of param_task() until the save ends, or n of them; bytes written.
+static uint16_t run(uint16_t n)
+{
+    uint32_t before = 0, after = 0;
+    uint16_t i;
+
+    for(i = 0; i < 256; i++) before += host_eeprom_writes[i];
+    while(param_isSaving() && n--)
+    {
+        param_task();
+        host_cycles(0);
+        if(worn != NO_CELL) host_eeprom[worn] = worn_old;
+    }
+    for(i = 0; i < 256; i++) after += host_eeprom_writes[i];
+    return (uint16_t)(after - before);
+}
+
+static void set4(int32_t beta, int32_t r0, int32_t offset, int32_t samples)
+{
+    CHECK_EQ(param_set(PARAM_BETA, beta), PARAM_OK);
+    CHECK_EQ(param_set(PARAM_R0, r0), PARAM_OK);
+    CHECK_EQ(param_set(PARAM_OFFSET, offset), PARAM_OK);
+    CHECK_EQ(param_set(PARAM_SAMPLES, samples), PARAM_OK);
+}
+
+static uint8_t equal4(int32_t beta, int32_t r0, int32_t offset, int32_t samples)
+{
+    return (uint8_t)(param_get(PARAM_BETA) == beta && param_get(PARAM_R0) == r0
+                     && param_get(PARAM_OFFSET) == offset && param_get(PARAM_SAMPLES) == samples);
+}
+
+static void save(void)
+{
+    CHECK(param_save());
+    CHECK(!param_save());       // Busy with this one.
+    run(1000);
+    CHECK(!param_isSaving());
+}
+
+static void command(const uint8_t *frame, uint8_t length, uint8_t status, uint8_t id,
+                    int32_t value, uint8_t type)
+{
+    uint8_t reply[PARAM_REPLY_LENGTH];
+
+    memset(reply, 0xAA, sizeof(reply));
+    CHECK_EQ(param_command(frame, length, reply), PARAM_REPLY_LENGTH);
+    CHECK_EQ(reply[0], status);
+    CHECK_EQ(reply[1], id);
+    CHECK_EQ((int32_t)(reply[2] | (reply[3] << 8) | (reply[4] << 16) | ((uint32_t)reply[5] << 24)), value);
+    CHECK_EQ(reply[6], type);
+}
+
+int main(void)
+{
+    static const uint8_t get_beta[] = { PARAM_CMD_GET, PARAM_BETA };
+    static const uint8_t set_offset[] = { PARAM_CMD_SET, PARAM_OFFSET, 0x9C, 0xFF, 0xFF, 0xFF }; // -100.
+    static const uint8_t set_high[] = { PARAM_CMD_SET, PARAM_OFFSET, 0xF5, 0x01, 0x00, 0x00 };   // 501.
+    static const uint8_t set_short[] = { PARAM_CMD_SET, PARAM_OFFSET, 0x00, 0x00, 0x00 };
+    static const uint8_t get_bad[] = { PARAM_CMD_GET, PARAM_N };
+    static const uint8_t save_cmd[] = { PARAM_CMD_SAVE };
+    static const uint8_t defaults_cmd[] = { PARAM_CMD_DEFAULTS };
+    static const uint8_t unknown[] = { 'X', 0 };
+    uint8_t image[256];
+    uint16_t i, cut, total, cell, old_ok, new_ok, mixed;
+
+    host_reset();
+
+    // Erased EEPROM: the defaults, each callback once.
+    param_ini();
+    CHECK(equal4(3600, 2048, -50, 10));
+    CHECK_EQ(changedA, 1);
+    CHECK_EQ(changedB, 1);
+    CHECK_EQ(param_getErrors(), 0);
+
+    // Ranges.
+    changedA = changedB = 0;
+    CHECK_EQ(param_set(PARAM_BETA, 999), PARAM_ERROR_RANGE);
+    CHECK_EQ(param_set(PARAM_BETA, 10001), PARAM_ERROR_RANGE);
+    CHECK_EQ(param_set(PARAM_OFFSET, -501), PARAM_ERROR_RANGE);
+    CHECK_EQ(param_set(PARAM_N, 1), PARAM_ERROR_ID);
+    CHECK_EQ(param_get(PARAM_N), 0);
+    CHECK(equal4(3600, 2048, -50, 10));
+    CHECK_EQ(changedA + changedB, 0);
+    CHECK_EQ(param_set(PARAM_BETA, 10000), PARAM_OK);
+    CHECK_EQ(param_set(PARAM_OFFSET, -500), PARAM_OK);
+    CHECK_EQ(param_set(PARAM_SAMPLES, 1), PARAM_OK);     // No callback.
+    CHECK_EQ(changedA, 1);
+    CHECK_EQ(changedB, 1);
+    CHECK_EQ(param_set(PARAM_BETA, 10000), PARAM_OK);    // Same value: no call.
+    CHECK_EQ(changedA, 1);
+    param_defaults();
+    CHECK(equal4(3600, 2048, -50, 10));
+    CHECK_EQ(changedA, 2);
+    CHECK_EQ(changedB, 2);
+
+    // Save and reload: the blocks in turn, nothing outside them.
+    set4(3950, 10000, 25, 16);
+    save();
+    for(i = 0; i < 256; i++)
+        if(i < PARAM_EE_START || i >= PARAM_EE_START + 2 * PARAM_EE_SIZE) CHECK_EQ(host_eeprom_writes[i], 0);
+    CHECK_EQ(host_eeprom_writes[PARAM_EE_START], 0);     // The first save in block 1.
+    CHECK_EQ(host_eeprom_writes[BLOCK1], 1);
+    param_defaults();
+    param_ini();
+    CHECK(equal4(3950, 10000, 25, 16));
+    set4(4000, 10000, 25, 16);
+    save();
+    CHECK_EQ(host_eeprom_writes[PARAM_EE_START], 1);     // Then block 0.
+    param_ini();
+    CHECK(equal4(4000, 10000, 25, 16));
+    for(i = 0; i < 300; i++)                             // seq round 255.
+    {
+        CHECK_EQ(param_set(PARAM_BETA, 1000 + i), PARAM_OK);
+        save();
+        if(i % 37 == 0) param_ini();
+    }
+    param_ini();
+    CHECK(equal4(1000 + 299, 10000, 25, 16));
+    CHECK_EQ(host_eeprom_writes[PARAM_EE_START + 2], host_eeprom_writes[BLOCK1 + 2]); // seq.
+    CHECK_EQ(param_getErrors(), 0);
+
+    // CRC: the newest block wrong, then both.
+    set4(2000, 500, -7, 3);
+    save();                                              // Block 1: 2000; block 0: 1299.
+    param_ini();
+    CHECK(equal4(2000, 500, -7, 3));
+    for(cell = 0; cell < PARAM_EE_SIZE; cell++)
+    {
+        memcpy(image, host_eeprom, sizeof(image));
+        host_eeprom[BLOCK1 + cell] ^= 0x01;
+        param_ini();
+        if(!equal4(1299, 10000, 25, 16)) CHECK(equal4(1299, 10000, 25, 16));
+        host_eeprom[PARAM_EE_START + cell] ^= 0x10;
+        param_ini();
+        if(!equal4(3600, 2048, -50, 10)) CHECK(equal4(3600, 2048, -50, 10));
+        memcpy(host_eeprom, image, sizeof(image));
+    }
+    param_ini();
+    CHECK(equal4(2000, 500, -7, 3));
+
+    // Torn save: cut after each byte written.
+    memcpy(image, host_eeprom, sizeof(image));
+    set4(9999, 777777, 499, 64);
+    CHECK(param_save());
+    total = run(1000);
+    memcpy(host_eeprom, image, sizeof(image));
+    old_ok = new_ok = mixed = 0;
+    for(cut = 0; cut <= total; cut++)
+    {
+        param_ini();
+        set4(9999, 777777, 499, 64);
+        CHECK(param_save());
+        run(cut);
+        param_ini();                                     // Power back.
+        if(equal4(2000, 500, -7, 3)) old_ok++;
+        else if(equal4(9999, 777777, 499, 64)) new_ok++;
+        else mixed++;
+        memcpy(host_eeprom, image, sizeof(image));
+    }
+    printf("  torn save: %u bytes, old values %u times, new %u, mixed %u\n",
+           (unsigned)total, (unsigned)old_ok, (unsigned)new_ok, (unsigned)mixed);
+    CHECK(total >= 5);
+    CHECK_EQ(mixed, 0);
+    CHECK_EQ(new_ok, 1);                                 // Only when it was whole.
+    CHECK_EQ(old_ok, total);
+
+    // Worn cell: the save given up and counted.
+    param_ini();
+    set4(1111, 2222, 333, 44);
+    CHECK(param_save());
+    worn = PARAM_EE_START + 3;                           // The save goes to block 0; BETA low byte.
+    worn_old = host_eeprom[worn];
+    run(1000);
+    CHECK(!param_isSaving());
+    CHECK_EQ(param_getErrors(), 1);
+    worn = NO_CELL;
+    param_ini();
+    CHECK(equal4(2000, 500, -7, 3));
+    CHECK_EQ(param_getErrors(), 0);
+
+    // Command frames.
+    changedB = 0;
+    command(get_beta, sizeof(get_beta), PARAM_OK, PARAM_BETA, 2000, PARAM_U16);
+    command(set_offset, sizeof(set_offset), PARAM_OK, PARAM_OFFSET, -100, PARAM_I16);
+    CHECK_EQ(param_get(PARAM_OFFSET), -100);
+    CHECK_EQ(changedB, 1);
+    command(set_high, sizeof(set_high), PARAM_ERROR_RANGE, PARAM_OFFSET, -100, PARAM_I16);
+    command(set_short, sizeof(set_short), PARAM_ERROR_OP, PARAM_OFFSET, -100, PARAM_I16);
+    command(get_bad, sizeof(get_bad), PARAM_ERROR_ID, PARAM_N, 0, 0xFF);
+    command(unknown, sizeof(unknown), PARAM_ERROR_OP, 0, 2000, PARAM_U16);
+    command(unknown, 0, PARAM_ERROR_OP, 0, 2000, PARAM_U16);
+    command(save_cmd, sizeof(save_cmd), PARAM_OK, 0, 2000, PARAM_U16);
+    command(save_cmd, sizeof(save_cmd), PARAM_ERROR_BUSY, 0, 2000, PARAM_U16);
+    run(1000);
+    command(defaults_cmd, sizeof(defaults_cmd), PARAM_OK, 0, 3600, PARAM_U16);
+    CHECK(equal4(3600, 2048, -50, 10));
+    param_ini();                                         // The saved ones.
+    CHECK(equal4(2000, 500, -100, 3));
+
+    return check_end("param_store");
+}
@@ -0,0 +1,19 @@
+/* ****************************************************************************
+ * Project: Control Functions             File param.c (host test) October/2026
+ * ****************************************************************************
+ * File description: Parameters of the test param_store.c: the shared one,
+ *     common/param.c, with the list of param.h here.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#include "param.h"
+#include "../../../../common/param.c"
@@ -0,0 +1,37 @@
+/* ****************************************************************************
+ * Project: Control Functions             File param.h (host test) October/2026
+ * ****************************************************************************
+ * File description: Parameters of the test param_store.c: a list with the
+ *     types and callbacks it checks, then the shared one, common/param.h,
+ *     as the param.h of a project.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#ifndef PARAM_PROJECT_H
+#define	PARAM_PROJECT_H
+
+void store_changedA(void);  // In param_store.c, count their calls.
+void store_changedB(void);
+
+#define PARAM_VERSION   3
+
+#define PARAM_LIST(P) \
+    P(BETA,     PARAM_U16, 3600,   1000,   10000,   store_changedA) \
+    P(R0,       PARAM_U32, 2048,   100,    1000000, store_changedA) \
+    P(OFFSET,   PARAM_I16, -50,    -500,   500,     store_changedB) \
+    P(SAMPLES,  PARAM_U8,  10,     1,      64,      0)
+
+#define PARAM_EE_START  0x40
+
+#include "../../../../common/param.h"
+
+#endif	/* PARAM_PROJECT_H */
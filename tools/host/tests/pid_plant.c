@@ -0,0 +1,149 @@
+/* ****************************************************************************
+ * Project: Control Functions           File pid_plant.c (host test) October/2026
+ * ****************************************************************************
+ * File description: pid.c (common, PWM.X) closing the loop of PWM.X
+ *                   control.c on a simulated first-order plant: the PWM
+ *                   through an RC filter (tau = 100 ms, 0 to 5 V) read by the
+ *                   A/D (10 bits << 5), 2 kHz sampling.
+ *                     - step with the gains of control.h: settles within 2 %
+ *                       in 0.6 s, overshoot under 20 %;
+ *                     - the same with the derivative on;
+ *                     - set point out of reach (plant limited to 4 V): the
+ *                       integral stays inside the output limit and the loop
+ *                       leaves the limit at once when the set point comes
+ *                       back;
+ *                     - derivative with the largest measurement steps.
+ *                   Prints the time of one pid_run() on this PC; the cycles
+ *                   on the PIC are BENCH_PID_RUN of Bench.X.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#include <time.h>
+#include <xc.h>
+#include "control.h"
+#include "check.h"
+
+#define TS          (1.0 / 2000)    // Sampling, s.
+#define TAU         0.1             // Plant, s.
+
+static double plant_v;              // Plant output, V.
+static double plant_max = 5.0;
+
+static int16_t adc_q15(double v)
+{
+    int adc = (int)(v / 5.0 * 1023 + 0.5);
+
+    if(adc < 0) adc = 0;
+    if(adc > 1023) adc = 1023;
+    return (int16_t)(adc << 5);
+}
+
+// One sample: measurement, controller, then the plant moves for TS.
+static int16_t step(pid_ctrl_t *pid, int16_t setpoint)
+{
+    int16_t u = pid_run(pid, setpoint, adc_q15(plant_v));
+    double target = u / 32767.0 * 5.0;
+
+    if(target > plant_max) target = plant_max;
+    plant_v += (target - plant_v) * TS / TAU;
+    return u;
+}
+
+/* Step from 0 V to the set point. Returns the first time (s) from which the
+ * output stays within 2 %, or -1; peak is the largest output. */
+static double settle(pid_ctrl_t *pid, int16_t setpoint, double seconds, double *peak)
+{
+    double want = (setpoint >> 5) * 5.0 / 1023;
+    double settled = -1;
+    long n;
+
+    *peak = 0;
+    for(n = 0; n < (long)(seconds / TS); n++)
+    {
+        step(pid, setpoint);
+        if(plant_v > *peak) *peak = plant_v;
+        if(plant_v > want * 0.98 && plant_v < want * 1.02)
+        {
+            if(settled < 0) settled = n * TS;
+        }
+        else
+        {
+            settled = -1;
+        }
+    }
+    return settled;
+}
+
+int main(void)
+{
+    pid_ctrl_t pid;
+    double t, peak;
+    int16_t u, d_before;
+    long n;
+    struct timespec a, b;
+    volatile int16_t sink;
+
+    // Step with the default gains: 3 V.
+    pid_ini(&pid, CONTROL_KP, CONTROL_KI, CONTROL_KD, CONTROL_ALPHA, 0, PID_Q15(1.0));
+    plant_v = 0;
+    t = settle(&pid, 614 << 5, 2.0, &peak);
+    printf("  step 0 -> 3 V: settled (2 %%) at %.3f s, peak %.3f V\n", t, peak);
+    CHECK(t >= 0 && t <= 0.6);
+    CHECK(peak < 3.0 * 1.20);
+
+    // Derivative on.
+    pid_ini(&pid, CONTROL_KP, CONTROL_KI, PID_GAIN(0.5), PID_Q15(0.25), 0, PID_Q15(1.0));
+    plant_v = 0;
+    t = settle(&pid, 614 << 5, 2.0, &peak);
+    printf("  step with kd = 0.5: settled at %.3f s, peak %.3f V\n", t, peak);
+    CHECK(t >= 0 && t <= 0.6);
+    CHECK(peak < 3.0 * 1.20);
+
+    // Set point out of reach: 5 V asked, the plant stops at 4 V.
+    pid_ini(&pid, CONTROL_KP, CONTROL_KI, CONTROL_KD, CONTROL_ALPHA, 0, PID_Q15(1.0));
+    plant_v = 0;
+    plant_max = 4.0;
+    for(n = 0; n < (long)(1.5 / TS); n++) u = step(&pid, 1023 << 5);
+    CHECK_EQ(u, PID_Q15(1.0));
+    CHECK(pid.integral <= (int32_t)PID_Q15(1.0) << (15 - PID_SCALE));
+    u = step(&pid, 205 << 5);   // 1 V: off the limit at the first sample.
+    CHECK(u < PID_Q15(1.0));
+    t = settle(&pid, 205 << 5, 2.0, &peak);
+    printf("  back from saturation to 1 V: settled at %.3f s\n", t);
+    CHECK(t >= 0 && t <= 0.6);
+    plant_max = 5.0;
+
+    // Largest measurement steps: the filtered derivative moves towards the
+    // new value, never past it or the other way.
+    pid_ini(&pid, 0, 0, PID_GAIN(15.0), PID_Q15(0.5), -32768, 32767);
+    pid_reset(&pid, -32768, 0);
+    for(n = 0; n < 8; n++)
+    {
+        d_before = pid.derivative;
+        pid_run(&pid, 0, (n & 1) ? -32768 : 32767);
+        if(n & 1)
+            CHECK(pid.derivative >= d_before);  // pv fell: d = +32767.
+        else
+            CHECK(pid.derivative <= d_before);  // pv rose: d = -32768.
+    }
+
+    // Time of one sample on this PC.
+    pid_ini(&pid, CONTROL_KP, CONTROL_KI, PID_GAIN(0.5), CONTROL_ALPHA, 0, PID_Q15(1.0));
+    clock_gettime(CLOCK_MONOTONIC, &a);
+    for(n = 0; n < 1000000; n++) sink = pid_run(&pid, 614 << 5, (int16_t)(n & 0x7FE0));
+    clock_gettime(CLOCK_MONOTONIC, &b);
+    (void)sink;
+    printf("  pid_run(): %.1f ns per sample on the host (PIC cycles: Bench.X BENCH_PID_RUN)\n",
+           ((b.tv_sec - a.tv_sec) * 1e9 + (b.tv_nsec - a.tv_nsec)) / 1e6);
+
+    return check_end("pid_plant");
+}
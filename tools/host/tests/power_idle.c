@@ -0,0 +1,228 @@
+/* ****************************************************************************
+ * Project: Control Functions          File power_idle.c (host test) October/2026
+ * ****************************************************************************
+ * File description: power.c (TIMER.X) on the register model, 8 MHz, with a
+ *                   main loop and a 1 ms TIMER2 tick as in timer_tester.c.
+ *                   The interrupt that wakes the core is served in
+ *                   host_sleep_hook, as it is when power_idle() sets GIEH
+ *                   again (before asleep is cleared); the ticks that come
+ *                   while the main loop works are served by the loop.
+ *                     - sleep entry: with no work the core rests with GIEH
+ *                       = 0 and IDLEN of the mode, until the next tick;
+ *                     - busy path: busy() runs with GIEH = 0, work pending
+ *                       gives no SLEEP; POWER_RUN never rests; GIEH is
+ *                       given back as it was;
+ *                     - an interrupt flag set during busy() (event posted
+ *                       after the check) wakes the core at once, not a tick
+ *                       later;
+ *                     - time at rest counted by the tick;
+ *                     - WDT health gating: CLRWDT only when every watched
+ *                       task reported since the last power_health(); a task
+ *                       that stops leaves the WDT running; power_wdtReset()
+ *                       from RCON.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#include <xc.h>
+#include "power.h"
+#include "check.h"
+
+#define TICK_CYCLES     2000UL  // 1 ms: PR2 249, 1:1, postscale 1:8.
+#define TASK_TICK       0x01
+#define TASK_MAIN       0x02
+#define TASK_COMMS      0x04
+
+static uint32_t work;           // Events waiting for the main loop.
+static uint32_t work_cycles;    // Length of one event.
+static uint8_t busy_calls, busy_gieh, race;
+static uint8_t sleep_gieh, sleep_idlen;
+static uint32_t sleep_cycles;   // Of the last sleep.
+static uint32_t tick_count;
+static uint8_t comms_stopped;
+
+// TIMER2 interrupt: the tick, one event every 4 ticks.
+static void isr(void)
+{
+    PIR1bits.TMR2IF = 0;
+    power_tick();
+    power_alive(TASK_TICK);
+    if((++tick_count & 3) == 0) work++;
+}
+
+static void woke(uint32_t cycles)
+{
+    sleep_gieh = INTCONbits.GIEH;
+    sleep_idlen = OSCCONbits.IDLEN;
+    sleep_cycles = cycles;
+    if(PIE1bits.TMR2IE && PIR1bits.TMR2IF) isr();
+}
+
+static uint8_t busy(void)
+{
+    busy_calls++;
+    busy_gieh = INTCONbits.GIEH;
+    if(race)
+    {
+        PIR1bits.TMR2IF = 1;    // The tick comes after the check.
+        race = 0;
+    }
+    return (uint8_t)(work != 0);
+}
+
+// Main loop for a time, with a health check every 100 ms.
+static void loop(uint32_t ms)
+{
+    uint32_t end = host_cycle_count() + ms * TICK_CYCLES;
+    uint32_t next_health = tick_count + 100;
+    uint32_t n;
+
+    while(host_cycle_count() < end)
+    {
+        if(INTCONbits.GIEH && PIE1bits.TMR2IE && PIR1bits.TMR2IF) isr();
+        if(work)
+        {
+            for(n = 0; n < work_cycles; n += 100)  // The tick interrupts the work.
+            {
+                host_cycles(100);
+                if(PIE1bits.TMR2IE && PIR1bits.TMR2IF) isr();
+            }
+            work--;
+            power_alive(TASK_MAIN);
+            if(!comms_stopped) power_alive(TASK_COMMS);
+        }
+        if(tick_count >= next_health)
+        {
+            power_health();
+            next_health += 100;
+        }
+        power_idle(busy);
+    }
+}
+
+static void tick_ini(void)
+{
+    PR2 = 249;
+    T2CON = 0x3C;   // 0b00111100 postscale 1:8, on, prescale 1:1.
+    PIR1bits.TMR2IF = 0;
+    PIE1bits.TMR2IE = 1;
+    RCONbits.IPEN = 1;
+    INTCONbits.GIEH = 1;
+}
+
+int main(void)
+{
+    uint16_t sleeps, clears;
+    uint32_t start;
+
+    host_sleep_hook = woke;
+
+    // Power-on reset: not a WDT reset. WDT reset: RCON<TO> = 0, <POR> = 1.
+    host_reset();
+    power_ini(POWER_IDLE);
+    CHECK_EQ(power_wdtReset(), 0);
+    CHECK_EQ(RCONbits.NOT_POR, 1);
+    RCONbits.NOT_TO = 0;
+    power_ini(POWER_IDLE);
+    CHECK_EQ(power_wdtReset(), 1);
+
+    // Sleep entry: no work, the core rests until the tick.
+    host_reset();
+    power_ini(POWER_IDLE);
+    tick_ini();
+    power_idle(busy);
+    CHECK_EQ(host_sleep_count(), 1);
+    CHECK_EQ(power_getSleeps(), 1);
+    CHECK_EQ(sleep_gieh, 0);
+    CHECK_EQ(sleep_idlen, 1);
+    CHECK(sleep_cycles > TICK_CYCLES - 50 && sleep_cycles <= TICK_CYCLES);
+    CHECK_EQ(busy_gieh, 0);
+    CHECK_EQ(INTCONbits.GIEH, 1);
+    CHECK_EQ(power_getAsleep(), 1);     // The tick that woke it found it at rest.
+
+    power_setMode(POWER_SLEEP);
+    power_idle(NULL);                   // No busy(): rests.
+    CHECK_EQ(host_sleep_count(), 2);
+    CHECK_EQ(sleep_idlen, 0);
+    power_setMode(POWER_IDLE);
+
+    // Busy path: work pending, no SLEEP; GIEH back as it was.
+    work = 1;
+    busy_calls = 0;
+    power_idle(busy);
+    CHECK_EQ(host_sleep_count(), 2);
+    CHECK_EQ(busy_calls, 1);
+    CHECK_EQ(busy_gieh, 0);
+    CHECK_EQ(INTCONbits.GIEH, 1);
+    INTCONbits.GIEH = 0;
+    power_idle(busy);
+    CHECK_EQ(INTCONbits.GIEH, 0);
+    INTCONbits.GIEH = 1;
+    power_setMode(POWER_RUN);
+    work = 0;
+    busy_calls = 0;
+    power_idle(busy);
+    CHECK_EQ(busy_calls, 0);
+    CHECK_EQ(host_sleep_count(), 2);
+    power_setMode(POWER_IDLE);
+
+    // Event between the check and SLEEP: the flag wakes the core at once.
+    race = 1;
+    start = tick_count;
+    power_idle(busy);
+    CHECK_EQ(host_sleep_count(), 3);
+    CHECK(sleep_cycles <= 2);
+    CHECK_EQ(tick_count, start + 1);    // Served when GIEH came back.
+
+    // Time at rest: an event of 5000 cycles every 4 ticks, so 2 ticks of 4 find
+    // the main loop working (37.5 % of the time awake, counted as 50 %).
+    host_reset();
+    power_ini(POWER_IDLE);
+    tick_ini();
+    tick_count = 0;
+    work = 0;
+    work_cycles = 5000;
+    power_watch(TASK_TICK | TASK_MAIN | TASK_COMMS);
+    loop(1000);
+    printf("  1000 ms: %lu ticks, %lu at rest (%u %%), %u sleeps, %u CLRWDT\n",
+           (unsigned long)power_getTicks(), (unsigned long)power_getAsleep(),
+           (unsigned)power_getPercent(), (unsigned)power_getSleeps(),
+           (unsigned)host_wdt_clears());
+    CHECK(power_getTicks() >= 999 && power_getTicks() <= 1000);
+    CHECK_EQ(power_getPercent(), 50);
+    CHECK_EQ(power_getSleeps(), host_sleep_count());
+
+    // Health: a CLRWDT every 100 ms while all the tasks report (1 of power_ini()).
+    CHECK(host_wdt_clears() >= 10 && host_wdt_clears() <= 11);
+    sleeps = host_sleep_count();
+    comms_stopped = 1;
+    loop(150);                          // The period in progress may still clear.
+    clears = host_wdt_clears();
+    loop(1000);
+    CHECK_EQ(host_wdt_clears(), clears);
+    CHECK(host_sleep_count() > sleeps);   // The others keep running.
+    comms_stopped = 0;
+    loop(200);
+    CHECK(host_wdt_clears() > clears);
+
+    // Gating by bits: a task outside power_watch() does not count.
+    power_watch(TASK_MAIN | TASK_COMMS);
+    clears = host_wdt_clears();
+    power_alive(TASK_MAIN);
+    power_alive(TASK_TICK);
+    CHECK_EQ(power_health(), 0);
+    power_alive(TASK_COMMS);
+    CHECK_EQ(power_health(), 1);
+    CHECK_EQ(power_health(), 0);        // New period: nobody reported yet.
+    CHECK_EQ(host_wdt_clears(), clears + 1);
+
+    return check_end("power_idle");
+}
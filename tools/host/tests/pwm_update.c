@@ -0,0 +1,166 @@
+/* ****************************************************************************
+ * Project: Control Functions          File pwm_update.c (host test) October/2026
+ * ****************************************************************************
+ * File description: Frequency changes of pwm.c (common) with the control tick
+ *                   on (pwm_setTick(), TIMER2 postscaler): every period runs
+ *                   with a duty and a PR2 of the same setting (50 % duty, no
+ *                   period with the old duty and the new PR2 or the other
+ *                   way round), and the ticks stay exactly "postscale"
+ *                   periods apart across the change. A full-bridge
+ *                   direction change switches P1M in a period with duty 0
+ *                   and keeps the tick; the dead band is whole Tcy, rounded
+ *                   up (0.5 us is 1 Tcy at 8 MHz).
+ *                   The test polls TMR2 for the end of each period and calls
+ *                   pwm_isr() when TMR2IF is set, as the interrupt would.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ * 10/19/2026| Antonio Castilho  | Dead band of the half-bridge
+ ******************************************************************************/
+
+#include <xc.h>
+#include "pwm.h"
+#include "check.h"
+
+static const uint8_t t2_prescale[4] = {1, 4, 16, 16};
+
+static uint32_t periods;        // Periods ended.
+static uint32_t tick_period;    // periods at the last tick.
+static uint32_t ticks;
+static uint8_t tick_gap;        // Expected periods between ticks, 0: not checked.
+static uint32_t wrap_cycle;
+static uint8_t duty_latched;    // CCPR1H of the running period.
+static uint8_t tmr2_prev;
+static uint32_t bad_duty, bad_gap;
+static uint8_t p1m_last;
+static uint32_t zero_periods;   // Periods with duty 0 (direction change).
+static uint32_t p1m_switches, bad_switches;
+
+/* One period has ended: the duty latched at its start is half of the PR2 it
+ * ended with (50 %), and its length is PR2 + 1 steps of its prescaler (a few
+ * cycles off when the interrupt changed the prescaler at its start). */
+static void period_end(void)
+{
+    uint32_t now = host_cycle_count();
+    uint32_t len = now - wrap_cycle;
+    uint16_t steps = (uint16_t)(PR2 + 1);
+    uint32_t want = (uint32_t)steps * t2_prescale[T2CONbits.T2CKPS];
+
+    if(CCP1CONbits.P1M != p1m_last)
+    {
+        p1m_switches++;
+        if(duty_latched != 0) bad_switches++;
+        p1m_last = CCP1CONbits.P1M;
+    }
+    if(duty_latched == 0 && zero_periods < 0xFFFF) zero_periods++;
+    else if(periods > 1 && (duty_latched * 2 + 2 < steps || duty_latched * 2 > steps + 2
+                       || len + 64 < want || len > want + 64))
+    {
+        if(bad_duty++ < 4)
+            printf("  period %lu: %lu cycles (PR2 %u), duty %u\n", (unsigned long)periods,
+                   (unsigned long)len, (unsigned)(steps - 1), (unsigned)duty_latched);
+    }
+    periods++;
+    wrap_cycle = now;
+    duty_latched = CCPR1H;
+}
+
+static void run(uint32_t n)
+{
+    uint32_t end = host_cycle_count() + n;
+    uint8_t t;
+
+    while(host_cycle_count() < end)
+    {
+        if(PIR1bits.TMR2IF && PIE1bits.TMR2IE)
+        {
+            t = TMR2;   // The period that ended before the interrupt.
+            if(t < tmr2_prev) period_end();
+            tmr2_prev = t;
+            if(!pwm_isr()) continue;
+            if(tick_gap && ticks && periods - tick_period != tick_gap)
+            {
+                if(bad_gap++ < 4)
+                    printf("  tick after %lu periods\n", (unsigned long)(periods - tick_period));
+            }
+            ticks++;
+            tick_period = periods;
+        }
+        t = TMR2;
+        if(t < tmr2_prev) period_end();
+        tmr2_prev = t;
+    }
+}
+
+// New frequency, then about one tick at the old one and 50 at the new one.
+static void change(uint32_t frequency, uint8_t postscale)
+{
+    uint32_t before = ticks;
+    uint32_t old = pwm_getFrequency();
+
+    CHECK(pwm_setFrequency(frequency));
+    run(postscale * (_XTAL_FREQ / 4 / old) + 50UL * postscale * (_XTAL_FREQ / 4 / frequency));
+    CHECK_EQ(pwm_getFrequency(), frequency);
+    CHECK(ticks - before >= 30);
+}
+
+int main(void)
+{
+    static const uint8_t postscale[] = {10, 3, 1};
+
+    for(uint8_t i = 0; i < sizeof(postscale); i++)
+    {
+        host_reset();
+        periods = ticks = wrap_cycle = 0;
+        tick_gap = duty_latched = tmr2_prev = 0;
+        pwm_ini();
+        pwm_setTick(postscale[i]);
+        run(20000);
+        tick_gap = postscale[i];
+
+        change(20000, postscale[i]);    // 100 cycles: 1:1, PR2 99.
+        change(10000, postscale[i]);    // 200 cycles: 1:1, PR2 199.
+        change(2000, postscale[i]);     // 1000 cycles: 1:4, PR2 249.
+        change(20000, postscale[i]);
+
+        CHECK_EQ(T2CONbits.TOUTPS, postscale[i] - 1); // Back to the tick postscaler.
+        CHECK_EQ(bad_duty, 0);
+        CHECK_EQ(bad_gap, 0);
+        bad_duty = bad_gap = 0;
+    }
+
+    // Direction change with the tick on.
+    pwm_setTick(10);
+    tick_gap = 0;
+    run(20000);
+    tick_gap = 10;
+    CHECK(pwm_bridge_ini(PWM_BRIDGE_FORWARD));
+    p1m_last = CCP1CONbits.P1M;
+    run(20000);
+    pwm_bridge_setDirection(PWM_BRIDGE_REVERSE);
+    run(20000);
+    CHECK_EQ(CCP1CONbits.P1M, PWM_BRIDGE_REVERSE);
+    CHECK_EQ(p1m_switches, 1);
+    CHECK_EQ(bad_switches, 0);
+    CHECK(zero_periods >= 1);
+    CHECK_EQ(bad_duty, 0);
+    CHECK_EQ(bad_gap, 0);
+
+    // Dead band: Tcy = 500 ns at 8 MHz, never shorter than asked, 127 at most.
+    CHECK_EQ(pwm_bridge_setDeadband(500), 500);
+    CHECK_EQ(ECCP1DEL & 0x7F, 1);
+    CHECK_EQ(pwm_bridge_setDeadband(501), 1000);
+    CHECK_EQ(ECCP1DEL & 0x7F, 2);
+    CHECK_EQ(pwm_bridge_setDeadband(0), 0);
+    CHECK_EQ(pwm_bridge_setDeadband(65000), 127 * 500);
+    CHECK_EQ(ECCP1DEL & 0x7F, 127);
+
+    return check_end("pwm_update");
+}
@@ -0,0 +1,172 @@
+/* ****************************************************************************
+ * Project: Control Functions     File stepper_profile.c (host test) October/2026
+ * ****************************************************************************
+ * File description: Speed profile of the moves of stepper.c (StepperMotor.X)
+ *                   against AVR446, on the register model (TIMER1 1:8, CCP1
+ *                   compare with special event trigger, 8 MHz). The test polls
+ *                   CCP1IF, calls stepper_isr() as the interrupt would and
+ *                   takes the time of each step from the model cycles:
+ *                     - acceleration: step s from rest runs at
+ *                       w = sqrt(2 a s) (AVR446 eq. 11), within 1 %;
+ *                     - AVR446 eq. 16 steps of acceleration, w^2 / (2 a)
+ *                       (counted as the steps more than one TIMER1 count
+ *                       slower than the top speed, within 2 %), or half the
+ *                       move when the top speed is not reached (eq. 19 with
+ *                       equal acceleration and deceleration);
+ *                     - cruise at the top speed, within one TIMER1 count;
+ *                     - deceleration: the same steps as the acceleration, in
+ *                       the reverse order;
+ *                     - the move takes the steps asked and ends at the target
+ *                       (queued and backward moves too), its time within 2 %
+ *                       of the trapezoid for long ramps.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#include <math.h>
+#include <stdlib.h>
+#include <xc.h>
+#include "stepper.h"
+#include "check.h"
+
+#define F           ((double)STEPPER_TICK_HZ)   // TIMER1 counts/s.
+#define CYCLES      8.0                         // Tcy per TIMER1 count.
+
+static double *gaps;        // TIMER1 counts before each step.
+static long steps;
+
+/* Runs the queued moves to the end. Each step is the time from the match
+ * before (from the start for the first one), in TIMER1 counts. */
+static void run(long room)
+{
+    uint32_t last = host_cycle_count();
+    uint32_t now;
+
+    steps = 0;
+    while(stepper_isBusy() && steps < room)
+    {
+        if(!PIR1bits.CCP1IF) continue;
+        now = host_cycle_count();
+        gaps[steps++] = (now - last) / CYCLES;
+        last = now;
+        stepper_isr();
+    }
+    CHECK(!stepper_isBusy());
+}
+
+/* Move of n steps at top speed v and acceleration a, from position 0. */
+static void profile(long n, uint16_t v, uint16_t a)
+{
+    long ramp = (long)((double)v * v / (2.0 * a));   // AVR446 eq. 16.
+    int reached = (ramp <= n / 2);
+    long want, accel, cruise, decel, k, s;
+    double top, w, err, peak = 0, worst = 0, time = 0, ideal;
+
+    if(!reached) ramp = n / 2;                        // Eq. 19, a = d.
+    gaps = malloc(sizeof(double) * (size_t)(n + 1));
+    CHECK(stepper_setPosition(0));
+    stepper_setSpeed(v);
+    CHECK(stepper_setAccel(a));
+    CHECK(stepper_moveTo(n));
+    run(n + 1);
+
+    CHECK_EQ(steps, n);
+    CHECK_EQ(stepper_getPosition(), n);
+
+    /* Phases from the intervals: the ramps are the steps more than one count
+     * longer than the top speed interval, as many as AVR446 gives (2 %). */
+    top = F / v;
+    want = (long)ceil(pow(F / (top + 1.0), 2) / (2.0 * a)) - 1;   // w > F / (top + 1).
+    if(want > ramp) want = ramp;
+    for(accel = 0; accel < steps && gaps[accel] > top + 1.0; accel++) continue;
+    for(decel = 0; decel < steps && gaps[steps - 1 - decel] > top + 1.0; decel++) continue;
+    for(k = accel; k < steps - decel && fabs(gaps[k] - top) <= 1.0; k++) continue;
+    cruise = k - accel;
+    if(reached)
+    {
+        CHECK(labs(accel - want) <= want / 50 + 1);     // 1 % in speed, 2 % in steps.
+        CHECK(labs(decel - want) <= want / 50 + 1);
+        CHECK_EQ(accel + cruise + decel, n);
+    }
+    else
+    {
+        CHECK_EQ(accel, n);         // Triangle: no step at the top speed.
+    }
+
+    for(k = 1; k <= n; k++)
+    {
+        s = (k <= ramp) ? k : (k > n - ramp) ? n - k + 1 : 0;
+        w = (s || !reached) ? sqrt(2.0 * a * (s ? s : ramp)) : v;  // AVR446 eq. 11.
+        if(w > v) w = v;
+        err = fabs(F / gaps[k - 1] - w) / w;
+        if(err > worst) worst = err;
+        if(F / gaps[k - 1] > peak) peak = F / gaps[k - 1];
+        if(s && k > 1 && k <= ramp) CHECK(gaps[k - 1] <= gaps[k - 2] + 1.0);   // Up...
+        if(s && k > 1 && k > n - ramp) CHECK(gaps[k - 1] + 1.0 >= gaps[k - 2]); // ... then down.
+        time += gaps[k - 1] / F;
+    }
+    CHECK(worst < 0.01);
+
+    // Trapezoid (triangle for short moves) of AVR446.
+    w = sqrt(2.0 * a * ramp);
+    ideal = 2 * w / a + (n - 2 * ramp) / (double)v;
+    printf("  %5ld steps, %4u steps/s, %5u steps/s^2: peak %6.1f steps/s, ", n, v, a, peak);
+    if(reached)
+        printf("ramps %4ld/%4ld (AVR446 %4ld), cruise %5ld", accel, decel, want, cruise);
+    else
+        printf("triangle, %4ld steps up and down", ramp);
+    printf(", worst speed error %.3f %%, %.4f s (AVR446 %.4f s)\n", worst * 100, time, ideal);
+    if(ramp >= 200) CHECK(fabs(time - ideal) / ideal < 0.02);
+    free(gaps);
+}
+
+int main(void)
+{
+    int32_t target;
+
+    host_reset();
+    stepper_ini();
+    RCONbits.IPEN = 1;
+    INTCONbits.GIEH = 1;
+
+    profile(10000, 2000, 1000);                 // Long cruise.
+    profile(3000, 2000, 1000);                  // Top speed not reached.
+    profile(4001, 2000, 1000);                  // Odd, just reached.
+    profile(20000, STEPPER_SPEED_MAX, 200);     // Long ramp, Newton part.
+    profile(500, 1500, STEPPER_ACCEL_MAX);      // Short ramp, table part.
+    profile(7, 1000, 1000);                     // Table only.
+
+    // Constant speed.
+    gaps = malloc(sizeof(double) * 201);
+    CHECK(stepper_setAccel(0));
+    stepper_setSpeed(1000);
+    CHECK(stepper_move(-200));
+    run(201);
+    CHECK_EQ(steps, 200);
+    CHECK_EQ(stepper_getPosition(), 7 - 200);
+    CHECK(fabs(gaps[199] - F / 1000) <= 1.0);
+
+    // Queued moves, each from rest to rest: the sum of the steps.
+    CHECK(stepper_setAccel(5000));
+    stepper_setSpeed(2000);
+    target = stepper_getPosition();
+    CHECK(stepper_move(50));
+    CHECK(stepper_move(-30));
+    CHECK(stepper_moveTo(target - 100));
+    free(gaps);
+    gaps = malloc(sizeof(double) * 400);
+    run(400);
+    CHECK_EQ(steps, 50 + 30 + 120);
+    CHECK_EQ(stepper_getPosition(), target - 100);
+    free(gaps);
+
+    return check_end("stepper_profile");
+}
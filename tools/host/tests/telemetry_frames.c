@@ -0,0 +1,232 @@
+/* ****************************************************************************
+ * Project: Control Functions             File telemetry_frames.c (host test) October/2026
+ * ****************************************************************************
+ * File description: Records of telemetry.c (common) as built by PWM.X, sent
+ *                   by uart_isr() on the register model and read back from
+ *                   TXREG (host_uart_hook), as tools/telemetry_decode.py does:
+ *                     - each frame ends with 0x00 and has no other 0x00;
+ *                     - COBS decoded, type, seq, payload and the CRC-16 of
+ *                       the record (CRC-16/CCITT-FALSE, "123456789" 0x29B1);
+ *                     - the payloads of telemetry_adc(), telemetry_ntc() and
+ *                       telemetry_pwm() little endian, zeros inside;
+ *                     - seq goes up by one, a record without room in the
+ *                       buffer is refused whole and its seq is skipped;
+ *                     - built with the receiver (UART_RX_SIZE), records
+ *                       put on RX (host_uart_receive) as the PC sends them:
+ *                       telemetry_receive() gives type and payload of a
+ *                       whole record, also in two parts and with zeros
+ *                       inside, and drops a wrong CRC, a frame too long or
+ *                       not COBS (telemetry_rxErrors); bytes without room in
+ *                       the ring counted in uart_rxDrops.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ * 10/19/2026| Antonio Castilho  | Receiver: telemetry_receive()
+ ******************************************************************************/
+
+#include <string.h>
+#include <xc.h>
+#include "telemetry.h"
+#include "check.h"
+
+static uint8_t line[256];   // Bytes of TXREG since the last 0x00.
+static uint8_t length;
+static uint8_t frame[32];   // Last frame, COBS decoded.
+static uint8_t frame_length;
+static uint16_t frames, bad;
+
+static void received(uint8_t byte)
+{
+    uint8_t i = 0, k, code, n = 0;
+
+    if(byte)
+    {
+        line[length++] = byte;
+        return;
+    }
+    // COBS: each code is 1 + the bytes up to the next zero; no zero after the last.
+    while(i < length)
+    {
+        code = line[i++];
+        if(i + code - 1 > length || n + code > sizeof(frame))
+        {
+            bad++;
+            break;
+        }
+        for(k = 1; k < code; k++) frame[n++] = line[i++];
+        if(i < length) frame[n++] = 0;
+    }
+    frame_length = n;
+    length = 0;
+    frames++;
+}
+
+// The transmitter empties the buffer, as isr_low would.
+static void send_all(void)
+{
+    while(PIE1bits.TXIE)
+    {
+        host_cycles(0);
+        uart_isr();
+    }
+    host_cycles(0);
+}
+
+static uint16_t crc_of(const uint8_t *data, uint8_t n)
+{
+    uint16_t crc = 0xFFFF;
+
+    while(n--) crc = telemetry_crc(crc, *data++);
+    return crc;
+}
+
+// Record of the PC: COBS frame of type, seq, payload and CRC, ended by 0x00.
+static uint8_t encode(uint8_t *out, uint8_t type, const uint8_t *payload, uint8_t n)
+{
+    uint8_t record[32];
+    uint8_t i, code = 0, k = 1;
+    uint16_t crc;
+
+    record[0] = type;
+    record[1] = 0x55;
+    for(i = 0; i < n; i++) record[2 + i] = payload[i];
+    crc = crc_of(record, (uint8_t)(n + 2));
+    record[n + 2] = (uint8_t)crc;
+    record[n + 3] = (uint8_t)(crc >> 8);
+    for(i = 0; i < n + 4; i++)
+    {
+        if(record[i])
+        {
+            out[k++] = record[i];
+            continue;
+        }
+        out[code] = (uint8_t)(k - code);
+        code = k++;
+    }
+    out[code] = (uint8_t)(k - code);
+    out[k++] = 0;
+    return k;
+}
+
+// Bytes on RX, moved to the ring by the interrupt.
+static void put(const uint8_t *bytes, uint8_t n)
+{
+    while(n--) host_uart_receive(*bytes++);
+    host_cycles(0);
+    uart_isr();
+}
+
+static void check_frame(uint8_t type, uint8_t seq, const uint8_t *payload, uint8_t n)
+{
+    uint8_t i;
+
+    CHECK_EQ(frame_length, n + 4);
+    CHECK_EQ(frame[0], type);
+    CHECK_EQ(frame[1], seq);
+    for(i = 0; i < n; i++) CHECK_EQ(frame[2 + i], payload[i]);
+    CHECK_EQ(frame[n + 2] | (frame[n + 3] << 8), crc_of(frame, (uint8_t)(n + 2)));
+}
+
+int main(void)
+{
+    static const uint8_t adc[] = { 3, 0x00, 0x02 };                 // ch 3, 512.
+    static const uint8_t ntc[] = { 0, 0x34, 0x12 };                 // ch 0, 0x1234.
+    static const uint8_t pwm[] = { 1, 0x20, 0x4E, 0x00, 0x00, 0xF4, 0x01 }; // 20000 Hz, 50,0 %.
+    uint8_t i, queued;
+
+    host_reset();
+    host_uart_hook = received;
+    CHECK_EQ(crc_of((const uint8_t *)"123456789", 9), 0x29B1);
+
+    telemetry_ini();
+    CHECK_EQ(TXSTAbits.TXEN, 1);
+    CHECK_EQ(telemetry_adc(3, 512), 1);
+    send_all();
+    CHECK_EQ(frames, 1);
+    check_frame(TLM_ADC, 0, adc, sizeof(adc));
+    CHECK_EQ(telemetry_ntc(0, 0x1234), 1);
+    send_all();
+    check_frame(TLM_NTC, 1, ntc, sizeof(ntc));
+    CHECK_EQ(telemetry_pwm(1, 20000, 500), 1);
+    send_all();
+    check_frame(TLM_PWM, 2, pwm, sizeof(pwm));
+
+    // Buffer full: the records that do not fit are refused whole.
+    for(i = 0, queued = 0; i < 20; i++) queued += telemetry_pwm(1, 20000, 500);
+    CHECK(queued < 20);
+    CHECK(uart_drops > 0);
+    frames = 0;
+    send_all();
+    CHECK_EQ(frames, queued);
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(frame[1], (uint8_t)(3 + queued - 1));  // The last one queued.
+    printf("  %u TLM_PWM records queued in the %u-byte buffer, %u bytes refused\n",
+           (unsigned)queued, (unsigned)UART_TX_SIZE, (unsigned)uart_drops);
+
+    // Receiver.
+    {
+        static const uint8_t command[] = { 'S', 2, 0x9C, 0xFF, 0xFF, 0xFF };
+        static const uint8_t zeros[] = { 0, 0, 7, 0 };
+        uint8_t out[40], payload[TLM_PAYLOAD_MAX], type, n, k;
+
+        CHECK_EQ(RCSTAbits.CREN, 1);
+        CHECK_EQ(PIE1bits.RCIE, 1);
+        CHECK_EQ(telemetry_receive(&type, payload, &n), 0);
+        k = encode(out, TLM_PARAM, command, sizeof(command));
+        put(out, k);
+        CHECK_EQ(telemetry_receive(&type, payload, &n), 1);
+        CHECK_EQ(type, TLM_PARAM);
+        CHECK_EQ(n, sizeof(command));
+        for(i = 0; i < sizeof(command); i++) CHECK_EQ(payload[i], command[i]);
+        CHECK_EQ(telemetry_receive(&type, payload, &n), 0);
+
+        k = encode(out, TLM_ADC, zeros, sizeof(zeros));     // In two parts.
+        put(out, 3);
+        CHECK_EQ(telemetry_receive(&type, payload, &n), 0);
+        put(out + 3, (uint8_t)(k - 3));
+        CHECK_EQ(telemetry_receive(&type, payload, &n), 1);
+        CHECK_EQ(type, TLM_ADC);
+        CHECK_EQ(n, sizeof(zeros));
+        for(i = 0; i < sizeof(zeros); i++) CHECK_EQ(payload[i], zeros[i]);
+        CHECK_EQ(telemetry_rxErrors, 0);
+
+        k = encode(out, TLM_PARAM, command, sizeof(command));
+        out[3] ^= 0x01;                                     // Wrong CRC.
+        put(out, k);
+        CHECK_EQ(telemetry_receive(&type, payload, &n), 0);
+        out[0] = 0;                                         // 0x00 alone.
+        put(out, 1);
+        CHECK_EQ(telemetry_receive(&type, payload, &n), 0);
+        memset(out, 0x11, 30);                              // Too long.
+        out[30] = 0;
+        put(out, 31);
+        CHECK_EQ(telemetry_receive(&type, payload, &n), 0);
+        out[0] = 9;                                         // Code past the end.
+        out[1] = 0x22;
+        out[2] = 0;
+        put(out, 3);
+        CHECK_EQ(telemetry_receive(&type, payload, &n), 0);
+        CHECK_EQ(telemetry_rxErrors, 3);
+        CHECK_EQ(uart_rxDrops, 0);
+
+        k = encode(out, TLM_PARAM, command, sizeof(command)); // Good again after them.
+        put(out, k);
+        CHECK_EQ(telemetry_receive(&type, payload, &n), 1);
+        CHECK_EQ(n, sizeof(command));
+
+        memset(out, 0x33, 40);                              // Ring full.
+        put(out, 40);
+        CHECK_EQ(uart_rxDrops, 40 - (UART_RX_SIZE - 1));
+        printf("  receiver: %u bytes of ring, %u records dropped, %u bytes without room\n",
+               (unsigned)UART_RX_SIZE, (unsigned)telemetry_rxErrors, (unsigned)uart_rxDrops);
+    }
+
+    return check_end("telemetry_frames");
+}
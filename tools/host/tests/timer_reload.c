@@ -0,0 +1,158 @@
+/* ****************************************************************************
+ * Project: Control Functions         File timer_reload.c (host test) October/2026
+ * ****************************************************************************
+ * File description: Reload of TIMER0, TIMER1 and TIMER3 of timer.c (TIMER.X)
+ *                   on the register model, built with periods of 10 ms
+ *                   (prescaler 1:1 at 8 MHz, one count per Tcy):
+ *                     - latency: the counts lost by a read of TMRxL and
+ *                       TMRxH and the write back, as timerx_reload() makes
+ *                       them, measured against the cycles of the model, are
+ *                       TIMER_RELOAD_TCY (and 2 more for TMR0);
+ *                     - drift: 50 periods with the reload made late by 0 to
+ *                       about 200 Tcy, as an interrupt served late, last
+ *                       exactly 50 times the count of the period.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#include <xc.h>
+#include "timer.h"
+#include "check.h"
+
+#define PERIODS     50
+
+typedef struct
+{
+    const char *name;
+    void (*ini)(void);
+    void (*reload)(void);
+    uint16_t preload;
+    uint32_t lost;          // Expected counts lost by the read and write.
+} reload_t;
+
+static uint8_t flag(uint8_t n)
+{
+    if(n == 0) return INTCONbits.TMR0IF;
+    if(n == 1) return PIR1bits.TMR1IF;
+    return PIR2bits.TMR3IF;
+}
+
+static void flag_clear(uint8_t n)
+{
+    if(n == 0) INTCONbits.TMR0IF = 0;
+    else if(n == 1) PIR1bits.TMR1IF = 0;
+    else PIR2bits.TMR3IF = 0;
+}
+
+// TMRxL then TMRxH, the high byte latched by the read of the low one.
+static uint16_t read16(uint8_t n)
+{
+    uint16_t count;
+
+    if(n == 0)
+    {
+        count = TMR0L;
+        return (uint16_t)(count | (TMR0H << 8));
+    }
+    if(n == 1)
+    {
+        count = TMR1L;
+        return (uint16_t)(count | (TMR1H << 8));
+    }
+    count = TMR3L;
+    return (uint16_t)(count | (TMR3H << 8));
+}
+
+static void write16(uint8_t n, uint16_t count)
+{
+    if(n == 0)
+    {
+        TMR0H = (uint8_t)(count >> 8);
+        TMR0L = (uint8_t)count;
+    }
+    else if(n == 1)
+    {
+        TMR1H = (uint8_t)(count >> 8);
+        TMR1L = (uint8_t)count;
+    }
+    else
+    {
+        TMR3H = (uint8_t)(count >> 8);
+        TMR3L = (uint8_t)count;
+    }
+}
+
+static void wait_flag(uint8_t n)
+{
+    uint32_t start = host_cycle_count();
+
+    while(!flag(n) && host_cycle_count() - start < 100000UL) continue;
+    CHECK(flag(n));
+}
+
+static void check_timer(uint8_t n, const reload_t *t)
+{
+    uint32_t c1, c2, first, total, period = 65536UL - t->preload;
+    uint16_t v, r, i;
+    long drift;
+
+    host_reset();
+    t->ini();
+    wait_flag(n);
+
+    // Latency: the read and the write of timerx_reload(), the value written back as read.
+    c1 = host_cycle_count();
+    v = read16(n);
+    write16(n, v);
+    host_cycles(4);                     // Past the stop of TMR0 after the write.
+    c2 = host_cycle_count();
+    r = read16(n);
+    CHECK_EQ((c2 - c1) - (uint16_t)(r - v), t->lost);
+
+    // Drift: the reload made late, the periods still the same.
+    wait_flag(n);
+    flag_clear(n);
+    t->reload();
+    wait_flag(n);
+    first = host_cycle_count();
+    for(i = 0; i < PERIODS; i++)
+    {
+        host_cycles((i * 37UL) % 211UL);   // Interrupt served late.
+        flag_clear(n);
+        t->reload();
+        wait_flag(n);
+    }
+    total = host_cycle_count() - first;
+    drift = (long)total - (long)(PERIODS * period);
+    printf("  %s: %lu counts lost by the reload, %d periods of %lu Tcy in %lu Tcy (%+ld)\n",
+           t->name, (unsigned long)((c2 - c1) - (uint16_t)(r - v)), PERIODS,
+           (unsigned long)period, (unsigned long)total, drift);
+    CHECK(drift >= -2 && drift <= 2);
+}
+
+int main(void)
+{
+    static const reload_t timers[4] = {
+        { "TIMER0", timer0_ini, timer0_reload, TIMER0_PRELOAD, TIMER_RELOAD_TCY + 2 },
+        { "TIMER1", timer1_ini, timer1_reload, TIMER1_PRELOAD, TIMER_RELOAD_TCY },
+        { 0 },
+        { "TIMER3", timer3_ini, timer3_reload, TIMER3_PRELOAD, TIMER_RELOAD_TCY },
+    };
+
+    CHECK_EQ(TIMER0_PS(TIMER0_PERIOD_US), 1);
+    CHECK_EQ(TIMER13_PS(TIMER1_PERIOD_US), 1);
+    CHECK_EQ(TIMER13_PS(TIMER3_PERIOD_US), 1);
+    check_timer(0, &timers[0]);
+    check_timer(1, &timers[1]);
+    check_timer(3, &timers[3]);
+
+    return check_end("timer_reload");
+}
@@ -0,0 +1,135 @@
+/* ****************************************************************************
+ * Project: Control Functions        File timer_solver.c (host test) October/2026
+ * ****************************************************************************
+ * File description: Timing error of the compile-time solver of timer.h
+ *                   (TIMER.X) for each clock of the PIC18F4550: the periods
+ *                   from the shortest to the longest of each timer, with the
+ *                   prescaler, postscaler and preload found, are within half
+ *                   a timer tick of the period asked. Prints the worst error
+ *                   of each clock for the periods from 1 ms. timer0_ini() and timer2_ini() are then run
+ *                   on the register model at the default 8 MHz.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ ******************************************************************************/
+
+#include <xc.h>
+#include "timer.h"
+#include "check.h"
+
+// The macros of timer.h are evaluated at run time with this clock.
+static uint32_t test_fosc;
+#undef _XTAL_FREQ
+#define _XTAL_FREQ  test_fosc
+
+// INTRC, INTOSC postscaler, crystals of the boards, PLL 96 MHz / 2.
+static const uint32_t clocks[] = {
+    31250UL, 125000UL, 250000UL, 500000UL, 1000000UL, 2000000UL,
+    4000000UL, 8000000UL, 12000000UL, 20000000UL, 48000000UL
+};
+
+static const uint32_t periods[] = {
+    1UL, 10UL, 100UL, 250UL, 1000UL, 4096UL, 10000UL, 33333UL, 125000UL,
+    250000UL, 500000UL, 1000000UL, 2000000UL, 10000000UL, 60000000UL
+};
+
+static double worst;
+
+/* One solution: count ticks of d cycles (d = prescale * postscale). The count
+ * fits the register and the period is within half a tick of us. */
+static void check_solution(uint32_t us, uint32_t count, uint32_t d, uint32_t top)
+{
+    double fcy = test_fosc / 4.0;
+    double got = count * (double)d / fcy * 1e6;
+    double err = got - us;
+
+    CHECK(count >= 1 && count <= top);
+    if(err < 0) err = -err;
+    CHECK(err <= d / fcy * 1e6 / 2 + 1e-6);
+    if(us >= 1000UL && err / us > worst) worst = err / us;
+}
+
+static void check_clock(void)
+{
+    uint32_t i, us, ps, post;
+    uint32_t ends[6];
+
+    CHECK(test_fosc % 15625UL == 0);
+    ends[0] = TIMER_MIN_US;
+    ends[1] = TIMER0_MAX_US;
+    ends[2] = TIMER13_MAX_US;
+    ends[3] = TIMER2_MAX_US;
+    ends[4] = TIMER13_MAX_US + 1;   // Must move Timer1 and 3 to the next period...
+    ends[5] = TIMER2_MAX_US + 1;    // ... not wrap.
+    worst = 0;
+
+    for(i = 0; i < sizeof(periods) / sizeof(periods[0]) + 6; i++)
+    {
+        us = i < 6 ? ends[i] : periods[i - 6];
+        if(us < TIMER_MIN_US) continue;
+
+        if(us <= TIMER0_MAX_US)
+        {
+            ps = TIMER0_PS(us);
+            check_solution(us, TIMER0_COUNT(us), ps, 65536UL);
+            if(ps > 1) CHECK(!TIMER_FITS(us, 65536UL, ps / 2));
+            CHECK_EQ(TIMER0_PSA(us) ? 1UL : 2UL << TIMER0_T0PS(us), ps);
+        }
+        if(us <= TIMER13_MAX_US)
+        {
+            ps = TIMER13_PS(us);
+            check_solution(us, TIMER13_COUNT(us), ps, 65536UL);
+            if(ps > 1) CHECK(!TIMER_FITS(us, 65536UL, ps / 2));
+            CHECK_EQ(1UL << TIMER13_CKPS(us), ps);
+        }
+        if(us <= TIMER2_MAX_US)
+        {
+            ps = TIMER2_PS(us);
+            post = TIMER2_POST(us);
+            CHECK(post >= 1 && post <= 16);
+            check_solution(us, TIMER2_PR2(us) + 1, ps * post, 256UL);
+            CHECK_EQ(1UL << (2 * TIMER2_CKPS(us)), ps);
+        }
+    }
+    CHECK(ends[4] > TIMER13_MAX_US && ends[5] > TIMER2_MAX_US);
+    printf("  Fosc %8lu Hz: Timer0 up to %10lu us, Timer1/3 %9lu us, Timer2 %8lu us, worst error from 1 ms %.4f %%\n",
+           (unsigned long)test_fosc, (unsigned long)TIMER0_MAX_US, (unsigned long)TIMER13_MAX_US,
+           (unsigned long)TIMER2_MAX_US, worst * 100);
+}
+
+int main(void)
+{
+    uint32_t i, start, n;
+
+    for(i = 0; i < sizeof(clocks) / sizeof(clocks[0]); i++)
+    {
+        test_fosc = clocks[i];
+        check_clock();
+    }
+
+    // 8 MHz, 500 ms: 1:16, 62500 counts = 1000000 cycles to the overflow.
+    host_reset();
+    timer0_ini();
+    start = host_cycle_count();
+    while(!INTCONbits.TMR0IF && host_cycle_count() - start < 1100000UL) continue;
+    n = host_cycle_count() - start;
+    CHECK(n >= 999990UL && n <= 1000010UL);
+
+    // 8 MHz, 1 ms: 1:1, PR2 = 249, postscale 1:8 = 2000 cycles per flag.
+    host_reset();
+    timer2_ini();
+    CHECK_EQ(PR2, 249);
+    start = host_cycle_count();
+    while(!PIR1bits.TMR2IF && host_cycle_count() - start < 3000UL) continue;
+    n = host_cycle_count() - start;
+    CHECK(n >= 1990UL && n <= 2010UL);
+
+    return check_end("timer_solver");
+}
@@ -0,0 +1,519 @@
+/* ****************************************************************************
+ * Project: Control Functions             File xc.h (host)           October/2026
+ * ****************************************************************************
+ * File description: Host replacement for the XC8 <xc.h> header. Models the
+ *                   PIC18F4550 special function registers (SFR) used by the
+ *                   drivers of this repository as observable memory, so that
+ *                   the modules of every .X project can be compiled and run
+ *                   on a PC with gcc.
+ *
+ *                   Every SFR access goes through host_sfr(), which first
+ *                   advances the peripheral models (timers, ADC, MSSP, EUSART,
+ *                   data EEPROM, port latches). Test code observes the
+ *                   hardware through the hooks declared at the end of this
+ *                   file.
+ *
+ *                   The SFR addresses are the ones of the PIC18F4550
+ *                   datasheet, register file map, Pg 68.
+ * ****************************************************************************
+ * Program environment for validation: gcc (C99 / GNU extensions), Linux.
+ * ****************************************************************************
+ * MIT License  (see: LICENSE em github)
+ *   Copyright (c) 2022 Antonio Aparecido Ariza Castilho
+ *   <https://github.com/AntonioCastilho>
+ * ****************************************************************************
+ * Reference:
+ * * Microchip PIC18F4550 Datasheet.
+ * ****************************************************************************
+ * Date      | Author            | Description
+ * **********|*******************|*********************************************
+ * 10/19/2026| Antonio Castilho  | File has been created
+ * 10/19/2026| Antonio Castilho  | host_sleep_hook
+ * 10/19/2026| Antonio Castilho  | host_isr_hook
+ * 10/19/2026| Antonio Castilho  | host_uart_receive()
+ ******************************************************************************/
+
+#ifndef HOST_XC_H
+#define	HOST_XC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/******************************************************************************/
+// XC8 language extensions.
+/******************************************************************************/
+typedef uint32_t __uint24;
+typedef int32_t  __int24;
+
+#define __interrupt(x)
+#define __at(x)
+#define __section(x)
+#define __far
+#define __near
+#define __ram
+#define __rom
+
+#define di()            (INTCONbits.GIE = 0)
+#define ei()            (INTCONbits.GIE = 1)
+#define CLRWDT()        host_clrwdt()
+#define SLEEP()         host_sleep()
+#define NOP()           host_cycles(1)
+#define _delay(x)       host_cycles((uint32_t)(x))
+#define __delay_us(x)   host_cycles((uint32_t)(((uint64_t)(x) * (_XTAL_FREQ / 4)) / 1000000))
+#define __delay_ms(x)   host_cycles((uint32_t)(((uint64_t)(x) * (_XTAL_FREQ / 4)) / 1000))
+
+/******************************************************************************/
+// SFR access.
+/******************************************************************************/
+volatile uint8_t *host_sfr(uint16_t addr);
+
+#define HOST_SFR8(a)        (*host_sfr(a))
+#define HOST_SFR16(a)       (*(volatile uint16_t *)host_sfr(a))
+#define HOST_SFRBITS(t, a)  (*(volatile t *)host_sfr(a))
+
+/******************************************************************************/
+// SFR addresses. Pg 68.
+/******************************************************************************/
+#define HOST_PORTA      0xF80
+#define HOST_PORTB      0xF81
+#define HOST_PORTC      0xF82
+#define HOST_PORTD      0xF83
+#define HOST_PORTE      0xF84
+#define HOST_LATA       0xF89
+#define HOST_LATB       0xF8A
+#define HOST_LATC       0xF8B
+#define HOST_LATD       0xF8C
+#define HOST_LATE       0xF8D
+#define HOST_TRISA      0xF92
+#define HOST_TRISB      0xF93
+#define HOST_TRISC      0xF94
+#define HOST_TRISD      0xF95
+#define HOST_TRISE      0xF96
+#define HOST_OSCTUNE    0xF9B
+#define HOST_PIE1       0xF9D
+#define HOST_PIR1       0xF9E
+#define HOST_IPR1       0xF9F
+#define HOST_PIE2       0xFA0
+#define HOST_PIR2       0xFA1
+#define HOST_IPR2       0xFA2
+#define HOST_EECON1     0xFA6
+#define HOST_EECON2     0xFA7
+#define HOST_EEDATA     0xFA8
+#define HOST_EEADR      0xFA9
+#define HOST_RCSTA      0xFAB
+#define HOST_TXSTA      0xFAC
+#define HOST_TXREG      0xFAD
+#define HOST_RCREG      0xFAE
+#define HOST_SPBRG      0xFAF
+#define HOST_SPBRGH     0xFB0
+#define HOST_T3CON      0xFB1
+#define HOST_TMR3L      0xFB2
+#define HOST_TMR3H      0xFB3
+#define HOST_CMCON      0xFB4
+#define HOST_CVRCON     0xFB5
+#define HOST_ECCP1AS    0xFB6
+#define HOST_ECCP1DEL   0xFB7
+#define HOST_BAUDCON    0xFB8
+#define HOST_CCP2CON    0xFBA
+#define HOST_CCPR2L     0xFBB
+#define HOST_CCPR2H     0xFBC
+#define HOST_CCP1CON    0xFBD
+#define HOST_CCPR1L     0xFBE
+#define HOST_CCPR1H     0xFBF
+#define HOST_ADCON2     0xFC0
+#define HOST_ADCON1     0xFC1
+#define HOST_ADCON0     0xFC2
+#define HOST_ADRESL     0xFC3
+#define HOST_ADRESH     0xFC4
+#define HOST_SSPCON2    0xFC5
+#define HOST_SSPCON1    0xFC6
+#define HOST_SSPSTAT    0xFC7
+#define HOST_SSPADD     0xFC8
+#define HOST_SSPBUF     0xFC9
+#define HOST_T2CON      0xFCA
+#define HOST_PR2        0xFCB
+#define HOST_TMR2       0xFCC
+#define HOST_T1CON      0xFCD
+#define HOST_TMR1L      0xFCE
+#define HOST_TMR1H      0xFCF
+#define HOST_RCON       0xFD0
+#define HOST_WDTCON     0xFD1
+#define HOST_HLVDCON    0xFD2
+#define HOST_OSCCON     0xFD3
+#define HOST_T0CON      0xFD5
+#define HOST_TMR0L      0xFD6
+#define HOST_TMR0H      0xFD7
+#define HOST_STATUS     0xFD8
+#define HOST_INTCON3    0xFF0
+#define HOST_INTCON2    0xFF1
+#define HOST_INTCON     0xFF2
+#define HOST_TABLAT     0xFF5
+#define HOST_TBLPTRL    0xFF6
+#define HOST_TBLPTRH    0xFF7
+#define HOST_TBLPTRU    0xFF8
+
+/******************************************************************************/
+// Register bit definitions.
+/******************************************************************************/
+#define HOST_PORT_BITS(p)                                                      \
+    typedef union {                                                            \
+        struct { uint8_t p##0:1, p##1:1, p##2:1, p##3:1,                      \
+                          p##4:1, p##5:1, p##6:1, p##7:1; };                   \
+    }
+
+typedef union {
+    struct { uint8_t RA0:1, RA1:1, RA2:1, RA3:1, RA4:1, RA5:1, RA6:1, :1; };
+    struct { uint8_t AN0:1, AN1:1, AN2:1, AN3:1, :1, AN4:1, :2; };
+} PORTAbits_t;
+HOST_PORT_BITS(RB) PORTBbits_t;
+HOST_PORT_BITS(RC) PORTCbits_t;
+HOST_PORT_BITS(RD) PORTDbits_t;
+HOST_PORT_BITS(RE) PORTEbits_t;
+HOST_PORT_BITS(LATA) LATAbits_t;
+HOST_PORT_BITS(LATB) LATBbits_t;
+HOST_PORT_BITS(LATC) LATCbits_t;
+HOST_PORT_BITS(LATD) LATDbits_t;
+HOST_PORT_BITS(LATE) LATEbits_t;
+
+typedef union {
+    struct { uint8_t TRISA0:1, TRISA1:1, TRISA2:1, TRISA3:1,
+                      TRISA4:1, TRISA5:1, TRISA6:1, :1; };
+    struct { uint8_t RA0:1, RA1:1, RA2:1, RA3:1, RA4:1, RA5:1, RA6:1, :1; };
+} TRISAbits_t;
+typedef union {
+    struct { uint8_t TRISB0:1, TRISB1:1, TRISB2:1, TRISB3:1,
+                      TRISB4:1, TRISB5:1, TRISB6:1, TRISB7:1; };
+    struct { uint8_t RB0:1, RB1:1, RB2:1, RB3:1, RB4:1, RB5:1, RB6:1, RB7:1; };
+} TRISBbits_t;
+typedef union {
+    struct { uint8_t TRISC0:1, TRISC1:1, TRISC2:1, :1,
+                      TRISC4:1, TRISC5:1, TRISC6:1, TRISC7:1; };
+    struct { uint8_t RC0:1, RC1:1, RC2:1, :1, RC4:1, RC5:1, RC6:1, RC7:1; };
+} TRISCbits_t;
+typedef union {
+    struct { uint8_t TRISD0:1, TRISD1:1, TRISD2:1, TRISD3:1,
+                      TRISD4:1, TRISD5:1, TRISD6:1, TRISD7:1; };
+    struct { uint8_t RD0:1, RD1:1, RD2:1, RD3:1, RD4:1, RD5:1, RD6:1, RD7:1; };
+} TRISDbits_t;
+typedef union {
+    struct { uint8_t TRISE0:1, TRISE1:1, TRISE2:1, :5; };
+    struct { uint8_t RE0:1, RE1:1, RE2:1, :5; };
+} TRISEbits_t;
+
+typedef union {
+    struct { uint8_t RBIF:1, INT0IF:1, TMR0IF:1, RBIE:1,
+                      INT0IE:1, TMR0IE:1, PEIE:1, GIE:1; };
+    struct { uint8_t :6, GIEL:1, GIEH:1; };
+    struct { uint8_t :2, T0IF:1, :2, T0IE:1, :2; };
+} INTCONbits_t;
+typedef union {
+    struct { uint8_t RBIP:1, :1, TMR0IP:1, :1,
+                      INTEDG2:1, INTEDG1:1, INTEDG0:1, RBPU:1; };
+} INTCON2bits_t;
+typedef union {
+    struct { uint8_t INT1IF:1, INT2IF:1, :1, INT1IE:1,
+                      INT2IE:1, :1, INT1IP:1, INT2IP:1; };
+} INTCON3bits_t;
+
+typedef union {
+    struct { uint8_t TMR1IF:1, TMR2IF:1, CCP1IF:1, SSPIF:1,
+                      TXIF:1, RCIF:1, ADIF:1, SPPIF:1; };
+} PIR1bits_t;
+typedef union {
+    struct { uint8_t TMR1IE:1, TMR2IE:1, CCP1IE:1, SSPIE:1,
+                      TXIE:1, RCIE:1, ADIE:1, SPPIE:1; };
+} PIE1bits_t;
+typedef union {
+    struct { uint8_t TMR1IP:1, TMR2IP:1, CCP1IP:1, SSPIP:1,
+                      TXIP:1, RCIP:1, ADIP:1, SPPIP:1; };
+} IPR1bits_t;
+typedef union {
+    struct { uint8_t CCP2IF:1, TMR3IF:1, HLVDIF:1, BCLIF:1,
+                      EEIF:1, USBIF:1, CMIF:1, OSCFIF:1; };
+} PIR2bits_t;
+typedef union {
+    struct { uint8_t CCP2IE:1, TMR3IE:1, HLVDIE:1, BCLIE:1,
+                      EEIE:1, USBIE:1, CMIE:1, OSCFIE:1; };
+} PIE2bits_t;
+typedef union {
+    struct { uint8_t CCP2IP:1, TMR3IP:1, HLVDIP:1, BCLIP:1,
+                      EEIP:1, USBIP:1, CMIP:1, OSCFIP:1; };
+} IPR2bits_t;
+
+typedef union {
+    struct { uint8_t NOT_BOR:1, NOT_POR:1, NOT_PD:1, NOT_TO:1,
+                      NOT_RI:1, :1, SBOREN:1, IPEN:1; };
+} RCONbits_t;
+typedef union {
+    struct { uint8_t SWDTEN:1, :7; };
+} WDTCONbits_t;
+typedef union {
+    struct { uint8_t SCS0:1, SCS1:1, IOFS:1, OSTS:1,
+                      IRCF0:1, IRCF1:1, IRCF2:1, IDLEN:1; };
+    struct { uint8_t SCS:2, :2, IRCF:3, :1; };
+} OSCCONbits_t;
+
+typedef union {
+    struct { uint8_t T0PS0:1, T0PS1:1, T0PS2:1, PSA:1,
+                      T0SE:1, T0CS:1, T08BIT:1, TMR0ON:1; };
+    struct { uint8_t T0PS:3, :5; };
+} T0CONbits_t;
+typedef union {
+    struct { uint8_t TMR1ON:1, TMR1CS:1, T1SYNC:1, T1OSCEN:1,
+                      T1CKPS0:1, T1CKPS1:1, T1RUN:1, RD16:1; };
+    struct { uint8_t :2, NOT_T1SYNC:1, :1, T1CKPS:2, :2; };
+} T1CONbits_t;
+typedef union {
+    struct { uint8_t T2CKPS0:1, T2CKPS1:1, TMR2ON:1, T2OUTPS0:1,
+                      T2OUTPS1:1, T2OUTPS2:1, T2OUTPS3:1, :1; };
+    struct { uint8_t T2CKPS:2, :1, TOUTPS:4, :1; };
+} T2CONbits_t;
+typedef union {
+    struct { uint8_t TMR3ON:1, TMR3CS:1, T3NSYNC:1, T3CCP1:1,
+                      T3CKPS0:1, T3CKPS1:1, T3CCP2:1, RD16:1; };
+    struct { uint8_t :4, T3CKPS:2, :2; };
+} T3CONbits_t;
+
+typedef union {
+    struct { uint8_t CCP1M0:1, CCP1M1:1, CCP1M2:1, CCP1M3:1,
+                      DC1B0:1, DC1B1:1, P1M0:1, P1M1:1; };
+    struct { uint8_t CCP1M:4, DC1B:2, P1M:2; };
+} CCP1CONbits_t;
+typedef union {
+    struct { uint8_t CCP2M0:1, CCP2M1:1, CCP2M2:1, CCP2M3:1,
+                      DC2B0:1, DC2B1:1, :2; };
+    struct { uint8_t CCP2M:4, DC2B:2, :2; };
+} CCP2CONbits_t;
+typedef union {
+    struct { uint8_t PSSBD0:1, PSSBD1:1, PSSAC0:1, PSSAC1:1,
+                      ECCPAS0:1, ECCPAS1:1, ECCPAS2:1, ECCPASE:1; };
+    struct { uint8_t PSSBD:2, PSSAC:2, ECCPAS:3, :1; };
+} ECCP1ASbits_t;
+typedef union {
+    struct { uint8_t PDC0:1, PDC1:1, PDC2:1, PDC3:1,
+                      PDC4:1, PDC5:1, PDC6:1, PRSEN:1; };
+    struct { uint8_t PDC:7, :1; };
+} ECCP1DELbits_t;
+
+typedef union {
+    struct { uint8_t ADON:1, GO_DONE:1, CHS0:1, CHS1:1,
+                      CHS2:1, CHS3:1, :2; };
+    struct { uint8_t :1, GO:1, CHS:4, :2; };
+    struct { uint8_t :1, DONE:1, :6; };
+    struct { uint8_t :1, NOT_DONE:1, :6; };
+} ADCON0bits_t;
+typedef union {
+    struct { uint8_t PCFG0:1, PCFG1:1, PCFG2:1, PCFG3:1,
+                      VCFG0:1, VCFG1:1, :2; };
+    struct { uint8_t PCFG:4, VCFG:2, :2; };
+} ADCON1bits_t;
+typedef union {
+    struct { uint8_t ADCS0:1, ADCS1:1, ADCS2:1, ACQT0:1,
+                      ACQT1:1, ACQT2:1, :1, ADFM:1; };
+    struct { uint8_t ADCS:3, ACQT:3, :2; };
+} ADCON2bits_t;
+
+typedef union {
+    struct { uint8_t BF:1, UA:1, R_NOT_W:1, S:1, P:1, D_NOT_A:1, CKE:1, SMP:1; };
+    struct { uint8_t :2, R_W:1, :2, D_A:1, :2; };
+} SSPSTATbits_t;
+typedef union {
+    struct { uint8_t SSPM0:1, SSPM1:1, SSPM2:1, SSPM3:1,
+                      CKP:1, SSPEN:1, SSPOV:1, WCOL:1; };
+    struct { uint8_t SSPM:4, :4; };
+} SSPCON1bits_t;
+typedef union {
+    struct { uint8_t SEN:1, RSEN:1, PEN:1, RCEN:1,
+                      ACKEN:1, ACKDT:1, ACKSTAT:1, GCEN:1; };
+} SSPCON2bits_t;
+
+typedef union {
+    struct { uint8_t TX9D:1, TRMT:1, BRGH:1, SENDB:1,
+                      SYNC:1, TXEN:1, TX9:1, CSRC:1; };
+} TXSTAbits_t;
+typedef union {
+    struct { uint8_t RX9D:1, OERR:1, FERR:1, ADDEN:1,
+                      CREN:1, SREN:1, RX9:1, SPEN:1; };
+} RCSTAbits_t;
+typedef union {
+    struct { uint8_t ABDEN:1, WUE:1, :1, BRG16:1,
+                      TXCKP:1, RXDTP:1, RCIDL:1, ABDOVF:1; };
+} BAUDCONbits_t;
+
+typedef union {
+    struct { uint8_t RD:1, WR:1, WREN:1, WRERR:1, FREE:1, :1, CFGS:1, EEPGD:1; };
+} EECON1bits_t;
+
+/******************************************************************************/
+// Registers.
+/******************************************************************************/
+#define PORTA       HOST_SFR8(HOST_PORTA)
+#define PORTB       HOST_SFR8(HOST_PORTB)
+#define PORTC       HOST_SFR8(HOST_PORTC)
+#define PORTD       HOST_SFR8(HOST_PORTD)
+#define PORTE       HOST_SFR8(HOST_PORTE)
+#define LATA        HOST_SFR8(HOST_LATA)
+#define LATB        HOST_SFR8(HOST_LATB)
+#define LATC        HOST_SFR8(HOST_LATC)
+#define LATD        HOST_SFR8(HOST_LATD)
+#define LATE        HOST_SFR8(HOST_LATE)
+#define TRISA       HOST_SFR8(HOST_TRISA)
+#define TRISB       HOST_SFR8(HOST_TRISB)
+#define TRISC       HOST_SFR8(HOST_TRISC)
+#define TRISD       HOST_SFR8(HOST_TRISD)
+#define TRISE       HOST_SFR8(HOST_TRISE)
+#define OSCTUNE     HOST_SFR8(HOST_OSCTUNE)
+#define PIE1        HOST_SFR8(HOST_PIE1)
+#define PIR1        HOST_SFR8(HOST_PIR1)
+#define IPR1        HOST_SFR8(HOST_IPR1)
+#define PIE2        HOST_SFR8(HOST_PIE2)
+#define PIR2        HOST_SFR8(HOST_PIR2)
+#define IPR2        HOST_SFR8(HOST_IPR2)
+#define EECON1      HOST_SFR8(HOST_EECON1)
+#define EECON2      HOST_SFR8(HOST_EECON2)
+#define EEDATA      HOST_SFR8(HOST_EEDATA)
+#define EEADR       HOST_SFR8(HOST_EEADR)
+#define RCSTA       HOST_SFR8(HOST_RCSTA)
+#define TXSTA       HOST_SFR8(HOST_TXSTA)
+#define TXREG       HOST_SFR8(HOST_TXREG)
+#define RCREG       HOST_SFR8(HOST_RCREG)
+#define SPBRG       HOST_SFR8(HOST_SPBRG)
+#define SPBRGH      HOST_SFR8(HOST_SPBRGH)
+#define T3CON       HOST_SFR8(HOST_T3CON)
+#define TMR3L       HOST_SFR8(HOST_TMR3L)
+#define TMR3H       HOST_SFR8(HOST_TMR3H)
+#define TMR3        HOST_SFR16(HOST_TMR3L)
+#define CMCON       HOST_SFR8(HOST_CMCON)
+#define CVRCON      HOST_SFR8(HOST_CVRCON)
+#define ECCP1AS     HOST_SFR8(HOST_ECCP1AS)
+#define ECCP1DEL    HOST_SFR8(HOST_ECCP1DEL)
+#define BAUDCON     HOST_SFR8(HOST_BAUDCON)
+#define CCP2CON     HOST_SFR8(HOST_CCP2CON)
+#define CCPR2L      HOST_SFR8(HOST_CCPR2L)
+#define CCPR2H      HOST_SFR8(HOST_CCPR2H)
+#define CCPR2       HOST_SFR16(HOST_CCPR2L)
+#define CCP1CON     HOST_SFR8(HOST_CCP1CON)
+#define CCPR1L      HOST_SFR8(HOST_CCPR1L)
+#define CCPR1H      HOST_SFR8(HOST_CCPR1H)
+#define CCPR1       HOST_SFR16(HOST_CCPR1L)
+#define ADCON2      HOST_SFR8(HOST_ADCON2)
+#define ADCON1      HOST_SFR8(HOST_ADCON1)
+#define ADCON0      HOST_SFR8(HOST_ADCON0)
+#define ADRESL      HOST_SFR8(HOST_ADRESL)
+#define ADRESH      HOST_SFR8(HOST_ADRESH)
+#define ADRES       HOST_SFR16(HOST_ADRESL)
+#define SSPCON2     HOST_SFR8(HOST_SSPCON2)
+#define SSPCON1     HOST_SFR8(HOST_SSPCON1)
+#define SSPSTAT     HOST_SFR8(HOST_SSPSTAT)
+#define SSPADD      HOST_SFR8(HOST_SSPADD)
+#define SSPBUF      HOST_SFR8(HOST_SSPBUF)
+#define T2CON       HOST_SFR8(HOST_T2CON)
+#define PR2         HOST_SFR8(HOST_PR2)
+#define TMR2        HOST_SFR8(HOST_TMR2)
+#define T1CON       HOST_SFR8(HOST_T1CON)
+#define TMR1L       HOST_SFR8(HOST_TMR1L)
+#define TMR1H       HOST_SFR8(HOST_TMR1H)
+#define TMR1        HOST_SFR16(HOST_TMR1L)
+#define RCON        HOST_SFR8(HOST_RCON)
+#define WDTCON      HOST_SFR8(HOST_WDTCON)
+#define OSCCON      HOST_SFR8(HOST_OSCCON)
+#define T0CON       HOST_SFR8(HOST_T0CON)
+#define TMR0L       HOST_SFR8(HOST_TMR0L)
+#define TMR0H       HOST_SFR8(HOST_TMR0H)
+#define INTCON3     HOST_SFR8(HOST_INTCON3)
+#define INTCON2     HOST_SFR8(HOST_INTCON2)
+#define INTCON      HOST_SFR8(HOST_INTCON)
+#define TABLAT      HOST_SFR8(HOST_TABLAT)
+#define TBLPTRL     HOST_SFR8(HOST_TBLPTRL)
+#define TBLPTRH     HOST_SFR8(HOST_TBLPTRH)
+#define TBLPTRU     HOST_SFR8(HOST_TBLPTRU)
+
+#define PORTAbits   HOST_SFRBITS(PORTAbits_t, HOST_PORTA)
+#define PORTBbits   HOST_SFRBITS(PORTBbits_t, HOST_PORTB)
+#define PORTCbits   HOST_SFRBITS(PORTCbits_t, HOST_PORTC)
+#define PORTDbits   HOST_SFRBITS(PORTDbits_t, HOST_PORTD)
+#define PORTEbits   HOST_SFRBITS(PORTEbits_t, HOST_PORTE)
+#define LATAbits    HOST_SFRBITS(LATAbits_t, HOST_LATA)
+#define LATBbits    HOST_SFRBITS(LATBbits_t, HOST_LATB)
+#define LATCbits    HOST_SFRBITS(LATCbits_t, HOST_LATC)
+#define LATDbits    HOST_SFRBITS(LATDbits_t, HOST_LATD)
+#define LATEbits    HOST_SFRBITS(LATEbits_t, HOST_LATE)
+#define TRISAbits   HOST_SFRBITS(TRISAbits_t, HOST_TRISA)
+#define TRISBbits   HOST_SFRBITS(TRISBbits_t, HOST_TRISB)
+#define TRISCbits   HOST_SFRBITS(TRISCbits_t, HOST_TRISC)
+#define TRISDbits   HOST_SFRBITS(TRISDbits_t, HOST_TRISD)
+#define TRISEbits   HOST_SFRBITS(TRISEbits_t, HOST_TRISE)
+#define INTCONbits  HOST_SFRBITS(INTCONbits_t, HOST_INTCON)
+#define INTCON2bits HOST_SFRBITS(INTCON2bits_t, HOST_INTCON2)
+#define INTCON3bits HOST_SFRBITS(INTCON3bits_t, HOST_INTCON3)
+#define PIR1bits    HOST_SFRBITS(PIR1bits_t, HOST_PIR1)
+#define PIE1bits    HOST_SFRBITS(PIE1bits_t, HOST_PIE1)
+#define IPR1bits    HOST_SFRBITS(IPR1bits_t, HOST_IPR1)
+#define PIR2bits    HOST_SFRBITS(PIR2bits_t, HOST_PIR2)
+#define PIE2bits    HOST_SFRBITS(PIE2bits_t, HOST_PIE2)
+#define IPR2bits    HOST_SFRBITS(IPR2bits_t, HOST_IPR2)
+#define RCONbits    HOST_SFRBITS(RCONbits_t, HOST_RCON)
+#define WDTCONbits  HOST_SFRBITS(WDTCONbits_t, HOST_WDTCON)
+#define OSCCONbits  HOST_SFRBITS(OSCCONbits_t, HOST_OSCCON)
+#define T0CONbits   HOST_SFRBITS(T0CONbits_t, HOST_T0CON)
+#define T1CONbits   HOST_SFRBITS(T1CONbits_t, HOST_T1CON)
+#define T2CONbits   HOST_SFRBITS(T2CONbits_t, HOST_T2CON)
+#define T3CONbits   HOST_SFRBITS(T3CONbits_t, HOST_T3CON)
+#define CCP1CONbits HOST_SFRBITS(CCP1CONbits_t, HOST_CCP1CON)
+#define CCP2CONbits HOST_SFRBITS(CCP2CONbits_t, HOST_CCP2CON)
+#define ECCP1ASbits HOST_SFRBITS(ECCP1ASbits_t, HOST_ECCP1AS)
+#define ECCP1DELbits HOST_SFRBITS(ECCP1DELbits_t, HOST_ECCP1DEL)
+#define ADCON0bits  HOST_SFRBITS(ADCON0bits_t, HOST_ADCON0)
+#define ADCON1bits  HOST_SFRBITS(ADCON1bits_t, HOST_ADCON1)
+#define ADCON2bits  HOST_SFRBITS(ADCON2bits_t, HOST_ADCON2)
+#define SSPSTATbits HOST_SFRBITS(SSPSTATbits_t, HOST_SSPSTAT)
+#define SSPCON1bits HOST_SFRBITS(SSPCON1bits_t, HOST_SSPCON1)
+#define SSPCON2bits HOST_SFRBITS(SSPCON2bits_t, HOST_SSPCON2)
+#define TXSTAbits   HOST_SFRBITS(TXSTAbits_t, HOST_TXSTA)
+#define RCSTAbits   HOST_SFRBITS(RCSTAbits_t, HOST_RCSTA)
+#define BAUDCONbits HOST_SFRBITS(BAUDCONbits_t, HOST_BAUDCON)
+#define EECON1bits  HOST_SFRBITS(EECON1bits_t, HOST_EECON1)
+
+/******************************************************************************/
+// XC8 library functions without a standard C equivalent (pic18f4550_sim.c).
+/******************************************************************************/
+char *itoa(char *buf, int val, int base);
+char *utoa(char *buf, unsigned val, int base);
+char *ltoa(char *buf, long val, int base);
+char *ultoa(char *buf, unsigned long val, int base);
+
+/******************************************************************************/
+// Simulator control and observation hooks (pic18f4550_sim.c).
+/******************************************************************************/
+void host_reset(void);                       // Power-on reset of every model.
+void host_cycles(uint32_t cycles);           // Advance time in instruction cycles.
+uint32_t host_cycle_count(void);             // Instruction cycles since reset.
+void host_clrwdt(void);
+void host_sleep(void);
+uint16_t host_wdt_clears(void);
+uint16_t host_sleep_count(void);
+
+// Value returned by an A/D conversion of a channel (0 - 1023).
+extern uint16_t (*host_adc_hook)(uint8_t channel);
+// Byte clocked in on SDI for each byte clocked out on SDO.
+extern uint8_t (*host_spi_hook)(uint8_t mosi);
+// Byte shifted out of the EUSART transmitter.
+extern void (*host_uart_hook)(uint8_t byte);
+// Byte on RX: queued, each one in RCREG (RCIF) after the one before is read.
+void host_uart_receive(uint8_t byte);
+// Every change of a LATx output latch (port: 0 = A ... 4 = E).
+extern void (*host_port_hook)(uint8_t port, uint8_t value);
+// Logic level of the input pins of a port (port: 0 = A ... 4 = E).
+extern uint8_t (*host_pin_hook)(uint8_t port);
+// Wake-up from SLEEP/IDLE, before the instruction after SLEEP; cycles asleep.
+extern void (*host_sleep_hook)(uint32_t cycles);
+// High priority interrupt (isr_high), called before an access when an enabled
+// flag of high priority is set and GIEH is 1; GIEH is 0 while it runs. NULL:
+// no dispatch, the test calls the interrupt functions itself.
+extern void (*host_isr_hook)(void);
+
+// Data EEPROM model, 256 bytes, with write counter per cell.
+extern uint8_t host_eeprom[256];
+extern uint32_t host_eeprom_writes[256];
+
+#endif	/* HOST_XC_H */
@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+"""Flash and RAM used by each module and symbol of an XC8 build, from the .map.
+
+XC8 v2 compiles all the .p1 of a project into one object, so the map has no
+sizes per file. They are rebuilt here:
+    1. the psect table gives the link address, length and space of each psect
+       (space 0 = program memory, 1 = data memory);
+    2. the symbol table gives the address and psect of each symbol; the size of
+       a symbol is up to the next symbol of the same psect, or the end of it
+       (XC8 puts each function in its own textN psect, so code is exact);
+    3. the symbol goes to the module (.c of the project, or common/x.c for a
+       shared source included by the wrapper x.c) that defines it. Locals
+       and parameters (func@x, ?_func, ??_func) go with their function; symbols
+       of no .c of the project are the XC8 libraries (float math, printf ...).
+
+The report of each build is kept next to the map (<map>.size.json) and the next
+run shows the difference to it, so an optimization is seen in bytes.
+
+Examples:
+    xc8_size.py                                   (every .X with a production map)
+    xc8_size.py ADC.X --top 20
+    xc8_size.py --map ADC.X/dist/default/production/ADC.X.production.map ADC.X
+    xc8_size.py ADC.X --no-save                   (do not replace the previous report)
+"""
+
+import argparse
+import glob
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+LIBRARY = '(library)'
+SPACE_NAMES = {0: 'flash', 1: 'ram'}
+FLASH_SIZE = 32768
+RAM_SIZE = 2048
+
+KEYWORDS = {'if', 'for', 'while', 'switch', 'return', 'sizeof', 'else', 'do', 'case'}
+
+
+def find_map(project):
+    maps = glob.glob(os.path.join(project, 'dist', '*', 'production', '*.map'))
+    maps = [m for m in maps if '.production.map' in m] or maps
+    return max(maps, key=os.path.getmtime) if maps else None
+
+
+def module_symbols(project):
+    """C names defined at file scope in each .c of the project: {name: module}.
+    A .c included by a .c (the wrapper of a shared source: #include
+    "../common/lcd.c") is followed, and its names go to that file, common/lcd.c."""
+    owner = {}
+    for path in sorted(glob.glob(os.path.join(project, '*.c'))):
+        scan_c(path, os.path.basename(path), owner, set())
+    return owner
+
+
+def scan_c(path, module, owner, seen):
+    definition = re.compile(r'^[A-Za-z_][\w\s\*]*?\b([A-Za-z_]\w*)\s*(\(|\[|=|;|__at)')
+    macro = re.compile(r'^([A-Z][A-Z0-9_]*)\(\s*([A-Za-z_]\w*)')  # EVENT_QUEUE(name, ...)
+    include = re.compile(r'^\s*#\s*include\s+"([^"]+\.c)"')
+    path = os.path.normpath(path)
+    if path in seen or not os.path.exists(path):
+        return
+    seen.add(path)
+    depth = 0
+    for line in open(path, encoding='latin-1'):
+        m = include.match(line)
+        if m:
+            included = os.path.normpath(os.path.join(os.path.dirname(path), m.group(1)))
+            scan_c(included, os.path.relpath(included, ROOT).replace(os.sep, '/'), owner, seen)
+            continue
+        if depth == 0 and not line.startswith(('typedef', 'extern')):
+            line = re.sub(r'__interrupt\s*\(\w*\)', '', line)
+            m = macro.match(line) or definition.match(line)
+            name = m and m.group(2 if m.re is macro else 1)
+            prototype = '(' in line and line.rstrip().endswith(');') and m and m.re is definition
+            if name and name not in KEYWORDS and not prototype:
+                owner.setdefault(name, module)
+        depth += line.count('{') - line.count('}')
+
+
+def module_of(owner, name):
+    """Module of a C name; name_xxx of a macro goes with name."""
+    if name in owner:
+        return owner[name]
+    prefixes = [n for n in owner if name.startswith(n + '_')]
+    return owner[max(prefixes, key=len)] if prefixes else LIBRARY
+
+
+def c_name(symbol):
+    """C name of an assembler symbol: _x -> x, ?_f / ??_f -> f, f@x -> f."""
+    name = symbol.lstrip('?')
+    if '@' in name:
+        name = name.split('@', 1)[0]
+    if name.startswith('_'):
+        name = name[1:]
+    return name
+
+
+def parse_map(path):
+    """Psects {name: (link, length, space)}, symbols [(name, psect, address)], totals."""
+    text = open(path, encoding='latin-1').read()
+    psects = {}
+    row = re.compile(r'^(?:\S+)?\s+(\w+)\s+([0-9A-Fa-f]+)\s+([0-9A-Fa-f]+)\s+([0-9A-Fa-f]+)'
+                     r'\s+([0-9A-Fa-f]+)\s+(\d+)(?:\s+(\d+))?\s*$')
+    table = text.split('Symbol Table', 1)
+    for line in table[0].splitlines():
+        m = row.match(line)
+        if m:
+            link, length, space = int(m.group(2), 16), int(m.group(4), 16), int(m.group(6))
+            if length and m.group(1) not in psects:
+                psects[m.group(1)] = (link, length, space)
+
+    symbols = []
+    if len(table) > 1:
+        body = re.split(r'\n\s*(?:Function Details|Data Sizes|UNUSED ADDRESS RANGES)', table[1])[0]
+        for name, psect, address in re.findall(r'(\S+)\s+(\w+)\s+([0-9A-Fa-f]{6})\b', body):
+            symbols.append((name, psect, int(address, 16)))
+
+    totals = {}
+    for key, label in (('flash', 'Program space'), ('ram', 'Data space')):
+        m = re.search(r'%s\s+used\s+[0-9A-Fa-f]+h\s+\(\s*(\d+)\)' % label, text)
+        if m:
+            totals[key] = int(m.group(1))
+    return psects, symbols, totals
+
+
+def symbol_sizes(psects, symbols):
+    """[(symbol, space, bytes)]: each symbol up to the next of its psect."""
+    by_psect = {}
+    for name, psect, address in symbols:
+        if psect in psects:
+            by_psect.setdefault(psect, {})[address] = name  # Aliases keep one name.
+    sizes = []
+    for psect, entries in by_psect.items():
+        link, length, space = psects[psect]
+        addresses = sorted(entries)
+        end = link + length
+        # A psect that starts before its first symbol gives those bytes to it.
+        if addresses and addresses[0] > link:
+            addresses[0], entries[link] = link, entries.pop(addresses[0])
+        for i, address in enumerate(addresses):
+            nxt = addresses[i + 1] if i + 1 < len(addresses) else end
+            if link <= address < end and nxt > address:
+                sizes.append((entries[address], space, nxt - address))
+    return sizes
+
+
+def report(project, path):
+    psects, symbols, totals = parse_map(path)
+    owner = module_symbols(project)
+    result = {'map': os.path.relpath(path, ROOT), 'totals': totals,
+              'modules': {}, 'symbols': {}}
+    for name, space, size in symbol_sizes(psects, symbols):
+        kind = SPACE_NAMES.get(space)
+        if not kind:
+            continue
+        module = module_of(owner, c_name(name))
+        entry = result['modules'].setdefault(module, {'flash': 0, 'ram': 0})
+        entry[kind] += size
+        key = '%s:%s' % (kind, c_name(name) if module != LIBRARY else name)
+        symbol = result['symbols'].setdefault(key, {'module': module, 'bytes': 0})
+        symbol['bytes'] += size
+    # Psects without symbols (startup, config words, idata copies ...).
+    named = {p for _, p, _ in symbols}
+    for psect, (_, length, space) in psects.items():
+        kind = SPACE_NAMES.get(space)
+        if kind and psect not in named:
+            result['modules'].setdefault(LIBRARY, {'flash': 0, 'ram': 0})[kind] += length
+    return result
+
+
+def difference(now, before):
+    if before is None:
+        return ''
+    d = now - before
+    return '%+d' % d if d else ''
+
+
+def print_report(project, result, previous, top):
+    totals = result['totals']
+    print('%s  (%s)' % (project, result['map']))
+    if totals:
+        print('  flash %6d of %d (%4.1f %%)  ram %5d of %d (%4.1f %%)' % (
+            totals.get('flash', 0), FLASH_SIZE, 100.0 * totals.get('flash', 0) / FLASH_SIZE,
+            totals.get('ram', 0), RAM_SIZE, 100.0 * totals.get('ram', 0) / RAM_SIZE))
+        if previous and previous.get('totals'):
+            print('  previous build: flash %s  ram %s' % (
+                difference(totals.get('flash', 0), previous['totals'].get('flash')) or '=',
+                difference(totals.get('ram', 0), previous['totals'].get('ram')) or '='))
+
+    before = previous['modules'] if previous else {}
+    print('  %-22s %7s %7s %7s %7s' % ('module', 'flash', 'diff', 'ram', 'diff'))
+    modules = sorted(set(result['modules']) | set(before),
+                     key=lambda m: -result['modules'].get(m, {}).get('flash', 0))
+    for module in modules:
+        now = result['modules'].get(module, {'flash': 0, 'ram': 0})
+        old = before.get(module) if previous else None
+        print('  %-22s %7d %7s %7d %7s' % (
+            module, now['flash'], difference(now['flash'], old['flash'] if old else (0 if previous else None)),
+            now['ram'], difference(now['ram'], old['ram'] if old else (0 if previous else None))))
+
+    old_symbols = previous['symbols'] if previous else {}
+    for kind in ('flash', 'ram'):
+        entries = [(k.split(':', 1)[1], v) for k, v in result['symbols'].items()
+                   if k.startswith(kind + ':')]
+        entries.sort(key=lambda e: -e[1]['bytes'])
+        print('  top %d %s:' % (top, kind))
+        for name, entry in entries[:top]:
+            old = old_symbols.get('%s:%s' % (kind, name))
+            print('    %-30s %-16s %6d %7s' % (name, entry['module'], entry['bytes'],
+                  difference(entry['bytes'], old['bytes'] if old else (0 if previous else None))))
+    if previous:
+        gone = [k for k in old_symbols if k not in result['symbols']]
+        for key in sorted(gone):
+            print('    removed %-22s %-16s %6d' % (key, old_symbols[key]['module'],
+                                                  -old_symbols[key]['bytes']))
+    print()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('projects', nargs='*', help='.X directories (default: all)')
+    ap.add_argument('--map', help='map of the build (one project only)')
+    ap.add_argument('--top', type=int, default=10, help='symbols listed per space')
+    ap.add_argument('--json', help='write the reports of all the projects to this file')
+    ap.add_argument('--no-save', action='store_true', help='keep the previous report')
+    args = ap.parse_args()
+
+    projects = args.projects or sorted(glob.glob(os.path.join(ROOT, '*.X')))
+    if args.map and len(projects) != 1:
+        ap.error('--map needs one project')
+    reports = {}
+    for project in projects:
+        project = project.rstrip('/')
+        path = args.map or find_map(project)
+        if not path:
+            print('%s: no map (build it with XC8 first)' % project, file=sys.stderr)
+            continue
+        result = report(project, path)
+        saved = path + '.size.json'
+        previous = json.load(open(saved)) if os.path.exists(saved) else None
+        print_report(os.path.basename(project), result, previous, args.top)
+        if not args.no_save:
+            with open(saved, 'w') as f:
+                json.dump(result, f, indent=1, sort_keys=True)
+        reports[os.path.basename(project)] = result
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump(reports, f, indent=1, sort_keys=True)
+    return 0 if reports else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
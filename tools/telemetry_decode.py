@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""Decodes the telemetry stream of common/telemetry.c into CSV.
+
+The stream is a sequence of COBS encoded records ended by 0x00:
+    | type | seq | payload | crc low | crc high |
+with CRC-16/CCITT-FALSE over type, seq and payload. See common/telemetry.h.
+CANet.X sends can records at 115200 bit/s, ECTsensor.X ntc and PWM.X adc and pwm
+at 57600 (UART_BAUD of their uart.h).
+
+Output columns: seq, record, ch, value1 ... value5
+    adc  ch, result (0 to 1023)
+    ntc  ch, temperature ('C)
+    pwm  ch, frequency (Hz), duty (%)
+    can  -, tec, rec, eflg, rx, tx
+    param  id, status, value, type    (reply of param_command(), see common/param.h)
+
+With --port, each --param is sent first as a TLM_PARAM record, a command of
+param_command() (ECTsensor.X reads them on RC7):
+    G:id  get    S:id:value  set    W  save to the EEPROM    D  defaults
+
+Examples:
+    telemetry_decode.py capture.bin > capture.csv
+    telemetry_decode.py --port /dev/ttyUSB0 --baud 115200   (needs pyserial)
+    telemetry_decode.py --port /dev/ttyUSB0 --baud 57600    (ECTsensor.X, PWM.X)
+    telemetry_decode.py --port /dev/ttyUSB0 --baud 57600 --param S:0:3950 --param W
+Bad frames and gaps in seq are counted on stderr. With --port it runs until Ctrl+C.
+"""
+
+import argparse
+import csv
+import struct
+import sys
+
+TLM_ADC = 0x01
+TLM_NTC = 0x02
+TLM_PWM = 0x03
+TLM_CAN = 0x04
+TLM_PARAM = 0x05
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE, same as telemetry_crc()."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(frame):
+    """Returns the decoded record, or None if the frame is not valid COBS."""
+    out = bytearray()
+    i = 0
+    while i < len(frame):
+        code = frame[i]
+        if code == 0 or i + code > len(frame):
+            return None
+        out += frame[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(frame):
+            out.append(0)
+    return bytes(out)
+
+
+def cobs_encode(record):
+    """COBS of a record (under 254 bytes) with the 0x00 at the end."""
+    out = bytearray([0])
+    code = 0
+    for byte in record:
+        if byte == 0:
+            out[code] = len(out) - code
+            code = len(out)
+            out.append(0)
+        else:
+            out.append(byte)
+    out[code] = len(out) - code
+    return bytes(out) + b'\x00'
+
+
+def param_record(text, seq):
+    """TLM_PARAM record of a --param command, e.g. 'S:0:3950'."""
+    fields = text.split(':')
+    op = fields[0].upper()
+    if op not in ('G', 'S', 'W', 'D') or len(fields) != {'G': 2, 'S': 3}.get(op, 1):
+        raise ValueError('bad --param %r (G:id, S:id:value, W or D)' % text)
+    payload = op.encode()
+    if op in ('G', 'S'):
+        payload += struct.pack('<B', int(fields[1], 0))
+    if op == 'S':
+        payload += struct.pack('<i', int(fields[2], 0))
+    record = bytes([TLM_PARAM, seq & 0xFF]) + payload
+    return record + struct.pack('<H', crc16(record))
+
+
+def parse(record):
+    """Returns a CSV row for a record with a good CRC, or None."""
+    if len(record) < 4 or crc16(record[:-2]) != struct.unpack_from('<H', record, len(record) - 2)[0]:
+        return None
+    rtype, seq = record[0], record[1]
+    p = record[2:-2]
+    try:
+        if rtype == TLM_ADC:
+            ch, value = struct.unpack('<BH', p)
+            return [seq, 'adc', ch, value]
+        if rtype == TLM_NTC:
+            ch, temp = struct.unpack('<BH', p)
+            return [seq, 'ntc', ch, '%.2f' % (temp / 100.0)]
+        if rtype == TLM_PWM:
+            ch, freq, duty = struct.unpack('<BIH', p)
+            return [seq, 'pwm', ch, freq, '%.1f' % (duty / 10.0)]
+        if rtype == TLM_CAN:
+            tec, rec, eflg, rx, tx = struct.unpack('<BBBHH', p)
+            return [seq, 'can', '', tec, rec, '0x%02X' % eflg, rx, tx]
+        if rtype == TLM_PARAM:
+            status, pid, value, ptype = struct.unpack('<BBiB', p)
+            return [seq, 'param', pid, status, value, ptype]
+    except struct.error:
+        return None
+    return [seq, 'type%d' % rtype, '', p.hex()]
+
+
+def frames(stream, port=False):
+    """Yields the bytes between 0x00 delimiters.
+
+    A file or stdin ends at the first empty read (EOF). A serial port returns
+    an empty read at each timeout with no data: keep waiting (Ctrl+C to stop).
+    """
+    buf = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            if port:
+                continue
+            break
+        for byte in chunk:
+            if byte == 0:
+                if buf:
+                    yield bytes(buf)
+                buf = bytearray()
+            else:
+                buf.append(byte)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('file', nargs='?', help='binary capture (default: stdin)')
+    ap.add_argument('--port', help='serial port, e.g. /dev/ttyUSB0')
+    ap.add_argument('--baud', type=int, default=115200)
+    ap.add_argument('--param', action='append', default=[],
+                    help='command of param_command() sent first: G:id, S:id:value, W, D')
+    args = ap.parse_args()
+
+    try:
+        commands = [cobs_encode(param_record(text, n)) for n, text in enumerate(args.param)]
+    except ValueError as error:
+        ap.error(str(error))
+    if commands and not args.port:
+        ap.error('--param needs --port')
+
+    if args.port:
+        import serial  # pyserial
+        stream = serial.Serial(args.port, args.baud, timeout=1)
+        for frame in commands:
+            stream.write(frame)
+    elif args.file:
+        stream = open(args.file, 'rb')
+    else:
+        stream = sys.stdin.buffer
+
+    out = csv.writer(sys.stdout, lineterminator='\n')
+    out.writerow(['seq', 'record', 'ch', 'value1', 'value2', 'value3', 'value4', 'value5'])
+    bad = lost = 0
+    last_seq = None
+    try:
+        for frame in frames(stream, port=bool(args.port)):
+            record = cobs_decode(frame)
+            row = parse(record) if record else None
+            if row is None:
+                bad += 1
+                continue
+            if last_seq is not None:
+                lost += (row[0] - last_seq - 1) & 0xFF
+            last_seq = row[0]
+            out.writerow(row)
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+    print('bad frames: %d, records lost: %d' % (bad, lost), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()